@@ -0,0 +1,137 @@
+/**
+ * @file bench_collision_callbacks.cpp
+ * @brief Benchmark: callback-heavy collision frames, std::function vs InplaceFunction
+ * @author Ryan Butler
+ * @date 2025
+ *
+ * Measures:
+ * 1. Binding a capturing callback (what SetCollisionCallback does) - std::function
+ *    heap-allocates once the capture outgrows its small buffer; InplaceFunction never does.
+ * 2. Raw invocation cost through each wrapper.
+ * 3. Full CollisionSystem frames where every pair overlaps, so each frame fires
+ *    n*(n-1)/2 callbacks. The game's handler is held in a std::function or an
+ *    InplaceFunction and the system forwards to it, so both runs pay the same
+ *    forwarding hop and differ only in the handler's wrapper.
+ */
+
+#include "ECS/EntityManager.h"
+#include "ECS/CollisionSystem.h"
+#include "Engine/InplaceFunction.h"
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/// Capture state similar to a game-state handler (this + a few locals)
+struct HandlerState {
+    long long hits = 0;
+    float totalOverlap = 0.0f;
+};
+
+template<typename Callback>
+double BenchBind(int iterations, HandlerState& state, int& sink) {
+    auto start = Clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        float scale = static_cast<float>(i & 7);
+        Callback callback = [&state, &sink, scale, i](const CollisionInfo& info) {
+            state.totalOverlap += info.overlapX * scale;
+            sink += i;
+        };
+        CollisionInfo info{Entity(1), Entity(2), 1.0f, 1.0f};
+        callback(info);
+    }
+    return ElapsedMs(start);
+}
+
+template<typename Callback>
+double BenchInvoke(int iterations, HandlerState& state) {
+    Callback callback = [&state](const CollisionInfo& info) {
+        ++state.hits;
+        state.totalOverlap += info.overlapX;
+    };
+    CollisionInfo info{Entity(1), Entity(2), 2.0f, 2.0f};
+
+    auto start = Clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        info.overlapX = static_cast<float>(i & 3);
+        callback(info);
+    }
+    return ElapsedMs(start);
+}
+
+template<typename Callback>
+double BenchCollisionFrames(int entityCount, int frames, long long& callbacks) {
+    EntityManager manager;
+    auto* collision = manager.AddSystem<CollisionSystem>();
+
+    // Stack every collider on the same spot so all pairs overlap
+    for (int i = 0; i < entityCount; ++i) {
+        Entity entity = manager.CreateEntity();
+        manager.AddComponent<TransformComponent>(entity, static_cast<float>(i % 4), 0.0f);
+        manager.AddComponent<CollisionComponent>(entity, 32.0f, 32.0f);
+    }
+
+    HandlerState state;
+    Callback handler = [&state](const CollisionInfo& info) {
+        ++state.hits;
+        state.totalOverlap += info.overlapX + info.overlapY;
+    };
+    collision->SetCollisionCallback([&handler](const CollisionInfo& info) { handler(info); });
+
+    auto start = Clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        manager.Update(1.0f / 60.0f);
+    }
+    double ms = ElapsedMs(start);
+    callbacks = state.hits;
+    return ms;
+}
+
+} // namespace
+
+int main() {
+    constexpr int BIND_ITERATIONS = 2000000;
+    constexpr int INVOKE_ITERATIONS = 50000000;
+
+    HandlerState state;
+    int sink = 0;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "⏱️  COLLISION CALLBACK BENCHMARK" << std::endl;
+    std::cout << "================================" << std::endl;
+
+    double bindStd = BenchBind<std::function<void(const CollisionInfo&)>>(BIND_ITERATIONS, state, sink);
+    double bindInplace = BenchBind<InplaceFunction<void(const CollisionInfo&)>>(BIND_ITERATIONS, state, sink);
+    std::cout << "Bind + call (" << BIND_ITERATIONS << "x, 24-byte capture)" << std::endl;
+    std::cout << "  std::function:   " << bindStd << " ms" << std::endl;
+    std::cout << "  InplaceFunction: " << bindInplace << " ms" << std::endl;
+
+    double invokeStd = BenchInvoke<std::function<void(const CollisionInfo&)>>(INVOKE_ITERATIONS, state);
+    double invokeInplace = BenchInvoke<InplaceFunction<void(const CollisionInfo&)>>(INVOKE_ITERATIONS, state);
+    std::cout << "Invoke (" << INVOKE_ITERATIONS << "x)" << std::endl;
+    std::cout << "  std::function:   " << invokeStd << " ms" << std::endl;
+    std::cout << "  InplaceFunction: " << invokeInplace << " ms" << std::endl;
+
+    std::cout << "CollisionSystem frames (all pairs overlapping)" << std::endl;
+    for (int count : {100, 250, 500}) {
+        constexpr int FRAMES = 60;
+        long long callbacks = 0;
+        double msStd = BenchCollisionFrames<std::function<void(const CollisionInfo&)>>(count, FRAMES, callbacks);
+        double msInplace = BenchCollisionFrames<InplaceFunction<void(const CollisionInfo&)>>(count, FRAMES, callbacks);
+        std::cout << "  " << std::setw(4) << count << " entities, " << callbacks / FRAMES << " callbacks/frame" << std::endl;
+        std::cout << "    std::function:   " << msStd / FRAMES << " ms/frame" << std::endl;
+        std::cout << "    InplaceFunction: " << msInplace / FRAMES << " ms/frame" << std::endl;
+    }
+
+    // Keep results observable so the optimizer can't drop the loops
+    std::cout << "(checksum " << state.hits + sink + static_cast<long long>(state.totalOverlap) % 7 << ")" << std::endl;
+    return 0;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file bench_collision_masks.cpp
+ * @brief Benchmark: pixel-precise overlap tests, packed words vs per-pixel
+ * @author Ryan Butler
+ * @date 2025
+ *
+ * Two disc-shaped sprite masks are tested at many relative offsets, all with
+ * overlapping bounding boxes (the case the narrow phase actually sees). The
+ * packed test ANDs shifted 64-bit row words; the reference walks pixels.
+ */
+
+#include "ECS/CollisionMask.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+CollisionMask MakeDisc(int size) {
+    CollisionMask mask(size, size);
+    float radius = size * 0.5f;
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            float dx = x + 0.5f - radius;
+            float dy = y + 0.5f - radius;
+            if (dx * dx + dy * dy <= radius * radius) {
+                mask.Set(x, y);
+            }
+        }
+    }
+    return mask;
+}
+
+bool PerPixel(const CollisionMask& a, int ax, int ay, const CollisionMask& b, int bx, int by) {
+    for (int y = 0; y < a.GetHeight(); ++y) {
+        for (int x = 0; x < a.GetWidth(); ++x) {
+            if (a.Test(x, y) && b.Test(ax + x - bx, ay + y - by)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template<typename Test>
+double NanosecondsPerTest(int size, Test&& test, long long& checksum) {
+    int tests = 0;
+    auto start = Clock::now();
+    for (int repeat = 0; repeat < 20; ++repeat) {
+        for (int dy = -size + 1; dy < size; dy += 3) {
+            for (int dx = -size + 1; dx < size; dx += 3) {
+                checksum += test(dx, dy) ? 1 : 0;
+                ++tests;
+            }
+        }
+    }
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / tests;
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "⏱️  COLLISION MASK BENCHMARK (overlapping boxes, per test)" << std::endl;
+    std::cout << "==========================================================" << std::endl;
+
+    long long checksum = 0;
+    for (int size : {32, 64, 128, 256}) {
+        CollisionMask a = MakeDisc(size);
+        CollisionMask b = MakeDisc(size);
+        double packed = NanosecondsPerTest(size, [&](int dx, int dy) {
+            return CollisionMask::Overlaps(a, 0, 0, false, b, dx, dy, false);
+        }, checksum);
+        double pixels = NanosecondsPerTest(size, [&](int dx, int dy) {
+            return PerPixel(a, 0, 0, b, dx, dy);
+        }, checksum);
+        std::cout << std::setw(4) << size << "x" << std::setw(3) << size << " sprites: packed " << std::setw(7)
+                  << packed << " ns, per-pixel " << std::setw(9) << pixels << " ns ("
+                  << pixels / packed << "x)" << std::endl;
+    }
+
+    // Keep results observable so the optimizer can't drop the loops
+    std::cout << "(checksum " << checksum << ")" << std::endl;
+    return 0;
+}
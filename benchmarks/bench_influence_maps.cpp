@@ -0,0 +1,113 @@
+/**
+ * @file bench_influence_maps.cpp
+ * @brief Benchmark: incremental influence map updates vs full recomputes
+ * @author Ryan Butler
+ * @date 2025
+ *
+ * Sources wander over a 256x64 grid of 32 unit cells at enemy speeds, so
+ * most frames only a fraction of them change cell. Each frame is timed as
+ * an incremental Update() and as a full rebuild (clear, restamp every
+ * source) of an identical map, with and without a two-pass blur.
+ */
+
+#include "ECS/InfluenceMap.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int COLUMNS = 256;
+constexpr int ROWS = 64;
+constexpr float CELL = 32.0f;
+constexpr float STEP = 1.0f / 60.0f;
+constexpr int FRAMES = 300;
+
+struct Result {
+    double incrementalMs = 0.0;
+    double fullMs = 0.0;
+    double sampleNs = 0.0;
+};
+
+Result Run(int sourceCount, int blurPasses) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> px(0.0f, COLUMNS * CELL);
+    std::uniform_real_distribution<float> py(0.0f, ROWS * CELL);
+    std::uniform_real_distribution<float> speed(-120.0f, 120.0f);
+
+    std::vector<float> x(sourceCount), y(sourceCount), vx(sourceCount), vy(sourceCount);
+    InfluenceMap incremental(COLUMNS, ROWS, CELL);
+    InfluenceMap full(COLUMNS, ROWS, CELL);
+    incremental.SetBlurPasses(blurPasses);
+    full.SetBlurPasses(blurPasses);
+    std::vector<int> ids(sourceCount);
+    for (int i = 0; i < sourceCount; ++i) {
+        x[i] = px(rng);
+        y[i] = py(rng);
+        vx[i] = speed(rng);
+        vy[i] = speed(rng);
+        ids[i] = incremental.AddSource(x[i], y[i], 1.0f, 160.0f);
+    }
+    incremental.Update();
+
+    Result result;
+    double sampleSink = 0.0;
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        for (int i = 0; i < sourceCount; ++i) {
+            x[i] += vx[i] * STEP;
+            y[i] += vy[i] * STEP;
+        }
+
+        auto start = Clock::now();
+        for (int i = 0; i < sourceCount; ++i) {
+            incremental.MoveSource(ids[i], x[i], y[i]);
+        }
+        incremental.Update();
+        result.incrementalMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        start = Clock::now();
+        full.Clear();
+        full.SetBlurPasses(0);
+        full.SetBlurPasses(blurPasses);
+        for (int i = 0; i < sourceCount; ++i) {
+            full.AddSource(x[i], y[i], 1.0f, 160.0f);
+        }
+        full.Update();
+        result.fullMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        start = Clock::now();
+        for (int i = 0; i < sourceCount; ++i) {
+            sampleSink += incremental.Sample(x[i] + 40.0f, y[i]);
+        }
+        result.sampleNs += std::chrono::duration<double, std::nano>(Clock::now() - start).count() / sourceCount;
+    }
+    result.incrementalMs /= FRAMES;
+    result.fullMs /= FRAMES;
+    result.sampleNs /= FRAMES;
+    if (sampleSink < 0.0) {
+        std::cout << "";
+    }
+    return result;
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "⏱️  INFLUENCE MAP BENCHMARK (256x64 cells, per frame)" << std::endl;
+    std::cout << "====================================================" << std::endl;
+
+    for (int blur : {0, 2}) {
+        for (int sources : {50, 200, 1000}) {
+            Result result = Run(sources, blur);
+            std::cout << std::setw(5) << sources << " sources, blur " << blur << ": incremental "
+                      << result.incrementalMs << " ms, full " << result.fullMs << " ms, sample "
+                      << std::setprecision(1) << result.sampleNs << " ns" << std::setprecision(3) << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file bench_physics_sleeping.cpp
+ * @brief Benchmark: PhysicsSystem step cost for a resting crowd, with and without sleeping
+ * @author Ryan Butler
+ * @date 2025
+ *
+ * Drops stacks of boxes onto a static floor, lets them settle, then times
+ * steps once everything is at rest. With sleeping enabled the settled crowd
+ * leaves the system entirely; without it every body is re-solved each step.
+ */
+
+#include "ECS/EntityManager.h"
+#include "ECS/PhysicsSystem.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr float STEP = 1.0f / 60.0f;
+constexpr float BOX = 16.0f;
+constexpr int STACK_HEIGHT = 4;
+
+double ElapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+Entity AddBody(EntityManager& manager, float x, float y, float width, float height, float mass) {
+    Entity entity = manager.CreateEntity();
+    manager.AddComponent<TransformComponent>(entity, x, y);
+    manager.AddComponent<VelocityComponent>(entity);
+    manager.AddComponent<CollisionComponent>(entity, width, height);
+    manager.AddComponent<RigidBodyComponent>(entity, mass);
+    return entity;
+}
+
+struct Result {
+    double settleMs = 0.0;  ///< Average step while falling and settling
+    double restMs = 0.0;    ///< Average step once settled
+    std::size_t awake = 0;  ///< Bodies still simulated at the end
+};
+
+Result Run(int bodyCount, bool sleeping) {
+    EntityManager manager;
+    auto* physics = manager.AddSystem<PhysicsSystem>();
+    physics->SetCellSize(BOX * 2.0f);
+    physics->SetSleepingEnabled(sleeping);
+
+    int columns = bodyCount / STACK_HEIGHT;
+    float floorY = 400.0f;
+    AddBody(manager, 0.0f, floorY, columns * BOX * 2.0f, 32.0f, 0.0f);
+    for (int i = 0; i < bodyCount; ++i) {
+        float x = (i / STACK_HEIGHT) * BOX * 2.0f;
+        float y = floorY - (i % STACK_HEIGHT + 1) * (BOX + 4.0f);
+        AddBody(manager, x, y, BOX, BOX, 1.0f);
+    }
+
+    Result result;
+    constexpr int SETTLE_STEPS = 180;
+    auto start = Clock::now();
+    for (int i = 0; i < SETTLE_STEPS; ++i) {
+        manager.Update(STEP);
+    }
+    result.settleMs = ElapsedMs(start) / SETTLE_STEPS;
+
+    constexpr int REST_STEPS = 120;
+    start = Clock::now();
+    for (int i = 0; i < REST_STEPS; ++i) {
+        manager.Update(STEP);
+    }
+    result.restMs = ElapsedMs(start) / REST_STEPS;
+    result.awake = physics->GetEntities().Size();
+    return result;
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "⏱️  PHYSICS SLEEPING BENCHMARK (stacks of " << STACK_HEIGHT << " on a static floor)" << std::endl;
+    std::cout << "===================================================================" << std::endl;
+
+    for (int count : {1000, 5000, 20000}) {
+        Result awake = Run(count, false);
+        Result asleep = Run(count, true);
+        std::cout << std::setw(6) << count << " bodies" << std::endl;
+        std::cout << "  no sleeping: settle " << awake.settleMs << " ms/step, rest " << awake.restMs
+                  << " ms/step (" << awake.awake << " awake)" << std::endl;
+        std::cout << "  sleeping:    settle " << asleep.settleMs << " ms/step, rest " << asleep.restMs
+                  << " ms/step (" << asleep.awake << " awake)" << std::endl;
+    }
+    return 0;
+}
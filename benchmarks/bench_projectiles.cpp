@@ -0,0 +1,90 @@
+/**
+ * @file bench_projectiles.cpp
+ * @brief Benchmark: ProjectileSystem step cost with tens of thousands of live bullets
+ * @author Ryan Butler
+ * @date 2025
+ *
+ * Colliders are scattered over a 4000x4000 field and bullets are fired in
+ * random directions from random points. Every step the pool is topped back
+ * up, so the live count stays at the target while hits and expiries churn it.
+ */
+
+#include "ECS/EntityManager.h"
+#include "ECS/ProjectileSystem.h"
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr float STEP = 1.0f / 60.0f;
+constexpr float FIELD = 4000.0f;
+
+struct Result {
+    double stepMs = 0.0;
+    std::size_t hitsPerStep = 0;
+};
+
+Result Run(std::size_t liveCount, int targetCount) {
+    EntityManager manager;
+    auto* projectiles = manager.AddSystem<ProjectileSystem>(liveCount);
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position(0.0f, FIELD);
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+    for (int i = 0; i < targetCount; ++i) {
+        Entity target = manager.CreateEntity();
+        manager.AddComponent<TransformComponent>(target, position(rng), position(rng));
+        manager.AddComponent<CollisionComponent>(target, 32.0f, 32.0f);
+        manager.AddTag<EnemyTag>(target);
+    }
+
+    auto refill = [&]() {
+        while (projectiles->GetCount() < liveCount) {
+            float a = angle(rng);
+            projectiles->Spawn(position(rng), position(rng), std::cos(a) * 400.0f, std::sin(a) * 400.0f,
+                               3.0f, 1.0f, Entity(), ProjectileSystem::TARGET_ENEMY);
+        }
+    };
+
+    constexpr int WARMUP = 30;
+    constexpr int STEPS = 120;
+    for (int i = 0; i < WARMUP; ++i) {
+        refill();
+        manager.Update(STEP);
+    }
+
+    Result result;
+    double total = 0.0;
+    for (int i = 0; i < STEPS; ++i) {
+        refill();
+        auto start = Clock::now();
+        manager.Update(STEP);
+        total += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        result.hitsPerStep += projectiles->GetHits().size();
+    }
+    result.stepMs = total / STEPS;
+    result.hitsPerStep /= STEPS;
+    return result;
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "⏱️  PROJECTILE BENCHMARK (step cost, 60 Hz budget 16.7 ms)" << std::endl;
+    std::cout << "=========================================================" << std::endl;
+
+    for (std::size_t live : {5000, 20000, 50000}) {
+        for (int targets : {100, 1000}) {
+            Result result = Run(live, targets);
+            std::cout << std::setw(6) << live << " projectiles, " << std::setw(4) << targets << " targets: "
+                      << result.stepMs << " ms/step (" << result.hitsPerStep << " hits/step)" << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,128 @@
+/**
+ * @file bench_render_queue.cpp
+ * @brief Benchmark: RenderQueue ordering vs a per-frame std::sort
+ * @author Ryan Butler
+ * @date 2025
+ *
+ * Sprites wander over a 1280x720 screen on two layers. Each frame every
+ * sprite moves a little and is pushed in a shuffled order (as if ECS
+ * iteration order changed), then the queue is sorted. The same frames are
+ * also ordered with std::stable_sort on (layer, y) for comparison, and the
+ * two orders are checked to produce the same key sequence.
+ */
+
+#include "Engine/RenderQueue.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Sprite {
+    float y;
+    float vy;
+    std::uint8_t layer;
+};
+
+struct Result {
+    double queueMs = 0.0;
+    double stdSortMs = 0.0;
+    double skippedPercent = 0.0;   ///< Frames already in order
+    double fixedUpPercent = 0.0;   ///< Frames ordered by the insertion fix-up alone
+    int mismatches = 0;
+};
+
+Result Run(int spriteCount, float speed) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position(0.0f, 720.0f);
+    std::uniform_real_distribution<float> velocity(-speed, speed);
+    std::vector<Sprite> sprites(spriteCount);
+    for (Sprite& sprite : sprites) {
+        sprite = Sprite{position(rng), velocity(rng), static_cast<std::uint8_t>(rng() % 8 == 0 ? 2 : 1)};
+    }
+
+    std::vector<std::uint32_t> pushOrder(spriteCount);
+    std::iota(pushOrder.begin(), pushOrder.end(), 0);
+    std::vector<std::uint32_t> byStdSort(spriteCount);
+
+    RenderQueue queue;
+    constexpr int FRAMES = 200;
+    Result result;
+    int skipped = 0;
+    int fixedUp = 0;
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        for (Sprite& sprite : sprites) {
+            sprite.y += sprite.vy / 60.0f;
+            if (sprite.y < 0.0f || sprite.y > 720.0f) {
+                sprite.vy = -sprite.vy;
+            }
+        }
+        // Swap a few pairs: iteration order drifts as entities come and go
+        for (int i = 0; i < spriteCount / 100; ++i) {
+            std::swap(pushOrder[rng() % spriteCount], pushOrder[rng() % spriteCount]);
+        }
+
+        auto start = Clock::now();
+        queue.Clear();
+        for (std::uint32_t id : pushOrder) {
+            queue.Push(id, sprites[id].layer, sprites[id].y);
+        }
+        const std::vector<std::uint32_t>& order = queue.Sort();
+        result.queueMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        skipped += queue.WasAlreadySorted() ? 1 : 0;
+        fixedUp += !queue.WasAlreadySorted() && queue.GetLastPassCount() == 0 ? 1 : 0;
+
+        start = Clock::now();
+        byStdSort = pushOrder;
+        std::stable_sort(byStdSort.begin(), byStdSort.end(), [&](std::uint32_t a, std::uint32_t b) {
+            return sprites[a].layer != sprites[b].layer ? sprites[a].layer < sprites[b].layer
+                                                        : sprites[a].y < sprites[b].y;
+        });
+        result.stdSortMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        // Compare keys, not ids: sprites with equal keys may tie either way
+        bool same = order.size() == byStdSort.size();
+        for (std::size_t rank = 0; same && rank < order.size(); ++rank) {
+            const Sprite& queued = sprites[pushOrder[order[rank]]];
+            const Sprite& reference = sprites[byStdSort[rank]];
+            same = RenderQueue::MakeKey(queued.layer, queued.y) == RenderQueue::MakeKey(reference.layer, reference.y);
+        }
+        result.mismatches += same ? 0 : 1;
+    }
+    result.queueMs /= FRAMES;
+    result.stdSortMs /= FRAMES;
+    result.skippedPercent = 100.0 * skipped / FRAMES;
+    result.fixedUpPercent = 100.0 * fixedUp / FRAMES;
+    return result;
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "⏱️  RENDER QUEUE BENCHMARK (push + sort per frame)" << std::endl;
+    std::cout << "=================================================" << std::endl;
+
+    bool failed = false;
+    for (int sprites : {1000, 10000}) {
+        for (float speed : {0.0f, 30.0f, 300.0f}) {
+            Result result = Run(sprites, speed);
+            std::cout << std::setw(6) << sprites << " sprites, speed " << std::setw(5) << std::setprecision(0)
+                      << speed << std::setprecision(3) << ": queue " << result.queueMs << " ms ("
+                      << std::setprecision(0) << result.skippedPercent << "% sorted, " << result.fixedUpPercent
+                      << "% fixed up)" << std::setprecision(3) << ", std::stable_sort " << result.stdSortMs << " ms"
+                      << std::endl;
+            if (result.mismatches > 0) {
+                std::cout << "  ❌ order differs from std::stable_sort in " << result.mismatches << " frames" << std::endl;
+                failed = true;
+            }
+        }
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file bench_steering.cpp
+ * @brief Benchmark: SteeringSystem step cost for flocking swarms
+ * @author Ryan Butler
+ * @date 2025
+ *
+ * Agents start scattered at a density where each sees roughly ten
+ * flockmates, with all behaviours enabled and a shared seek target. Only the
+ * steering step is timed; MovementSystem keeps the swarm moving between steps.
+ */
+
+#include "ECS/EntityManager.h"
+#include "ECS/MovementSystem.h"
+#include "ECS/SteeringSystem.h"
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr float STEP = 1.0f / 60.0f;
+
+struct Result {
+    double stepMs = 0.0;
+    double neighborsPerAgent = 0.0;
+};
+
+Result Run(int agentCount) {
+    EntityManager manager;
+    auto* steering = manager.AddSystem<SteeringSystem>();
+    auto* movement = manager.AddSystem<MovementSystem>();
+
+    // ~10 flockmates inside a 48 unit radius
+    const float field = std::sqrt(agentCount * 3.14159f * 48.0f * 48.0f / 10.0f);
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position(0.0f, field);
+    std::uniform_real_distribution<float> velocity(-60.0f, 60.0f);
+    for (int i = 0; i < agentCount; ++i) {
+        Entity agent = manager.CreateEntity();
+        manager.AddComponent<TransformComponent>(agent, position(rng), position(rng));
+        manager.AddComponent<VelocityComponent>(agent, velocity(rng), velocity(rng));
+        auto* params = manager.AddComponent<SteeringComponent>(agent, 80.0f, i % 2);
+        params->seekX = field * 0.5f;
+        params->seekY = field * 0.5f;
+        params->seekWeight = 0.2f;
+    }
+    for (int i = 0; i < 8; ++i) {
+        steering->AddObstacle(position(rng), position(rng), 30.0f);
+    }
+
+    constexpr int WARMUP = 30;
+    constexpr int STEPS = 120;
+    for (int i = 0; i < WARMUP; ++i) {
+        manager.Update(STEP);
+    }
+
+    Result result;
+    double total = 0.0;
+    std::size_t neighbors = 0;
+    for (int i = 0; i < STEPS; ++i) {
+        auto start = Clock::now();
+        steering->Update(STEP);
+        total += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        neighbors += steering->GetNeighborCount();
+        movement->Update(STEP);
+    }
+    result.stepMs = total / STEPS;
+    result.neighborsPerAgent = static_cast<double>(neighbors) / STEPS / agentCount;
+    return result;
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "⏱️  STEERING BENCHMARK (flocking step cost)" << std::endl;
+    std::cout << "==========================================" << std::endl;
+
+    for (int agents : {1000, 5000, 10000}) {
+        Result result = Run(agents);
+        std::cout << std::setw(6) << agents << " agents: " << result.stepMs << " ms/step ("
+                  << std::setprecision(1) << result.neighborsPerAgent << " neighbours/agent)"
+                  << std::setprecision(3) << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,58 @@
+#!/bin/bash
+
+echo "⏱️  GAME ENGINE BENCHMARKS"
+echo "========================="
+
+# Make sure we're in the benchmarks directory
+cd "$(dirname "$0")"
+
+mkdir -p ../build
+
+# Function to build and run a benchmark (optimized build, ECS sources only)
+run_benchmark() {
+    local benchmark_name="$1"
+    local benchmark_source="$2"
+    shift 2
+    local extra_sources="$@"
+
+    echo ""
+    echo "🔍 $benchmark_name"
+    echo "----------------------------------------"
+
+    g++ -std=c++17 -O2 -DNDEBUG -I../include \
+        $benchmark_source.cpp \
+        $extra_sources \
+        -o ../build/$benchmark_source
+
+    if [ $? -ne 0 ]; then
+        echo "❌ COMPILATION FAILED for $benchmark_name"
+        return 1
+    fi
+
+    ../build/$benchmark_source
+    rm -f ../build/$benchmark_source
+}
+
+run_benchmark "Collision Callbacks" "bench_collision_callbacks" \
+    ../src/ECS/EntityManager.cpp ../src/ECS/CollisionSystem.cpp ../src/ECS/CollisionMask.cpp ../src/ECS/Reflection.cpp
+
+run_benchmark "Spatial Ordering" "bench_spatial_ordering" \
+    ../src/ECS/EntityManager.cpp ../src/ECS/Reflection.cpp
+
+run_benchmark "Physics Sleeping" "bench_physics_sleeping" \
+    ../src/ECS/EntityManager.cpp ../src/ECS/PhysicsSystem.cpp ../src/ECS/Reflection.cpp
+
+run_benchmark "Collision Masks" "bench_collision_masks" \
+    ../src/ECS/CollisionMask.cpp
+
+run_benchmark "Projectiles" "bench_projectiles" \
+    ../src/ECS/EntityManager.cpp ../src/ECS/ProjectileSystem.cpp ../src/ECS/Reflection.cpp
+
+run_benchmark "Steering" "bench_steering" \
+    ../src/ECS/EntityManager.cpp ../src/ECS/SteeringSystem.cpp ../src/ECS/Reflection.cpp
+
+run_benchmark "Influence Maps" "bench_influence_maps" \
+    ../src/ECS/InfluenceMap.cpp
+
+run_benchmark "Render Queue" "bench_render_queue" \
+    ../src/Engine/RenderQueue.cpp
@@ -28,6 +28,17 @@ struct AnimationFrame {
         : frameX(x), frameY(y), frameWidth(w), frameHeight(h), duration(dur) {}
 };
 
+template<> struct Reflect<AnimationFrame> {
+    static void Describe(TypeBuilder<AnimationFrame>& t) {
+        t.Name("AnimationFrame")
+         .Field("frameX", &AnimationFrame::frameX)
+         .Field("frameY", &AnimationFrame::frameY)
+         .Field("frameWidth", &AnimationFrame::frameWidth)
+         .Field("frameHeight", &AnimationFrame::frameHeight)
+         .Field("duration", &AnimationFrame::duration);
+    }
+};
+
 /**
  * @struct Animation
  * @brief Represents a complete animation sequence
@@ -164,3 +175,15 @@ struct AnimationComponent : public Component {
         return isPlaying && !isPaused && currentAnimation == animationName;
     }
 };
+
+template<> struct Reflect<AnimationComponent> {
+    static void Describe(TypeBuilder<AnimationComponent>& t) {
+        t.Name("AnimationComponent")
+         .Field("currentAnimation", &AnimationComponent::currentAnimation)
+         .Field("currentFrame", &AnimationComponent::currentFrame)
+         .Field("frameTimer", &AnimationComponent::frameTimer)
+         .Field("isPlaying", &AnimationComponent::isPlaying)
+         .Field("isPaused", &AnimationComponent::isPaused)
+         .Field("reverse", &AnimationComponent::reverse);
+    }
+};
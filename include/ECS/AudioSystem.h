@@ -39,6 +39,11 @@
  */
 class AudioSystem : public System {
 public:
+    /// Entity query and further component access (used by SystemPipeline scheduling)
+    using Required = ComponentList<AudioComponent>;
+    using Reads = ComponentList<TransformComponent>;
+    using Writes = ComponentList<AudioComponent>;
+
     /**
      * @brief Constructor with audio manager reference
      * @param audioManager Reference to the audio manager
@@ -61,6 +66,7 @@ public:
      * @param deltaTime Time elapsed since last update
      */
     void Update(float deltaTime) override;
+    const char* GetName() const override { return "AudioSystem"; }
 
     /**
      * @brief Called when an entity is added to the system
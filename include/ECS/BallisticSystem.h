@@ -0,0 +1,162 @@
+/**
+ * @file BallisticSystem.h
+ * @brief Parks constant-velocity movers outside the active region and evaluates them in closed form
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include "System.h"
+#include "EntityManager.h"
+#include "Component.h"
+#include <limits>
+#include <vector>
+
+/**
+ * @class BallisticSystem
+ * @brief Lazy, closed-form motion for BallisticComponent entities nobody can see
+ *
+ * A ballistic entity that leaves the active region (typically the camera view
+ * plus a margin) is tagged DormantTag: it records where and when it went
+ * dormant, and MovementSystem and CollisionSystem stop processing it. Its
+ * position is x0 + v * (t - t0), evaluated by GetPosition() on demand and
+ * written back to the TransformComponent when the entity re-enters the
+ * region, at which point it is woken up.
+ *
+ * The per-frame cost for a dormant entity is one position evaluation and a
+ * bounds test; no transform writes, collision pairs or game-side bounds
+ * checks. Until SetActiveRegion() is called the region is unbounded and
+ * nothing goes dormant.
+ *
+ * Only give entities a BallisticComponent if nothing changes their velocity:
+ * dormant entities are not steered, bounced or pushed.
+ *
+ * @example
+ * ```cpp
+ * entityManager.AddComponent<VelocityComponent>(enemy, -80.0f, 0.0f);
+ * entityManager.AddComponent<BallisticComponent>(enemy);
+ *
+ * // Each frame, before MovementSystem
+ * ballistic.SetActiveRegion(cameraX - 200.0f, -1000.0f, cameraX + 1000.0f, 1000.0f);
+ * ballistic.Update(deltaTime);
+ * ```
+ */
+class BallisticSystem : public System {
+public:
+    /// Entity query and further component access (used by SystemPipeline scheduling).
+    /// Adding and removing DormantTag changes other systems' membership: a write.
+    using Required = ComponentList<TransformComponent, VelocityComponent, BallisticComponent>;
+    using Reads = ComponentList<>;
+    using Writes = ComponentList<TransformComponent, BallisticComponent, DormantTag>;
+
+    /// How far past the active region an entity must go before it turns dormant
+    static constexpr float SLEEP_MARGIN = 64.0f;
+
+    /**
+     * @brief Constructor - declares the Transform + Velocity + Ballistic requirement
+     */
+    BallisticSystem() { Require(Required{}); }
+
+    /**
+     * @brief Set the area in which ballistic entities are simulated normally
+     * @param left Smallest world X
+     * @param top Smallest world Y
+     * @param right Largest world X
+     * @param bottom Largest world Y
+     */
+    void SetActiveRegion(float left, float top, float right, float bottom) {
+        m_left = left;
+        m_top = top;
+        m_right = right;
+        m_bottom = bottom;
+    }
+
+    /**
+     * @brief Wake entities entering the region, park those leaving it, advance the clock
+     * @param deltaTime Time elapsed since last update in seconds
+     */
+    void Update(float deltaTime) override {
+        // Positions are evaluated at the start of the frame; woken entities
+        // are then integrated over this frame by MovementSystem
+        m_toWake.clear();
+        m_toSleep.clear();
+
+        for (Entity entity : GetEntities()) {
+            auto* transform = m_entityManager->GetComponent<TransformComponent>(entity);
+            auto* velocity = m_entityManager->GetComponent<VelocityComponent>(entity);
+            auto* ballistic = m_entityManager->GetComponent<BallisticComponent>(entity);
+
+            if (m_entityManager->HasComponent<DormantTag>(entity)) {
+                float x = ballistic->originX + velocity->vx * (m_time - ballistic->startTime);
+                float y = ballistic->originY + velocity->vy * (m_time - ballistic->startTime);
+                bool entering = IsInside(x, y, 0.0f);
+                if (entering) {
+                    m_toWake.push_back(entity);
+                }
+                // Keep the stored transform out of view while the real position is elsewhere
+                if (entering || IsInside(transform->x, transform->y, 0.0f)) {
+                    transform->x = x;
+                    transform->y = y;
+                }
+            } else if (!IsInside(transform->x, transform->y, SLEEP_MARGIN)) {
+                ballistic->originX = transform->x;
+                ballistic->originY = transform->y;
+                ballistic->startTime = m_time;
+                m_toSleep.push_back(entity);
+            }
+        }
+
+        // Tag changes update system membership, so apply them after iterating
+        for (Entity entity : m_toWake) {
+            m_entityManager->RemoveTag<DormantTag>(entity);
+        }
+        for (Entity entity : m_toSleep) {
+            m_entityManager->AddTag<DormantTag>(entity);
+        }
+
+        m_time += deltaTime;
+    }
+
+    /**
+     * @brief Current position of an entity, evaluated in closed form if dormant
+     * @param entity Entity to query
+     * @param x Receives the X position
+     * @param y Receives the Y position
+     * @return false if the entity has no TransformComponent
+     */
+    bool GetPosition(Entity entity, float& x, float& y) const {
+        const auto* transform = m_entityManager->GetComponent<TransformComponent>(entity);
+        if (!transform) {
+            return false;
+        }
+
+        x = transform->x;
+        y = transform->y;
+        if (m_entityManager->HasComponent<DormantTag>(entity)) {
+            const auto* velocity = m_entityManager->GetComponent<VelocityComponent>(entity);
+            const auto* ballistic = m_entityManager->GetComponent<BallisticComponent>(entity);
+            x = ballistic->originX + velocity->vx * (m_time - ballistic->startTime);
+            y = ballistic->originY + velocity->vy * (m_time - ballistic->startTime);
+        }
+        return true;
+    }
+
+    /// Seconds simulated since the system was created
+    float GetTime() const { return m_time; }
+
+    const char* GetName() const override { return "BallisticSystem"; }
+
+private:
+    float m_time = 0.0f;
+    float m_left = -std::numeric_limits<float>::max();
+    float m_top = -std::numeric_limits<float>::max();
+    float m_right = std::numeric_limits<float>::max();
+    float m_bottom = std::numeric_limits<float>::max();
+    std::vector<Entity> m_toWake;
+    std::vector<Entity> m_toSleep;
+
+    bool IsInside(float x, float y, float margin) const {
+        return x >= m_left - margin && x <= m_right + margin && y >= m_top - margin && y <= m_bottom + margin;
+    }
+};
@@ -0,0 +1,227 @@
+/**
+ * @file CollisionShapes.h
+ * @brief Dense per-shape collider arrays and statically dispatched pair tests
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include "Component.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Narrow-phase geometry for one frame, stored per shape as structure-of-arrays
+ *
+ * Circles are a centre and radius. Capsules are a core segment plus radius;
+ * the segment is axis-aligned (the capsule's long axis), so it is stored as
+ * a degenerate box and every round test reduces to a clamp and a distance.
+ */
+struct CollisionShapeArrays {
+    struct Boxes {
+        std::vector<float> left, top, right, bottom;
+    } boxes;
+
+    struct Circles {
+        std::vector<float> x, y, radius;
+    } circles;
+
+    struct Capsules {
+        std::vector<float> left, top, right, bottom, radius; ///< Core segment as a degenerate box
+    } capsules;
+
+    void Clear() {
+        for (auto* values : {&boxes.left, &boxes.top, &boxes.right, &boxes.bottom,
+                             &circles.x, &circles.y, &circles.radius,
+                             &capsules.left, &capsules.top, &capsules.right, &capsules.bottom,
+                             &capsules.radius}) {
+            values->clear();
+        }
+    }
+
+    /**
+     * @brief Append a collider's shape to its array
+     * @param x Bounding box left
+     * @param y Bounding box top
+     * @param collider Box size and shape
+     * @return Slot in the array for collider.shape
+     */
+    std::uint32_t Add(float x, float y, const CollisionComponent& collider) {
+        float width = collider.width;
+        float height = collider.height;
+        float radius = std::min(width, height) * 0.5f;
+
+        switch (collider.shape) {
+            case CollisionComponent::Shape::CIRCLE:
+                circles.x.push_back(x + width * 0.5f);
+                circles.y.push_back(y + height * 0.5f);
+                circles.radius.push_back(radius);
+                return static_cast<std::uint32_t>(circles.x.size() - 1);
+            case CollisionComponent::Shape::CAPSULE:
+                capsules.left.push_back(x + radius);
+                capsules.top.push_back(y + radius);
+                capsules.right.push_back(x + width - radius);
+                capsules.bottom.push_back(y + height - radius);
+                capsules.radius.push_back(radius);
+                return static_cast<std::uint32_t>(capsules.left.size() - 1);
+            case CollisionComponent::Shape::BOX:
+            default:
+                boxes.left.push_back(x);
+                boxes.top.push_back(y);
+                boxes.right.push_back(x + width);
+                boxes.bottom.push_back(y + height);
+                return static_cast<std::uint32_t>(boxes.left.size() - 1);
+        }
+    }
+};
+
+/**
+ * @brief Candidate pairs of one shape combination, tested together in one loop
+ *
+ * a and b are slots in CollisionShapeArrays (a always has the lower shape
+ * enum), candidate indexes the caller's pair list, and hit receives the result.
+ */
+struct CollisionPairBatch {
+    std::vector<std::uint32_t> a, b, candidate;
+    std::vector<float> minOverlap; ///< Box-box only: overlap required on both axes
+    std::vector<std::uint8_t> hit;
+
+    void Clear() {
+        a.clear();
+        b.clear();
+        candidate.clear();
+        minOverlap.clear();
+        hit.clear();
+    }
+};
+
+namespace CollisionShapes {
+
+using Shape = CollisionComponent::Shape;
+
+constexpr int SHAPE_COUNT = 3;
+constexpr int PAIR_KIND_COUNT = SHAPE_COUNT * (SHAPE_COUNT + 1) / 2;
+
+/// Batch index of an unordered shape pair (a <= b)
+constexpr int PairKind(Shape a, Shape b) {
+    int low = static_cast<int>(a);
+    int high = static_cast<int>(b);
+    return low * SHAPE_COUNT - low * (low - 1) / 2 + (high - low);
+}
+
+/// Squared gap between two axis-aligned boxes (0 if they touch or overlap)
+inline float GapSquared(float leftA, float topA, float rightA, float bottomA,
+                        float leftB, float topB, float rightB, float bottomB) {
+    float dx = std::max(0.0f, std::max(leftA - rightB, leftB - rightA));
+    float dy = std::max(0.0f, std::max(topA - bottomB, topB - bottomA));
+    return dx * dx + dy * dy;
+}
+
+/**
+ * @brief Narrow-phase test for one shape combination
+ *
+ * Each specialization runs a branch-free loop over a whole batch, reading
+ * the two dense arrays it needs; nothing is dispatched per pair.
+ */
+template<Shape A, Shape B>
+struct PairTest;
+
+template<> struct PairTest<Shape::BOX, Shape::BOX> {
+    static void Run(const CollisionShapeArrays& s, CollisionPairBatch& batch) {
+        const auto& box = s.boxes;
+        for (std::size_t i = 0; i < batch.a.size(); ++i) {
+            std::uint32_t a = batch.a[i], b = batch.b[i];
+            float ox = std::min(box.right[a], box.right[b]) - std::max(box.left[a], box.left[b]);
+            float oy = std::min(box.bottom[a], box.bottom[b]) - std::max(box.top[a], box.top[b]);
+            batch.hit[i] = (ox > batch.minOverlap[i]) & (oy > batch.minOverlap[i]);
+        }
+    }
+};
+
+template<> struct PairTest<Shape::BOX, Shape::CIRCLE> {
+    static void Run(const CollisionShapeArrays& s, CollisionPairBatch& batch) {
+        const auto& box = s.boxes;
+        const auto& circle = s.circles;
+        for (std::size_t i = 0; i < batch.a.size(); ++i) {
+            std::uint32_t a = batch.a[i], b = batch.b[i];
+            float dx = circle.x[b] - std::clamp(circle.x[b], box.left[a], box.right[a]);
+            float dy = circle.y[b] - std::clamp(circle.y[b], box.top[a], box.bottom[a]);
+            batch.hit[i] = dx * dx + dy * dy < circle.radius[b] * circle.radius[b];
+        }
+    }
+};
+
+template<> struct PairTest<Shape::BOX, Shape::CAPSULE> {
+    static void Run(const CollisionShapeArrays& s, CollisionPairBatch& batch) {
+        const auto& box = s.boxes;
+        const auto& capsule = s.capsules;
+        for (std::size_t i = 0; i < batch.a.size(); ++i) {
+            std::uint32_t a = batch.a[i], b = batch.b[i];
+            float gap = GapSquared(box.left[a], box.top[a], box.right[a], box.bottom[a],
+                                   capsule.left[b], capsule.top[b], capsule.right[b], capsule.bottom[b]);
+            batch.hit[i] = gap < capsule.radius[b] * capsule.radius[b];
+        }
+    }
+};
+
+template<> struct PairTest<Shape::CIRCLE, Shape::CIRCLE> {
+    static void Run(const CollisionShapeArrays& s, CollisionPairBatch& batch) {
+        const auto& circle = s.circles;
+        for (std::size_t i = 0; i < batch.a.size(); ++i) {
+            std::uint32_t a = batch.a[i], b = batch.b[i];
+            float dx = circle.x[b] - circle.x[a];
+            float dy = circle.y[b] - circle.y[a];
+            float reach = circle.radius[a] + circle.radius[b];
+            batch.hit[i] = dx * dx + dy * dy < reach * reach;
+        }
+    }
+};
+
+template<> struct PairTest<Shape::CIRCLE, Shape::CAPSULE> {
+    static void Run(const CollisionShapeArrays& s, CollisionPairBatch& batch) {
+        const auto& circle = s.circles;
+        const auto& capsule = s.capsules;
+        for (std::size_t i = 0; i < batch.a.size(); ++i) {
+            std::uint32_t a = batch.a[i], b = batch.b[i];
+            float dx = circle.x[a] - std::clamp(circle.x[a], capsule.left[b], capsule.right[b]);
+            float dy = circle.y[a] - std::clamp(circle.y[a], capsule.top[b], capsule.bottom[b]);
+            float reach = circle.radius[a] + capsule.radius[b];
+            batch.hit[i] = dx * dx + dy * dy < reach * reach;
+        }
+    }
+};
+
+template<> struct PairTest<Shape::CAPSULE, Shape::CAPSULE> {
+    static void Run(const CollisionShapeArrays& s, CollisionPairBatch& batch) {
+        const auto& capsule = s.capsules;
+        for (std::size_t i = 0; i < batch.a.size(); ++i) {
+            std::uint32_t a = batch.a[i], b = batch.b[i];
+            float gap = GapSquared(capsule.left[a], capsule.top[a], capsule.right[a], capsule.bottom[a],
+                                   capsule.left[b], capsule.top[b], capsule.right[b], capsule.bottom[b]);
+            float reach = capsule.radius[a] + capsule.radius[b];
+            batch.hit[i] = gap < reach * reach;
+        }
+    }
+};
+
+using PairTestFunction = void (*)(const CollisionShapeArrays&, CollisionPairBatch&);
+
+/// Batch runner per pair kind, fixed at compile time (indexed by PairKind)
+constexpr PairTestFunction PAIR_TESTS[PAIR_KIND_COUNT] = {
+    &PairTest<Shape::BOX, Shape::BOX>::Run,
+    &PairTest<Shape::BOX, Shape::CIRCLE>::Run,
+    &PairTest<Shape::BOX, Shape::CAPSULE>::Run,
+    &PairTest<Shape::CIRCLE, Shape::CIRCLE>::Run,
+    &PairTest<Shape::CIRCLE, Shape::CAPSULE>::Run,
+    &PairTest<Shape::CAPSULE, Shape::CAPSULE>::Run,
+};
+
+static_assert(PairKind(Shape::BOX, Shape::BOX) == 0, "pair kind layout");
+static_assert(PairKind(Shape::BOX, Shape::CAPSULE) == 2, "pair kind layout");
+static_assert(PairKind(Shape::CIRCLE, Shape::CIRCLE) == 3, "pair kind layout");
+static_assert(PairKind(Shape::CAPSULE, Shape::CAPSULE) == PAIR_KIND_COUNT - 1, "pair kind layout");
+
+} // namespace CollisionShapes
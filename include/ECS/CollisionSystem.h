@@ -10,7 +10,11 @@
 #include "System.h"
 #include "EntityManager.h"
 #include "Component.h"
-#include <functional>
+#include "CollisionShapes.h"
+#include "Engine/InplaceFunction.h"
+#include <cstdint>
+#include <vector>
+#include <utility>
 
 /**
  * @struct CollisionInfo
@@ -35,7 +39,9 @@ struct CollisionInfo {
  * CollisionComponent.
  *
  * Features:
- * - AABB collision detection
+ * - AABB broad phase, then a box, circle or capsule narrow phase per shape
+ *   pair, each pair combination tested as one batch (see CollisionShapes.h)
+ * - Optional pixel-precise narrow phase for entities with a CollisionMaskComponent
  * - Collision callbacks for custom response handling
  * - Support for trigger colliders (detection without physics response)
  * - Efficient pairwise collision checking
@@ -57,8 +63,28 @@ struct CollisionInfo {
  */
 class CollisionSystem : public System {
 public:
-    /// Type alias for collision callback functions
-    using CollisionCallback = std::function<void(const CollisionInfo&)>;
+    /// Type alias for collision callback functions (inline storage, never allocates)
+    using CollisionCallback = InplaceFunction<void(const CollisionInfo&)>;
+
+    /// Entity query and further component access (used by SystemPipeline scheduling).
+    /// The collision callback runs game code, which may change anything.
+    using Required = ComponentList<TransformComponent, CollisionComponent>;
+    using Excluded = ComponentList<DormantTag>;
+    using Reads = ComponentList<CollisionMaskComponent>;
+    using Writes = ComponentList<AnyComponent>;
+
+    /// Overlap required on both axes for two boxes when neither has a pixel mask
+    static constexpr float MIN_OVERLAP = 4.0f;
+
+    /**
+     * @brief Constructor - declares the Transform + Collision requirement
+     *
+     * Dormant ballistic entities (outside the active region) are left out.
+     */
+    CollisionSystem() {
+        Require(Required{});
+        Exclude(Excluded{});
+    }
 
     /**
      * @brief Check for collisions between all entities
@@ -72,6 +98,7 @@ public:
      * @note Uses O(n²) algorithm - consider spatial partitioning for large numbers of entities
      */
     void Update(float deltaTime) override;
+    const char* GetName() const override { return "CollisionSystem"; }
 
     /**
      * @brief Set callback function for collision events
@@ -90,35 +117,47 @@ public:
      * ```
      */
     void SetCollisionCallback(CollisionCallback callback) {
-        m_collisionCallback = callback;
+        m_collisionCallback = std::move(callback);
     }
 
 private:
+    /// Pair whose bounding boxes overlap, found by the broad phase
+    struct Candidate {
+        std::uint32_t a;  ///< Index into m_frameEntities
+        std::uint32_t b;  ///< Index into m_frameEntities (a < b)
+        float overlapX;   ///< Bounding box overlap on X
+        float overlapY;   ///< Bounding box overlap on Y
+        bool hit;         ///< Passed the shape narrow phase
+    };
+
     CollisionCallback m_collisionCallback; ///< Callback function for collision events
+    std::vector<Entity> m_frameEntities;   ///< Per-frame snapshot (reused to avoid allocation)
 
-    /**
-     * @brief Check collision between two specific entities
-     *
-     * @param entityA First entity to check
-     * @param entityB Second entity to check
-     */
-    void CheckCollision(Entity entityA, Entity entityB);
+    // Per-frame data parallel to m_frameEntities
+    std::vector<float> m_left, m_top, m_right, m_bottom;   ///< Bounding boxes
+    std::vector<CollisionComponent::Shape> m_shapes;
+    std::vector<std::uint32_t> m_shapeSlots;               ///< Slot in m_shapeArrays
+    std::vector<std::uint8_t> m_masked;                    ///< Has a pixel mask
+
+    CollisionShapeArrays m_shapeArrays;
+    CollisionPairBatch m_batches[CollisionShapes::PAIR_KIND_COUNT];
+    std::vector<Candidate> m_candidates;
+
+    void GatherShapes();
+    void FindCandidates();
+    void RunNarrowPhase();
+    void ReportCollision(const Candidate& candidate);
 
     /**
-     * @brief Axis-Aligned Bounding Box collision detection
+     * @brief Pixel-precise test for a pair whose boxes overlap
      *
-     * Performs AABB collision detection between two entities and calculates
-     * the amount of overlap if a collision occurs.
+     * A mask is tested against the other entity's mask, or against its
+     * collision box if it has none.
      *
-     * @param transformA Transform component of first entity
-     * @param collisionA Collision component of first entity
-     * @param transformB Transform component of second entity
-     * @param collisionB Collision component of second entity
-     * @param overlapX Output parameter for X-axis overlap amount
-     * @param overlapY Output parameter for Y-axis overlap amount
-     * @return true if collision detected, false otherwise
+     * @return true if the solid pixels touch
      */
-    bool AABB(const TransformComponent* transformA, const CollisionComponent* collisionA,
-              const TransformComponent* transformB, const CollisionComponent* collisionB,
-              float& overlapX, float& overlapY);
+    bool MasksOverlap(const TransformComponent* transformA, const CollisionComponent* collisionA,
+                      const CollisionMaskComponent* maskA,
+                      const TransformComponent* transformB, const CollisionComponent* collisionB,
+                      const CollisionMaskComponent* maskB) const;
 };
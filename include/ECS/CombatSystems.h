@@ -11,9 +11,10 @@
 #include "EntityManager.h"
 #include "Component.h"
 #include "Game/GameConfig.h"
-#include <functional>
+#include "Engine/InplaceFunction.h"
 #include <vector>
 #include <memory>
+#include <utility>
 
 /**
  * @struct CombatEvent
@@ -44,12 +45,13 @@ struct CombatEvent {
  */
 class TurnManagementSystem : public System {
 public:
-    using CombatEventCallback = std::function<void(const CombatEvent&)>;
+    using CombatEventCallback = InplaceFunction<void(const CombatEvent&)>;
     
     TurnManagementSystem(GameConfig* config = nullptr) 
         : m_config(config), m_currentTurnIndex(0), m_roundNumber(1) {}
     
     void Update(float deltaTime) override;
+    const char* GetName() const override { return "TurnManagementSystem"; }
     
     /**
      * @brief Initialize combat with participants
@@ -79,7 +81,7 @@ public:
     /**
      * @brief Set callback for combat events
      */
-    void SetEventCallback(CombatEventCallback callback) { m_eventCallback = callback; }
+    void SetEventCallback(CombatEventCallback callback) { m_eventCallback = std::move(callback); }
     
     /**
      * @brief Get turn order list
@@ -103,11 +105,12 @@ private:
  */
 class CombatActionSystem : public System {
 public:
-    using CombatEventCallback = std::function<void(const CombatEvent&)>;
+    using CombatEventCallback = InplaceFunction<void(const CombatEvent&)>;
     
     CombatActionSystem(GameConfig* config = nullptr) : m_config(config) {}
     
     void Update(float deltaTime) override;
+    const char* GetName() const override { return "CombatActionSystem"; }
     
     /**
      * @brief Execute an attack action
@@ -137,7 +140,7 @@ public:
     /**
      * @brief Set callback for combat events
      */
-    void SetEventCallback(CombatEventCallback callback) { m_eventCallback = callback; }
+    void SetEventCallback(CombatEventCallback callback) { m_eventCallback = std::move(callback); }
 
 private:
     GameConfig* m_config;
@@ -159,6 +162,7 @@ public:
     CombatUISystem(GameConfig* config = nullptr) : m_config(config) {}
     
     void Update(float deltaTime) override;
+    const char* GetName() const override { return "CombatUISystem"; }
     
     /**
      * @brief Set the entities to display in combat UI
@@ -191,11 +195,12 @@ private:
  */
 class CombatResolutionSystem : public System {
 public:
-    using BattleEndCallback = std::function<void(bool playerWon, int experience, int gold)>;
+    using BattleEndCallback = InplaceFunction<void(bool playerWon, int experience, int gold)>;
     
     CombatResolutionSystem(GameConfig* config = nullptr) : m_config(config) {}
     
     void Update(float deltaTime) override;
+    const char* GetName() const override { return "CombatResolutionSystem"; }
     
     /**
      * @brief Check if battle should end
@@ -215,7 +220,7 @@ public:
     /**
      * @brief Set callback for battle end
      */
-    void SetBattleEndCallback(BattleEndCallback callback) { m_battleEndCallback = callback; }
+    void SetBattleEndCallback(BattleEndCallback callback) { m_battleEndCallback = std::move(callback); }
 
 private:
     GameConfig* m_config;
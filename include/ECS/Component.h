@@ -8,9 +8,12 @@
 #pragma once
 
 #include "Entity.h"
+#include "Reflection.h"
+#include "CollisionMask.h"
 #include <string>
 #include <cstring>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 /**
@@ -86,6 +89,17 @@ struct TransformComponent : public Component {
     TransformComponent(float posX, float posY, float rot) : Component(), x(posX), y(posY), rotation(rot) {}
 };
 
+template<> struct Reflect<TransformComponent> {
+    static void Describe(TypeBuilder<TransformComponent>& t) {
+        t.Name("TransformComponent")
+         .Field("x", &TransformComponent::x)
+         .Field("y", &TransformComponent::y)
+         .Field("rotation", &TransformComponent::rotation)
+         .Field("scaleX", &TransformComponent::scaleX)
+         .Field("scaleY", &TransformComponent::scaleY);
+    }
+};
+
 /**
  * @struct VelocityComponent
  * @brief Component that defines an entity's movement speed and direction
@@ -110,6 +124,40 @@ struct VelocityComponent : public Component {
     VelocityComponent(float velX, float velY) : Component(), vx(velX), vy(velY) {}
 };
 
+template<> struct Reflect<VelocityComponent> {
+    static void Describe(TypeBuilder<VelocityComponent>& t) {
+        t.Name("VelocityComponent")
+         .Field("vx", &VelocityComponent::vx)
+         .Field("vy", &VelocityComponent::vy);
+    }
+};
+
+/**
+ * @struct BallisticComponent
+ * @brief Opts a constant-velocity mover into closed-form (dormant) motion
+ *
+ * For entities nothing steers, bounces or pushes. While such an entity is
+ * outside BallisticSystem's active region it carries DormantTag, nothing
+ * integrates it, and its position is
+ * origin + VelocityComponent * (BallisticSystem time - startTime).
+ */
+struct BallisticComponent : public Component {
+    float originX = 0.0f;   ///< X position when the entity went dormant
+    float originY = 0.0f;   ///< Y position when the entity went dormant
+    float startTime = 0.0f; ///< BallisticSystem time when the entity went dormant
+
+    BallisticComponent() = default;
+};
+
+template<> struct Reflect<BallisticComponent> {
+    static void Describe(TypeBuilder<BallisticComponent>& t) {
+        t.Name("BallisticComponent")
+         .Field("originX", &BallisticComponent::originX)
+         .Field("originY", &BallisticComponent::originY)
+         .Field("startTime", &BallisticComponent::startTime);
+    }
+};
+
 /**
  * @struct RenderComponent
  * @brief Component that defines how an entity should be rendered
@@ -150,6 +198,19 @@ struct RenderComponent : public Component {
         : Component(), width(w), height(h), r(red), g(green), b(blue) {}
 };
 
+template<> struct Reflect<RenderComponent> {
+    static void Describe(TypeBuilder<RenderComponent>& t) {
+        t.Name("RenderComponent")
+         .Field("width", &RenderComponent::width)
+         .Field("height", &RenderComponent::height)
+         .Field("r", &RenderComponent::r)
+         .Field("g", &RenderComponent::g)
+         .Field("b", &RenderComponent::b)
+         .Field("a", &RenderComponent::a)
+         .Field("visible", &RenderComponent::visible);
+    }
+};
+
 /**
  * @struct SpriteComponent
  * @brief Component that defines sprite-based rendering for entities
@@ -220,17 +281,48 @@ struct SpriteComponent : public Component {
     }
 };
 
+template<> struct Reflect<SpriteComponent> {
+    static void Describe(TypeBuilder<SpriteComponent>& t) {
+        t.Name("SpriteComponent")
+         .Field("texturePath", &SpriteComponent::texturePath)
+         .Field("width", &SpriteComponent::width)
+         .Field("height", &SpriteComponent::height)
+         .Field("frameX", &SpriteComponent::frameX)
+         .Field("frameY", &SpriteComponent::frameY)
+         .Field("frameWidth", &SpriteComponent::frameWidth)
+         .Field("frameHeight", &SpriteComponent::frameHeight)
+         .Field("scaleX", &SpriteComponent::scaleX)
+         .Field("scaleY", &SpriteComponent::scaleY)
+         .Field("visible", &SpriteComponent::visible)
+         .Field("flipHorizontal", &SpriteComponent::flipHorizontal)
+         .Field("flipVertical", &SpriteComponent::flipVertical);
+    }
+};
+
 /**
  * @struct CollisionComponent
  * @brief Component that defines an entity's collision boundaries
  *
  * Used by CollisionSystem to detect when entities overlap.
  * Can be configured as a solid collider or a trigger.
+ *
+ * The width x height box is always the bounding box. Round shapes are
+ * inscribed in it: a CIRCLE has diameter min(width, height) and is centred
+ * in the box; a CAPSULE spans the whole box, rounded along its longer axis.
+ * PhysicsSystem resolves contacts on the box regardless of shape.
  */
 struct CollisionComponent : public Component {
+    /// Narrow-phase shape (fits inside the width x height box)
+    enum class Shape : unsigned char {
+        BOX,     ///< The box itself
+        CIRCLE,  ///< Circle inscribed in the box
+        CAPSULE  ///< Box with fully rounded ends along its longer axis
+    };
+
     float width = 32.0f;    ///< Collision box width
     float height = 32.0f;   ///< Collision box height
     bool isTrigger = false; ///< If true, collision is detected but no physics response
+    Shape shape = Shape::BOX; ///< Narrow-phase shape
 
     /**
      * @brief Default constructor - creates 32x32 solid collider
@@ -251,6 +343,131 @@ struct CollisionComponent : public Component {
      * @param trigger Whether this is a trigger collider
      */
     CollisionComponent(float w, float h, bool trigger) : Component(), width(w), height(h), isTrigger(trigger) {}
+
+    /**
+     * @brief Constructor with size and shape
+     * @param w Bounding box width
+     * @param h Bounding box height
+     * @param s Shape inscribed in the box
+     */
+    CollisionComponent(float w, float h, Shape s) : Component(), width(w), height(h), shape(s) {}
+
+    /**
+     * @brief Parse a shape name from config ("box", "circle", "capsule")
+     * @return The named shape, or BOX for anything else
+     */
+    static Shape ShapeFromName(const std::string& name) {
+        if (name == "circle") return Shape::CIRCLE;
+        if (name == "capsule") return Shape::CAPSULE;
+        return Shape::BOX;
+    }
+};
+
+template<> struct Reflect<CollisionComponent> {
+    static void Describe(TypeBuilder<CollisionComponent>& t) {
+        t.Name("CollisionComponent")
+         .Field("width", &CollisionComponent::width)
+         .Field("height", &CollisionComponent::height)
+         .Field("isTrigger", &CollisionComponent::isTrigger)
+         .Field("shape", &CollisionComponent::shape);
+    }
+};
+
+/**
+ * @struct RigidBodyComponent
+ * @brief Mass and surface properties for PhysicsSystem contact resolution
+ *
+ * Needs TransformComponent, VelocityComponent and a solid CollisionComponent
+ * (the box the solver pushes apart). An inverse mass of 0 makes the body
+ * immovable (platforms, walls, floors).
+ */
+struct RigidBodyComponent : public Component {
+    float inverseMass = 1.0f;   ///< 1 / mass; 0 = static
+    float restitution = 0.0f;   ///< Bounciness (0 = none, 1 = perfectly elastic)
+    float friction = 0.5f;      ///< Coulomb friction coefficient
+    float gravityScale = 1.0f;  ///< Multiplier on PhysicsSystem gravity
+    float restTime = 0.0f;      ///< Seconds spent below the sleep speed (managed by PhysicsSystem)
+    int island = 0;             ///< Island the body fell asleep with (managed by PhysicsSystem)
+
+    /**
+     * @brief Default constructor - dynamic body of mass 1
+     */
+    RigidBodyComponent() = default;
+
+    /**
+     * @brief Constructor with mass
+     * @param mass Body mass (0 or less makes the body static)
+     * @param bounce Restitution
+     * @param surfaceFriction Friction coefficient
+     */
+    RigidBodyComponent(float mass, float bounce = 0.0f, float surfaceFriction = 0.5f)
+        : Component(), inverseMass(mass > 0.0f ? 1.0f / mass : 0.0f),
+          restitution(bounce), friction(surfaceFriction) {}
+
+    /// Whether the body never moves
+    bool IsStatic() const { return inverseMass == 0.0f; }
+};
+
+template<> struct Reflect<RigidBodyComponent> {
+    static void Describe(TypeBuilder<RigidBodyComponent>& t) {
+        t.Name("RigidBodyComponent")
+         .Field("inverseMass", &RigidBodyComponent::inverseMass)
+         .Field("restitution", &RigidBodyComponent::restitution)
+         .Field("friction", &RigidBodyComponent::friction)
+         .Field("gravityScale", &RigidBodyComponent::gravityScale)
+         .Field("restTime", &RigidBodyComponent::restTime, FIELD_TRANSIENT | FIELD_READ_ONLY)
+         .Field("island", &RigidBodyComponent::island, FIELD_TRANSIENT | FIELD_READ_ONLY);
+    }
+};
+
+/**
+ * @struct CollisionMaskComponent
+ * @brief Pixel-precise shape used by CollisionSystem after the box test passes
+ *
+ * Holds one mask per animation frame (shared between every entity using the
+ * same sprite sheet). The mask's top-left pixel sits at the transform plus
+ * the offset, one mask pixel per world unit. The CollisionComponent box stays
+ * the broad phase, so size it to cover the mask.
+ *
+ * @example
+ * ```cpp
+ * auto masks = SpriteRenderer::LoadCollisionMasks("hero.png", frames, 4.0f);
+ * entityManager.AddComponent<CollisionMaskComponent>(player, masks);
+ * ```
+ */
+struct CollisionMaskComponent : public Component {
+    std::shared_ptr<const std::vector<CollisionMask>> frames; ///< Mask per animation frame
+    int frame = 0;               ///< Frame currently shown
+    bool flipHorizontal = false; ///< Sprite drawn mirrored
+    float offsetX = 0.0f;        ///< Mask left edge relative to the transform
+    float offsetY = 0.0f;        ///< Mask top edge relative to the transform
+
+    CollisionMaskComponent() = default;
+
+    /**
+     * @brief Constructor with the frame masks
+     * @param masks Mask per animation frame
+     */
+    explicit CollisionMaskComponent(std::shared_ptr<const std::vector<CollisionMask>> masks)
+        : Component(), frames(std::move(masks)) {}
+
+    /// Mask of the current frame, or nullptr if there is none
+    const CollisionMask* Current() const {
+        if (!frames || frame < 0 || frame >= static_cast<int>(frames->size())) {
+            return nullptr;
+        }
+        return &(*frames)[frame];
+    }
+};
+
+template<> struct Reflect<CollisionMaskComponent> {
+    static void Describe(TypeBuilder<CollisionMaskComponent>& t) {
+        t.Name("CollisionMaskComponent")
+         .Field("frame", &CollisionMaskComponent::frame)
+         .Field("flipHorizontal", &CollisionMaskComponent::flipHorizontal)
+         .Field("offsetX", &CollisionMaskComponent::offsetX)
+         .Field("offsetY", &CollisionMaskComponent::offsetY);
+    }
 };
 
 /**
@@ -302,6 +519,22 @@ struct AudioComponent : public Component {
         : Component(), soundName(sound), volume(vol), looping(loop), playOnCreate(onCreate), playOnCollision(onCollision) {}
 };
 
+template<> struct Reflect<AudioComponent> {
+    static void Describe(TypeBuilder<AudioComponent>& t) {
+        t.Name("AudioComponent")
+         .Field("soundName", &AudioComponent::soundName)
+         .Field("volume", &AudioComponent::volume)
+         .Field("pitch", &AudioComponent::pitch)
+         .Field("looping", &AudioComponent::looping)
+         .Field("playOnCreate", &AudioComponent::playOnCreate)
+         .Field("playOnCollision", &AudioComponent::playOnCollision)
+         .Field("playOnDestroy", &AudioComponent::playOnDestroy)
+         .Field("is3D", &AudioComponent::is3D)
+         .Field("maxDistance", &AudioComponent::maxDistance)
+         .Field("currentChannel", &AudioComponent::currentChannel, FIELD_TRANSIENT | FIELD_READ_ONLY);
+    }
+};
+
 /**
  * @struct HealthComponent
  * @brief Component that defines an entity's health and defensive properties
@@ -318,6 +551,17 @@ struct HealthComponent : public Component {
         : Component(), maxHealth(maxHp), currentHealth(maxHp), armor(armorVal), healthRegen(regen) {}
 };
 
+template<> struct Reflect<HealthComponent> {
+    static void Describe(TypeBuilder<HealthComponent>& t) {
+        t.Name("HealthComponent")
+         .Field("maxHealth", &HealthComponent::maxHealth)
+         .Field("currentHealth", &HealthComponent::currentHealth)
+         .Field("armor", &HealthComponent::armor)
+         .Field("healthRegen", &HealthComponent::healthRegen)
+         .Field("isDead", &HealthComponent::isDead);
+    }
+};
+
 /**
  * @struct CharacterTypeComponent
  * @brief Component that defines what type of character an entity is
@@ -355,6 +599,16 @@ struct CharacterTypeComponent : public Component {
         : Component(), type(t), characterClass(c), name(n) {}
 };
 
+template<> struct Reflect<CharacterTypeComponent> {
+    static void Describe(TypeBuilder<CharacterTypeComponent>& t) {
+        t.Name("CharacterTypeComponent")
+         .Field("type", &CharacterTypeComponent::type)
+         .Field("characterClass", &CharacterTypeComponent::characterClass)
+         .Field("name", &CharacterTypeComponent::name)
+         .Field("jobId", &CharacterTypeComponent::jobId);
+    }
+};
+
 /**
  * @struct CharacterStatsComponent
  * @brief Component that defines character attributes and stats
@@ -385,6 +639,20 @@ struct CharacterStatsComponent : public Component {
     }
 };
 
+template<> struct Reflect<CharacterStatsComponent> {
+    static void Describe(TypeBuilder<CharacterStatsComponent>& t) {
+        t.Name("CharacterStatsComponent")
+         .Field("strength", &CharacterStatsComponent::strength)
+         .Field("agility", &CharacterStatsComponent::agility)
+         .Field("intelligence", &CharacterStatsComponent::intelligence)
+         .Field("vitality", &CharacterStatsComponent::vitality)
+         .Field("mana", &CharacterStatsComponent::mana)
+         .Field("maxMana", &CharacterStatsComponent::maxMana)
+         .Field("stamina", &CharacterStatsComponent::stamina)
+         .Field("maxStamina", &CharacterStatsComponent::maxStamina);
+    }
+};
+
 /**
  * @struct AIComponent
  * @brief Component that defines AI behavior for entities
@@ -401,7 +669,9 @@ struct AIComponent : public Component {
     };
 
     struct PatrolPoint {
-        float x, y;
+        float x = 0.0f;
+        float y = 0.0f;
+        PatrolPoint() = default;
         PatrolPoint(float px, float py) : x(px), y(py) {}
     };
 
@@ -413,7 +683,7 @@ struct AIComponent : public Component {
     bool aggressive = true;          ///< Whether to attack on sight
     bool canFlee = false;            ///< Whether can flee when low health
     bool returnsToPatrol = true;     ///< Whether to return to patrol after losing target
-    Entity target;                   ///< Current target entity
+    Entity target;                   ///< Current target (AISystem mirrors the Relation::TARGETS link)
 
     // Patrol system
     std::vector<PatrolPoint> patrolPoints;
@@ -440,6 +710,126 @@ struct AIComponent : public Component {
     }
 };
 
+template<> struct Reflect<AIComponent::PatrolPoint> {
+    static void Describe(TypeBuilder<AIComponent::PatrolPoint>& t) {
+        t.Name("AIComponent::PatrolPoint")
+         .Field("x", &AIComponent::PatrolPoint::x)
+         .Field("y", &AIComponent::PatrolPoint::y);
+    }
+};
+
+template<> struct Reflect<AIComponent> {
+    static void Describe(TypeBuilder<AIComponent>& t) {
+        t.Name("AIComponent")
+         .Field("currentState", &AIComponent::currentState)
+         .Field("detectionRange", &AIComponent::detectionRange)
+         .Field("attackRange", &AIComponent::attackRange)
+         .Field("patrolSpeed", &AIComponent::patrolSpeed)
+         .Field("chaseSpeed", &AIComponent::chaseSpeed)
+         .Field("aggressive", &AIComponent::aggressive)
+         .Field("canFlee", &AIComponent::canFlee)
+         .Field("returnsToPatrol", &AIComponent::returnsToPatrol)
+         .Field("target", &AIComponent::target)
+         .Field("patrolPoints", &AIComponent::patrolPoints)
+         .Field("currentPatrolIndex", &AIComponent::currentPatrolIndex)
+         .Field("stateTimer", &AIComponent::stateTimer);
+    }
+};
+
+/**
+ * @struct SteeringComponent
+ * @brief Flocking and steering parameters for SteeringSystem
+ *
+ * Each behaviour produces a desired velocity; the weighted sum of
+ * (desired - current) is clamped to maxForce and applied to the entity's
+ * VelocityComponent. A weight of 0 disables a behaviour. Only agents of the
+ * same flock separate, align and cohere with each other.
+ */
+struct SteeringComponent : public Component {
+    float maxSpeed = 80.0f;           ///< Speed limit (units/s)
+    float maxForce = 200.0f;          ///< Steering acceleration limit (units/s^2)
+    float neighborRadius = 48.0f;     ///< Range for alignment and cohesion
+    float separationRadius = 20.0f;   ///< Range for separation
+    float separationWeight = 1.5f;
+    float alignmentWeight = 1.0f;
+    float cohesionWeight = 1.0f;
+    float seekWeight = 0.0f;          ///< Seek seekTarget if valid, else (seekX, seekY)
+    float avoidWeight = 2.0f;         ///< Steer around SteeringSystem obstacles
+    float seekX = 0.0f;
+    float seekY = 0.0f;
+    Entity seekTarget;                ///< Entity to seek (overrides seekX/seekY)
+    int flock = 0;                    ///< Flock id
+
+    SteeringComponent() = default;
+
+    /**
+     * @brief Constructor with speed and flock
+     * @param speed Speed limit
+     * @param flockId Flock id
+     */
+    SteeringComponent(float speed, int flockId = 0) : Component(), maxSpeed(speed), flock(flockId) {}
+};
+
+template<> struct Reflect<SteeringComponent> {
+    static void Describe(TypeBuilder<SteeringComponent>& t) {
+        t.Name("SteeringComponent")
+         .Field("maxSpeed", &SteeringComponent::maxSpeed)
+         .Field("maxForce", &SteeringComponent::maxForce)
+         .Field("neighborRadius", &SteeringComponent::neighborRadius)
+         .Field("separationRadius", &SteeringComponent::separationRadius)
+         .Field("separationWeight", &SteeringComponent::separationWeight)
+         .Field("alignmentWeight", &SteeringComponent::alignmentWeight)
+         .Field("cohesionWeight", &SteeringComponent::cohesionWeight)
+         .Field("seekWeight", &SteeringComponent::seekWeight)
+         .Field("avoidWeight", &SteeringComponent::avoidWeight)
+         .Field("seekX", &SteeringComponent::seekX)
+         .Field("seekY", &SteeringComponent::seekY)
+         .Field("seekTarget", &SteeringComponent::seekTarget)
+         .Field("flock", &SteeringComponent::flock);
+    }
+};
+
+/**
+ * @struct InfluenceSourceComponent
+ * @brief Makes an entity contribute to one of InfluenceSystem's maps
+ *
+ * The entity adds strength * (1 - distance / radius) around its position to
+ * the chosen layer. Changing any field takes effect on the next update.
+ */
+struct InfluenceSourceComponent : public Component {
+    /// Which map the entity contributes to
+    enum class Layer : unsigned char {
+        THREAT,   ///< Danger posed by the player side
+        ALLIES,   ///< Density of friendly (enemy-side) units
+        DANGER,   ///< Hazards: projectiles, traps, explosions
+        COUNT
+    };
+
+    Layer layer = Layer::THREAT;
+    float strength = 1.0f;      ///< Influence at the entity's own cell
+    float radius = 128.0f;      ///< Distance at which the influence fades to zero
+
+    InfluenceSourceComponent() = default;
+
+    /**
+     * @brief Constructor with layer and falloff
+     * @param sourceLayer Map to contribute to
+     * @param sourceStrength Influence at the entity's cell
+     * @param sourceRadius Falloff radius
+     */
+    InfluenceSourceComponent(Layer sourceLayer, float sourceStrength, float sourceRadius)
+        : Component(), layer(sourceLayer), strength(sourceStrength), radius(sourceRadius) {}
+};
+
+template<> struct Reflect<InfluenceSourceComponent> {
+    static void Describe(TypeBuilder<InfluenceSourceComponent>& t) {
+        t.Name("InfluenceSourceComponent")
+         .Field("layer", &InfluenceSourceComponent::layer)
+         .Field("strength", &InfluenceSourceComponent::strength)
+         .Field("radius", &InfluenceSourceComponent::radius);
+    }
+};
+
 /**
  * @struct CombatStatsComponent
  * @brief Component that defines combat-specific statistics
@@ -459,6 +849,20 @@ struct CombatStatsComponent : public Component {
         : Component(), attackPower(atk), defense(def), speed(spd) {}
 };
 
+template<> struct Reflect<CombatStatsComponent> {
+    static void Describe(TypeBuilder<CombatStatsComponent>& t) {
+        t.Name("CombatStatsComponent")
+         .Field("attackPower", &CombatStatsComponent::attackPower)
+         .Field("defense", &CombatStatsComponent::defense)
+         .Field("magicPower", &CombatStatsComponent::magicPower)
+         .Field("magicDefense", &CombatStatsComponent::magicDefense)
+         .Field("speed", &CombatStatsComponent::speed)
+         .Field("accuracy", &CombatStatsComponent::accuracy)
+         .Field("criticalChance", &CombatStatsComponent::criticalChance)
+         .Field("criticalMultiplier", &CombatStatsComponent::criticalMultiplier);
+    }
+};
+
 /**
  * @struct CombatActionComponent
  * @brief Component that defines available combat actions for an entity
@@ -476,13 +880,14 @@ struct CombatActionComponent : public Component {
     };
 
     struct CombatAction {
-        ActionType type;
+        ActionType type = ActionType::ATTACK;
         std::string name;
         float mpCost = 0.0f;
         float power = 1.0f;
         bool targetsSelf = false;
         bool targetsAll = false;
 
+        CombatAction() = default;
         CombatAction(ActionType t, const std::string& n, float cost = 0.0f, float pow = 1.0f)
             : type(t), name(n), mpCost(cost), power(pow) {}
     };
@@ -497,6 +902,26 @@ struct CombatActionComponent : public Component {
     }
 };
 
+template<> struct Reflect<CombatActionComponent::CombatAction> {
+    static void Describe(TypeBuilder<CombatActionComponent::CombatAction>& t) {
+        t.Name("CombatActionComponent::CombatAction")
+         .Field("type", &CombatActionComponent::CombatAction::type)
+         .Field("name", &CombatActionComponent::CombatAction::name)
+         .Field("mpCost", &CombatActionComponent::CombatAction::mpCost)
+         .Field("power", &CombatActionComponent::CombatAction::power)
+         .Field("targetsSelf", &CombatActionComponent::CombatAction::targetsSelf)
+         .Field("targetsAll", &CombatActionComponent::CombatAction::targetsAll);
+    }
+};
+
+template<> struct Reflect<CombatActionComponent> {
+    static void Describe(TypeBuilder<CombatActionComponent>& t) {
+        t.Name("CombatActionComponent")
+         .Field("availableActions", &CombatActionComponent::availableActions)
+         .Field("selectedActionIndex", &CombatActionComponent::selectedActionIndex);
+    }
+};
+
 /**
  * @struct TurnOrderComponent
  * @brief Component that manages turn-based combat order
@@ -523,6 +948,18 @@ struct TurnOrderComponent : public Component {
     }
 };
 
+template<> struct Reflect<TurnOrderComponent> {
+    static void Describe(TypeBuilder<TurnOrderComponent>& t) {
+        t.Name("TurnOrderComponent")
+         .Field("initiative", &TurnOrderComponent::initiative)
+         .Field("currentInitiative", &TurnOrderComponent::currentInitiative)
+         .Field("turnOrder", &TurnOrderComponent::turnOrder)
+         .Field("hasTakenTurn", &TurnOrderComponent::hasTakenTurn)
+         .Field("isDefending", &TurnOrderComponent::isDefending)
+         .Field("defenseBonus", &TurnOrderComponent::defenseBonus);
+    }
+};
+
 /**
  * @struct BattleParticipantComponent
  * @brief Component that marks entities as participants in current battle
@@ -546,6 +983,17 @@ struct BattleParticipantComponent : public Component {
         : Component(), type(t), battlePosition(pos) {}
 };
 
+template<> struct Reflect<BattleParticipantComponent> {
+    static void Describe(TypeBuilder<BattleParticipantComponent>& t) {
+        t.Name("BattleParticipantComponent")
+         .Field("type", &BattleParticipantComponent::type)
+         .Field("isAlive", &BattleParticipantComponent::isAlive)
+         .Field("canAct", &BattleParticipantComponent::canAct)
+         .Field("battlePosition", &BattleParticipantComponent::battlePosition)
+         .Field("originalEntity", &BattleParticipantComponent::originalEntity);
+    }
+};
+
 /**
  * @struct AbilityComponent
  * @brief Component that defines special abilities for entities
@@ -618,4 +1066,68 @@ struct AbilityComponent : public Component {
     }
 };
 
+template<> struct Reflect<AbilityComponent::Ability> {
+    static void Describe(TypeBuilder<AbilityComponent::Ability>& t) {
+        t.Name("AbilityComponent::Ability")
+         .Field("name", &AbilityComponent::Ability::name)
+         .Field("cooldown", &AbilityComponent::Ability::cooldown)
+         .Field("currentCooldown", &AbilityComponent::Ability::currentCooldown)
+         .Field("manaCost", &AbilityComponent::Ability::manaCost)
+         .Field("staminaCost", &AbilityComponent::Ability::staminaCost)
+         .Field("damage", &AbilityComponent::Ability::damage)
+         .Field("range", &AbilityComponent::Ability::range)
+         .Field("isActive", &AbilityComponent::Ability::isActive);
+    }
+};
+
+template<> struct Reflect<AbilityComponent> {
+    static void Describe(TypeBuilder<AbilityComponent>& t) {
+        t.Name("AbilityComponent")
+         .Field("abilities", &AbilityComponent::abilities);
+    }
+};
+
+/**
+ * @name Tag components
+ * @brief Empty markers that cost only a signature bit (see EntityManager::AddTag())
+ * @{
+ */
+
+/// Marks the player-controlled character
+struct PlayerTag {};
+
+template<> struct Reflect<PlayerTag> {
+    static void Describe(TypeBuilder<PlayerTag>& t) { t.Name("PlayerTag"); }
+};
+
+/// Marks hostile characters (bosses carry it too)
+struct EnemyTag {};
+
+template<> struct Reflect<EnemyTag> {
+    static void Describe(TypeBuilder<EnemyTag>& t) { t.Name("EnemyTag"); }
+};
+
+/// Marks boss characters
+struct BossTag {};
+
+template<> struct Reflect<BossTag> {
+    static void Describe(TypeBuilder<BossTag>& t) { t.Name("BossTag"); }
+};
+
+/// Marks ballistic movers parked outside the active region (see BallisticSystem)
+struct DormantTag {};
+
+template<> struct Reflect<DormantTag> {
+    static void Describe(TypeBuilder<DormantTag>& t) { t.Name("DormantTag"); }
+};
+
+/// Marks rigid bodies whose island is asleep (see PhysicsSystem)
+struct SleepingTag {};
+
+template<> struct Reflect<SleepingTag> {
+    static void Describe(TypeBuilder<SleepingTag>& t) { t.Name("SleepingTag"); }
+};
+
+/** @} */
+
 /** @} */ // end of Components group
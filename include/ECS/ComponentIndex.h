@@ -0,0 +1,115 @@
+/**
+ * @file ComponentIndex.h
+ * @brief Entities partitioned by the value of one small enum component field
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include "Entity.h"
+#include "SparseSet.h"
+#include <array>
+#include <iostream>
+#include <type_traits>
+
+struct Component;
+
+/**
+ * @class ComponentIndexBase
+ * @brief Type-erased interface EntityManager uses to keep an index current
+ */
+class ComponentIndexBase {
+public:
+    virtual ~ComponentIndexBase() = default;
+
+    /// Place an entity in the bucket for its component's current value
+    virtual void Insert(Entity entity, const Component& component) = 0;
+
+    /// Remove an entity from whichever bucket holds it
+    virtual void Erase(Entity entity) = 0;
+
+    /// Move an entity to the bucket for its component's new value
+    virtual void Update(Entity entity, const Component& component) = 0;
+};
+
+/**
+ * @class ComponentIndex
+ * @brief One SparseSet of entities per value of `T::*field`
+ *
+ * Meant for small enums (character type, AI state, battle side): each value
+ * is a bucket index, so lookups are a single array access and returning a
+ * bucket never allocates. Buckets never move, so a returned set can be kept
+ * and will follow later changes. Values must lie in [0, MAX_VALUES).
+ *
+ * @tparam T Component type
+ * @tparam Key Enum or integer field type
+ */
+template<typename T, typename Key>
+class ComponentIndex : public ComponentIndexBase {
+    static_assert(std::is_enum_v<Key> || std::is_integral_v<Key>,
+                  "Only enum and integer fields can be indexed");
+
+public:
+    /// Largest number of distinct values an index partitions into
+    static constexpr std::size_t MAX_VALUES = 64;
+
+    explicit ComponentIndex(Key T::*field) : m_field(field) {}
+
+    /// Field this index partitions by
+    Key T::*GetField() const { return m_field; }
+
+    /**
+     * @brief Entities whose field currently equals value
+     * @return Bucket (empty set for values no entity has)
+     */
+    const SparseSet& Get(Key value) const {
+        std::size_t bucket = BucketIndex(value);
+        return bucket < MAX_VALUES ? m_buckets[bucket] : EmptyBucket();
+    }
+
+    void Insert(Entity entity, const Component& component) override {
+        std::size_t bucket = BucketIndex(static_cast<const T&>(component).*m_field);
+        if (bucket >= MAX_VALUES) {
+            std::cerr << "⚠️  ComponentIndex: value " << bucket << " of entity " << entity.GetID()
+                      << " is out of range; entity not indexed" << std::endl;
+            return;
+        }
+        m_buckets[bucket].Insert(entity);
+    }
+
+    void Erase(Entity entity) override {
+        for (SparseSet& bucket : m_buckets) {
+            if (bucket.Erase(entity)) {
+                return;
+            }
+        }
+    }
+
+    void Update(Entity entity, const Component& component) override {
+        // Unchanged value: keep the entity's position in its bucket
+        std::size_t bucket = BucketIndex(static_cast<const T&>(component).*m_field);
+        if (bucket < MAX_VALUES && m_buckets[bucket].Contains(entity)) {
+            return;
+        }
+        Erase(entity);
+        Insert(entity, component);
+    }
+
+private:
+    Key T::*m_field;
+    std::array<SparseSet, MAX_VALUES> m_buckets; ///< Value -> entities with that value
+
+    static std::size_t BucketIndex(Key value) {
+        if constexpr (std::is_enum_v<Key>) {
+            return static_cast<std::size_t>(static_cast<std::underlying_type_t<Key>>(value));
+        } else {
+            return static_cast<std::size_t>(value);
+        }
+    }
+
+    static const SparseSet& EmptyBucket() {
+        static const SparseSet empty;
+        return empty;
+    }
+};
@@ -0,0 +1,55 @@
+/**
+ * @file ComponentObserver.h
+ * @brief Per-component-type structural change observers
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include "Entity.h"
+#include "Engine/InplaceFunction.h"
+#include <cstdint>
+
+/**
+ * @enum ComponentEvent
+ * @brief Kind of structural change an observer listens for
+ */
+enum class ComponentEvent {
+    ADDED,    ///< Component attached to an entity (not fired on replacement)
+    REMOVED,  ///< Component detached, or its entity destroyed
+    CHANGED   ///< Component replaced or explicitly marked changed
+};
+
+/**
+ * @enum ObserverDelivery
+ * @brief When an observer callback runs
+ */
+enum class ObserverDelivery {
+    IMMEDIATE, ///< Inside the AddComponent/RemoveComponent/MarkChanged call
+    DEFERRED   ///< Buffered until the next EntityManager::Update() sync point
+};
+
+/// Handle returned when registering an observer (0 is never issued)
+using ObserverID = std::uint32_t;
+
+/**
+ * @brief Observer callback signature
+ *
+ * Immediate REMOVED observers run before the component is erased, so it can
+ * still be read. Deferred REMOVED observers run after the fact and should only
+ * use the entity handle.
+ */
+using ComponentObserverCallback = InplaceFunction<void(Entity)>;
+
+/**
+ * @struct ComponentObserver
+ * @brief Registered observer entry (internal to EntityManager)
+ */
+struct ComponentObserver {
+    ObserverID id = 0;                  ///< Handle used for removal
+    ComponentEvent event = ComponentEvent::ADDED;
+    ObserverDelivery delivery = ObserverDelivery::IMMEDIATE;
+    ComponentObserverCallback callback; ///< Function to invoke
+    bool active = true;                 ///< Cleared by RemoveObserver (erased once no dispatch runs)
+};
@@ -0,0 +1,282 @@
+/**
+ * @file ComponentPool.h
+ * @brief Dense, chunked per-type component storage indexed by a SparseSet
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include "Entity.h"
+#include "SparseSet.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+struct Component;
+
+namespace detail {
+
+/**
+ * @brief Rearrange a sequence in place so slot i receives the element at order[i]
+ *
+ * Walks each permutation cycle with pairwise swaps, so it works for any
+ * storage that can swap two slots (component chunks, SparseSet::SwapAt).
+ *
+ * @param order Permutation of [0, order.size())
+ * @param swap Callable swapping two slots: swap(a, b)
+ */
+template<typename Swap>
+void ApplyPermutation(const std::vector<std::uint32_t>& order, Swap&& swap) {
+    std::vector<bool> placed(order.size(), false);
+    for (std::size_t start = 0; start < order.size(); ++start) {
+        if (placed[start]) {
+            continue;
+        }
+        std::size_t current = start;
+        while (true) {
+            placed[current] = true;
+            std::size_t next = order[current];
+            if (next == start) {
+                break;
+            }
+            swap(current, next);
+            current = next;
+        }
+    }
+}
+
+} // namespace detail
+
+/**
+ * @struct StorageStats
+ * @brief Memory component storage holds versus what its live data needs
+ *
+ * Pools stay dense (removal fills the hole with the last component), so the
+ * waste after churn is capacity: chunks kept from a peak, and sparse index
+ * entries for entity IDs long gone.
+ */
+struct StorageStats {
+    std::size_t liveComponents = 0;  ///< Components currently stored
+    std::size_t slotCapacity = 0;    ///< Component slots in allocated chunks
+    std::size_t usedBytes = 0;       ///< Bytes holding live components and their index entries
+    std::size_t reservedBytes = 0;   ///< Bytes allocated for components and indexes
+
+    /// Share of reserved bytes holding nothing live (0 = tight)
+    float GetFragmentation() const {
+        return reservedBytes > 0
+            ? 1.0f - static_cast<float>(usedBytes) / static_cast<float>(reservedBytes)
+            : 0.0f;
+    }
+
+    StorageStats& operator+=(const StorageStats& other) {
+        liveComponents += other.liveComponents;
+        slotCapacity += other.slotCapacity;
+        usedBytes += other.usedBytes;
+        reservedBytes += other.reservedBytes;
+        return *this;
+    }
+};
+
+/**
+ * @class ComponentPoolBase
+ * @brief Type-erased view of one component type's storage
+ *
+ * Slot i of the storage belongs to GetEntities()[i]; the SparseSet maps an
+ * entity to its slot in O(1), so handles stay valid while slots move.
+ */
+class ComponentPoolBase {
+public:
+    virtual ~ComponentPoolBase() = default;
+
+    /**
+     * @brief Destroy an entity's component (last slot moves into the hole)
+     * @return true if the entity had one
+     */
+    virtual bool Remove(Entity entity) = 0;
+
+    /// Component stored in a dense slot
+    virtual Component& At(std::size_t index) = 0;
+    virtual const Component& At(std::size_t index) const = 0;
+
+    /// Component of an entity, or nullptr
+    Component* Find(Entity entity) {
+        std::uint32_t index = m_entities.IndexOf(entity);
+        return index != SparseSet::NPOS ? &At(index) : nullptr;
+    }
+
+    const Component* Find(Entity entity) const {
+        std::uint32_t index = m_entities.IndexOf(entity);
+        return index != SparseSet::NPOS ? &At(index) : nullptr;
+    }
+
+    /// Owners in slot order
+    const SparseSet& GetEntities() const { return m_entities; }
+
+    std::size_t Size() const { return m_entities.Size(); }
+
+    /// Component slots in allocated chunks
+    virtual std::size_t GetCapacity() const = 0;
+
+    /// Bytes per component slot
+    virtual std::size_t GetSlotSize() const = 0;
+
+    /**
+     * @brief Free chunks and index memory no live component needs
+     *
+     * One spare chunk is kept past the last used one so a pool hovering at a
+     * chunk boundary does not free and reallocate every call.
+     *
+     * @return true if any memory was released
+     */
+    virtual bool ShrinkToFit() = 0;
+
+    /// Memory held versus needed by this pool
+    StorageStats GetStats() const {
+        StorageStats stats;
+        stats.liveComponents = Size();
+        stats.slotCapacity = GetCapacity();
+        stats.usedBytes = Size() * GetSlotSize() + m_entities.GetUsedBytes();
+        stats.reservedBytes = GetCapacity() * GetSlotSize() + m_entities.GetReservedBytes();
+        return stats;
+    }
+
+    /**
+     * @brief Reorder slots so slot i holds what slot order[i] held
+     *
+     * Entity handles are unaffected; component pointers into this pool are not.
+     */
+    void Permute(const std::vector<std::uint32_t>& order) {
+        detail::ApplyPermutation(order, [this](std::size_t a, std::size_t b) {
+            SwapSlots(a, b);
+            m_entities.SwapAt(a, b);
+        });
+    }
+
+protected:
+    SparseSet m_entities; ///< Entity -> slot, slot -> entity
+
+    virtual void SwapSlots(std::size_t a, std::size_t b) = 0;
+};
+
+/**
+ * @class ComponentPool
+ * @brief Components of type T packed in fixed-size chunks
+ *
+ * Chunks never move, so adding components never invalidates pointers to
+ * existing ones; ShrinkToFit() only frees chunks past the last live slot.
+ * Removing a component moves the last one into its slot, and Permute()
+ * moves everything: pointers are valid until the next removal or reorder
+ * of this type. Objects are destroyed as T, never through the non-virtual
+ * Component base.
+ *
+ * @tparam T Component type (movable)
+ */
+template<typename T>
+class ComponentPool : public ComponentPoolBase {
+public:
+    /// Components per chunk (contiguous run in memory)
+    static constexpr std::size_t CHUNK_SIZE = 256;
+
+    ComponentPool() = default;
+    ComponentPool(const ComponentPool&) = delete;
+    ComponentPool& operator=(const ComponentPool&) = delete;
+
+    ~ComponentPool() override {
+        for (std::size_t i = 0; i < Size(); ++i) {
+            Slot(i).~T();
+        }
+    }
+
+    /**
+     * @brief Construct T for an entity, or replace its existing T
+     * @return Stored component
+     */
+    template<typename... Args>
+    T* Emplace(Entity entity, Args&&... args) {
+        std::uint32_t index = m_entities.IndexOf(entity);
+        if (index != SparseSet::NPOS) {
+            T& existing = Slot(index);
+            existing = T(std::forward<Args>(args)...);
+            return &existing;
+        }
+
+        std::size_t slot = Size();
+        if (slot / CHUNK_SIZE >= m_chunks.size()) {
+            m_chunks.push_back(std::make_unique<Chunk>());
+        }
+        T* component = new (SlotAddress(slot)) T(std::forward<Args>(args)...);
+        m_entities.Insert(entity);
+        return component;
+    }
+
+    /// Component of an entity, or nullptr
+    T* Get(Entity entity) {
+        std::uint32_t index = m_entities.IndexOf(entity);
+        return index != SparseSet::NPOS ? &Slot(index) : nullptr;
+    }
+
+    bool Remove(Entity entity) override {
+        std::uint32_t index = m_entities.IndexOf(entity);
+        if (index == SparseSet::NPOS) {
+            return false;
+        }
+
+        // Mirror SparseSet::Erase: the last slot fills the hole
+        std::size_t last = Size() - 1;
+        if (index != last) {
+            Slot(index) = std::move(Slot(last));
+        }
+        Slot(last).~T();
+        m_entities.Erase(entity);
+        return true;
+    }
+
+    std::size_t GetCapacity() const override { return m_chunks.size() * CHUNK_SIZE; }
+
+    std::size_t GetSlotSize() const override { return sizeof(T); }
+
+    bool ShrinkToFit() override {
+        std::size_t keep = (Size() + CHUNK_SIZE - 1) / CHUNK_SIZE + 1;
+        bool released = false;
+        if (m_chunks.size() > keep) {
+            m_chunks.resize(keep);
+            m_chunks.shrink_to_fit();
+            released = true;
+        }
+        return m_entities.ShrinkToFit() || released;
+    }
+
+    Component& At(std::size_t index) override { return Slot(index); }
+    const Component& At(std::size_t index) const override { return Slot(index); }
+
+    /// Component in a dense slot (typed)
+    T& Slot(std::size_t index) {
+        return *std::launder(reinterpret_cast<T*>(SlotAddress(index)));
+    }
+
+    const T& Slot(std::size_t index) const {
+        return *std::launder(reinterpret_cast<const T*>(
+            m_chunks[index / CHUNK_SIZE]->bytes + (index % CHUNK_SIZE) * sizeof(T)));
+    }
+
+protected:
+    void SwapSlots(std::size_t a, std::size_t b) override {
+        using std::swap;
+        swap(Slot(a), Slot(b));
+    }
+
+private:
+    struct Chunk {
+        alignas(T) unsigned char bytes[sizeof(T) * CHUNK_SIZE];
+    };
+
+    std::vector<std::unique_ptr<Chunk>> m_chunks; ///< Allocated on demand, freed by ShrinkToFit()
+
+    unsigned char* SlotAddress(std::size_t index) {
+        return m_chunks[index / CHUNK_SIZE]->bytes + (index % CHUNK_SIZE) * sizeof(T);
+    }
+};
@@ -40,10 +40,16 @@
 #include "Component.h"
 #include "System.h"
 #include "EntityManager.h"
+#include "SystemPipeline.h"
 
 // Essential systems for arcade games
 #include "MovementSystem.h"
+#include "BallisticSystem.h"
 #include "CollisionSystem.h"
+#include "PhysicsSystem.h"
+#include "ProjectileSystem.h"
+#include "SteeringSystem.h"
+#include "InfluenceSystem.h"
 #include "AudioSystem.h"
 
 // Animation support
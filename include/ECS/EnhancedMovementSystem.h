@@ -21,6 +21,9 @@
  * - Physics constraints (gravity, friction, boundaries)
  * - Character stat integration
  * - Event-driven movement responses
+ *
+ * @note Bodies are integrated independently; for contacts between bodies
+ * (stacking, pushing) and sleeping at rest, use PhysicsSystem.
  */
 class EnhancedMovementSystem : public System {
 public:
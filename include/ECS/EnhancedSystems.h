@@ -9,7 +9,7 @@
 
 #include "System.h"
 #include "Component.h"
-#include <functional>
+#include "Engine/InplaceFunction.h"
 #include <queue>
 #include <unordered_map>
 
@@ -28,7 +28,7 @@ class AudioManager;
  */
 class HealthSystem : public System {
 public:
-    using DeathCallback = std::function<void(Entity)>;
+    using DeathCallback = InplaceFunction<void(Entity)>;
     
     HealthSystem() = default;
     
@@ -189,7 +189,7 @@ private:
  */
 class AbilitySystem : public System {
 public:
-    using AbilityCallback = std::function<void(Entity, int)>; // Entity, ability index
+    using AbilityCallback = InplaceFunction<void(Entity, int)>; // Entity, ability index
     
     void Update(float deltaTime) override {
         auto entities = m_entityManager->GetEntitiesWith<AbilityComponent>();
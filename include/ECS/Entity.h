@@ -8,12 +8,22 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
+#include <bitset>
+#include <type_traits>
+
+struct Component;
 
 /// Type alias for entity identifiers
 using EntityID = std::uint32_t;
 /// Type alias for component type identifiers
 using ComponentTypeID = std::uint32_t;
 
+/// Maximum number of distinct component types (one signature bit each)
+constexpr std::size_t MAX_COMPONENT_TYPES = 64;
+/// Bitmask of the component types attached to an entity (or required by a system)
+using Signature = std::bitset<MAX_COMPONENT_TYPES>;
+
 /**
  * @class Entity
  * @brief Lightweight entity handle for the ECS system
@@ -84,12 +94,26 @@ private:
     EntityID m_id; ///< Unique entity identifier
 };
 
+namespace detail {
+    /**
+     * @brief Shared counter backing GetComponentTypeID()
+     *
+     * Must be a single function (not part of the template) so every component
+     * type draws from the same sequence.
+     */
+    inline ComponentTypeID NextComponentTypeID() {
+        static ComponentTypeID counter = 0;
+        return counter++;
+    }
+}
+
 /**
  * @brief Generate unique component type IDs at compile time
  *
  * This template function generates a unique ComponentTypeID for each
  * component type T. The ID is generated once per type and cached
- * using static variables.
+ * using static variables. IDs are dense (0, 1, 2, ...) so they can be
+ * used directly as Signature bit positions.
  *
  * @tparam T The component type
  * @return Unique ComponentTypeID for type T
@@ -103,9 +127,16 @@ private:
  */
 template<typename T>
 ComponentTypeID GetComponentTypeID() {
-    static ComponentTypeID typeID = []() {
-        static ComponentTypeID counter = 0;
-        return ++counter;
-    }();
+    static const ComponentTypeID typeID = detail::NextComponentTypeID();
     return typeID;
 }
+
+/**
+ * @brief Whether T is a tag component
+ *
+ * Tags are empty marker types that do not derive from Component
+ * (e.g. `struct EnemyTag {};`). They are never stored: attaching one only
+ * sets its signature bit (see EntityManager::AddTag()).
+ */
+template<typename T>
+constexpr bool IsTagComponent = std::is_empty_v<T> && !std::is_base_of_v<Component, T>;
@@ -10,13 +10,21 @@
 #include "Entity.h"
 #include "Component.h"
 #include "System.h"
+#include "SparseSet.h"
+#include "ComponentPool.h"
+#include "ComponentObserver.h"
+#include "SharedComponent.h"
+#include "ComponentIndex.h"
+#include "Relationship.h"
 #include <unordered_map>
+#include <array>
 #include <vector>
 #include <memory>
 #include <typeindex>
 #include <type_traits>
 #include <iostream>
 #include <algorithm>
+#include <utility>
 
 /**
  * @class EntityManager
@@ -30,6 +38,9 @@
  *
  * This class maintains all the data structures needed for efficient ECS operations
  * and ensures proper cleanup and notification of systems when entities change.
+ * Each entity carries a component Signature; whenever it changes, the entity is
+ * added to or removed from every system whose required signature it now
+ * matches (or no longer matches).
  *
  * @example
  * ```cpp
@@ -101,6 +112,20 @@ public:
      */
     bool IsEntityValid(Entity entity) const;
 
+    /**
+     * @brief Get the component signature of an entity
+     *
+     * @param entity Entity to query
+     * @return Bitmask of attached component types (empty if entity is invalid)
+     */
+    Signature GetSignature(Entity entity) const;
+
+    /**
+     * @brief Get the number of live entities
+     * @return Entity count
+     */
+    std::size_t GetEntityCount() const { return m_entities.Size(); }
+
     /** @} */ // end of EntityManagement group
 
     /**
@@ -133,6 +158,10 @@ public:
     /**
      * @brief Get a component from an entity
      *
+     * Components of one type are packed in a ComponentPool. The pointer stays
+     * valid while components are added, but not across RemoveComponent<T>(),
+     * destruction of an entity with T, or SortByPosition() of T.
+     *
      * @tparam T Component type to retrieve
      * @param entity Entity to get component from
      * @return Pointer to component if it exists, nullptr otherwise
@@ -150,6 +179,40 @@ public:
     template<typename T>
     const T* GetComponent(Entity entity) const;
 
+    /**
+     * @brief Get a component by runtime type ID (for reflection-driven tools)
+     *
+     * Pair with Reflection::FindComponentType() and TypeInfo::fromBase to read
+     * fields without knowing the concrete type.
+     *
+     * @param entity Entity to get component from
+     * @param typeID Component type ID
+     * @return Pointer to the component base, or nullptr if absent
+     */
+    const Component* GetComponent(Entity entity, ComponentTypeID typeID) const;
+
+    /**
+     * @brief Number of live components of a type
+     *
+     * For shared components this is the number of referencing entities; for
+     * tags it is the number of tagged entities (counted by scanning signatures).
+     *
+     * @param typeID Component type ID
+     * @return Component count
+     */
+    std::size_t GetComponentCount(ComponentTypeID typeID) const;
+
+    /**
+     * @brief Visit every component of a type without knowing the concrete type
+     *
+     * Intended for tools (inspector, memory stats); visits in storage order.
+     *
+     * @param typeID Component type ID
+     * @param visitor Callable taking (const Component&)
+     */
+    template<typename Visitor>
+    void ForEachComponent(ComponentTypeID typeID, Visitor&& visitor) const;
+
     /**
      * @brief Check if an entity has a specific component
      *
@@ -169,8 +232,304 @@ public:
     template<typename T>
     void RemoveComponent(Entity entity);
 
+    /**
+     * @brief Reorder component storage by position (Morton / Z-order)
+     *
+     * Sorts each listed component pool, and the entity list of every system
+     * requiring TransformComponent, by the Morton code of the owner's
+     * TransformComponent cell. Entities close in the world then sit close in
+     * memory and are visited together, so collision and neighbour queries
+     * touch fewer cache lines. Entity handles are unaffected; component
+     * pointers of the listed types are invalidated.
+     *
+     * Cheap to repeat: when little has moved the data is nearly sorted. Call
+     * it periodically (e.g. once a second) between updates, never while
+     * iterating a system.
+     *
+     * @tparam ComponentTypes Pools to reorder (TransformComponent is typically one)
+     * @param cellSize World units per Morton cell (entities in one cell keep their relative order)
+     *
+     * @example
+     * ```cpp
+     * m_sortTimer += deltaTime;
+     * if (m_sortTimer >= 1.0f) {
+     *     entityManager.SortByPosition<TransformComponent, CollisionComponent, AIComponent>();
+     *     m_sortTimer = 0.0f;
+     * }
+     * ```
+     */
+    template<typename... ComponentTypes>
+    void SortByPosition(float cellSize = DEFAULT_SORT_CELL_SIZE);
+
+    /// Default Morton cell size for SortByPosition() (about one sprite)
+    static constexpr float DEFAULT_SORT_CELL_SIZE = 32.0f;
+
+    /**
+     * @brief Memory held by component pools versus what live components need
+     * @return Totals over every pool (see StorageStats::GetFragmentation())
+     */
+    StorageStats GetStorageStats() const;
+
+    /**
+     * @brief Release storage left over from spawn/destroy churn, a little at a time
+     *
+     * Visits component pools, then system entity lists and the live-entity
+     * set, freeing unused chunks and index capacity. Stops once budgetMs has
+     * passed and resumes there on the next call, so a full pass can spread
+     * over several frames. Pools are dense already, so no live component
+     * moves and component pointers stay valid.
+     *
+     * @param budgetMs Time to spend this call (at least one pool is always visited)
+     * @return true if this call completed a pass over all storage
+     *
+     * @example
+     * ```cpp
+     * if (m_compacting && entityManager.CompactStorage(0.25f)) {
+     *     m_compacting = false;
+     * }
+     * ```
+     */
+    bool CompactStorage(float budgetMs);
+
     /** @} */ // end of ComponentManagement group
 
+    /**
+     * @defgroup TagsAndShared Tags and Shared Components
+     * @brief Components that cost less than one stored object per entity
+     *
+     * Tags are empty marker types (see IsTagComponent) that only set a
+     * signature bit. Shared components store one value per distinct instance
+     * and let many entities reference it; they use the `Shared<T>` type key
+     * for signatures, systems and observers.
+     * @{
+     */
+
+    /**
+     * @brief Attach a tag to an entity
+     *
+     * HasComponent<T>(), Require<T>(), GetEntitiesWith<T>() and observers all
+     * work with tags. Adding a tag the entity already has does nothing.
+     *
+     * @tparam T Tag type (empty, not derived from Component)
+     * @param entity Entity to tag
+     *
+     * @example
+     * ```cpp
+     * struct EnemyTag {};
+     * entityManager.AddTag<EnemyTag>(goblin);
+     * auto enemies = entityManager.GetEntitiesWith<TransformComponent, EnemyTag>();
+     * ```
+     */
+    template<typename T>
+    void AddTag(Entity entity);
+
+    /**
+     * @brief Remove a tag from an entity
+     * @tparam T Tag type
+     * @param entity Entity to untag
+     */
+    template<typename T>
+    void RemoveTag(Entity entity) {
+        static_assert(IsTagComponent<T>, "RemoveTag<T> requires a tag type");
+        RemoveComponentByID(entity, GetComponentTypeID<T>());
+    }
+
+    /**
+     * @brief Point an entity at a shared value of T
+     *
+     * Equal values (by reflected fields) are stored once. Calling again with a
+     * different value moves the entity to that value without affecting other
+     * entities. Fires ADDED or CHANGED observers for `Shared<T>`.
+     *
+     * @tparam T Component type with a Reflect<T> specialization
+     * @param entity Entity to assign
+     * @param value Value to share
+     * @return Read-only pointer to the shared value, or nullptr if entity is invalid
+     *
+     * @example
+     * ```cpp
+     * CombatStatsComponent gruntStats(12.0f, 2.5f, 90.0f);
+     * for (Entity grunt : wave) {
+     *     entityManager.SetShared(grunt, gruntStats);  // one stored copy for the wave
+     * }
+     * ```
+     */
+    template<typename T>
+    const T* SetShared(Entity entity, const T& value);
+
+    /**
+     * @brief Get the shared value an entity references
+     * @return Read-only value, or nullptr if the entity has no shared T
+     */
+    template<typename T>
+    const T* GetShared(Entity entity) const;
+
+    /**
+     * @brief Drop an entity's reference to its shared T
+     */
+    template<typename T>
+    void RemoveShared(Entity entity) {
+        RemoveComponentByID(entity, GetComponentTypeID<Shared<T>>());
+    }
+
+    /**
+     * @brief Read-only access to T whether it is stored per entity or shared
+     *
+     * Prefer this over GetComponent<T>() in code that only reads T, so it keeps
+     * working when content switches T to a shared component.
+     *
+     * @return Entity's own T if present, otherwise its shared T, otherwise nullptr
+     */
+    template<typename T>
+    const T* ReadComponent(Entity entity) const {
+        if (const T* component = GetComponent<T>(entity)) {
+            return component;
+        }
+        return GetShared<T>(entity);
+    }
+
+    /**
+     * @brief Shared value pool for a `Shared<T>` type ID (for debug tools)
+     * @return Pool, or nullptr if typeID is not a shared component in use
+     */
+    const SharedComponentPoolBase* GetSharedPool(ComponentTypeID typeID) const {
+        return typeID < MAX_COMPONENT_TYPES ? m_sharedPools[typeID].get() : nullptr;
+    }
+
+    /** @} */ // end of TagsAndShared group
+
+    /**
+     * @defgroup Relationships Entity Relationships
+     * @brief Links between entities with reverse lookup and automatic cleanup
+     *
+     * Prefer these over raw Entity fields when other code needs to ask "who
+     * points at X", or when the link must not outlive its target. Destroying
+     * an entity removes its own links and every link to it in O(k).
+     * @{
+     */
+
+    /**
+     * @brief Link source to target, replacing source's previous link of this kind
+     *
+     * @param source Entity holding the link
+     * @param relation Kind of link
+     * @param target Entity linked to
+     *
+     * @example
+     * ```cpp
+     * entityManager.SetRelation(goblin, Relation::TARGETS, player);
+     * for (Entity attacker : entityManager.GetRelationSources(Relation::TARGETS, player)) {
+     *     // Threat table, aggro limits...
+     * }
+     * ```
+     */
+    void SetRelation(Entity source, Relation relation, Entity target);
+
+    /**
+     * @brief Drop source's link of one kind
+     */
+    void RemoveRelation(Entity source, Relation relation);
+
+    /**
+     * @brief Entity source links to
+     * @return Target, or an invalid Entity if there is no link
+     */
+    Entity GetRelation(Entity source, Relation relation) const;
+
+    /**
+     * @brief Entities linking to target (reverse index)
+     * @return Sources in no particular order; invalidated by relation changes
+     */
+    const std::vector<Entity>& GetRelationSources(Relation relation, Entity target) const;
+
+    /** @} */ // end of Relationships group
+
+    /**
+     * @defgroup ComponentObservers Component Observers
+     * @brief Typed callbacks for structural changes to one component type
+     *
+     * Observers are registered per component type and only run for changes to
+     * that type, so maintaining an index costs nothing when unrelated
+     * components change. Deferred observers are buffered and delivered at the
+     * start of the next Update(), after pending destructions.
+     * @{
+     */
+
+    /**
+     * @brief Observe T being attached to entities
+     *
+     * @tparam T Component type to observe
+     * @param callback Function called with the entity
+     * @param delivery Run immediately or at the next sync point
+     * @return Handle for RemoveObserver()
+     *
+     * @example
+     * ```cpp
+     * entityManager.OnAdd<HealthComponent>([&](Entity e) { ++m_aliveCount; });
+     * ```
+     */
+    template<typename T>
+    ObserverID OnAdd(ComponentObserverCallback callback, ObserverDelivery delivery = ObserverDelivery::IMMEDIATE) {
+        return AddObserver(GetComponentTypeID<T>(), ComponentEvent::ADDED, std::move(callback), delivery);
+    }
+
+    /**
+     * @brief Observe T being detached (including entity destruction)
+     *
+     * @tparam T Component type to observe
+     * @param callback Function called with the entity
+     * @param delivery Run immediately (component still readable) or at the next sync point
+     * @return Handle for RemoveObserver()
+     */
+    template<typename T>
+    ObserverID OnRemove(ComponentObserverCallback callback, ObserverDelivery delivery = ObserverDelivery::IMMEDIATE) {
+        return AddObserver(GetComponentTypeID<T>(), ComponentEvent::REMOVED, std::move(callback), delivery);
+    }
+
+    /**
+     * @brief Observe T being replaced or marked changed
+     *
+     * @tparam T Component type to observe
+     * @param callback Function called with the entity
+     * @param delivery Run immediately or at the next sync point
+     * @return Handle for RemoveObserver()
+     */
+    template<typename T>
+    ObserverID OnChange(ComponentObserverCallback callback, ObserverDelivery delivery = ObserverDelivery::IMMEDIATE) {
+        return AddObserver(GetComponentTypeID<T>(), ComponentEvent::CHANGED, std::move(callback), delivery);
+    }
+
+    /**
+     * @brief Unregister an observer
+     *
+     * Safe to call from inside an observer callback. Pending deferred events
+     * for the observer are dropped.
+     *
+     * @param id Handle returned by OnAdd/OnRemove/OnChange
+     */
+    void RemoveObserver(ObserverID id);
+
+    /**
+     * @brief Report an in-place modification of an entity's T component
+     *
+     * Components are plain data, so writes are not tracked automatically. Call
+     * this after changing a field that observers (indices, aggregates) depend on.
+     *
+     * @tparam T Component type that changed
+     * @param entity Entity owning the component
+     */
+    template<typename T>
+    void MarkChanged(Entity entity);
+
+    /**
+     * @brief Deliver all buffered (deferred) observer events
+     *
+     * Called automatically by Update(); call manually for an extra sync point.
+     */
+    void FlushObserverEvents();
+
+    /** @} */ // end of ComponentObservers group
+
     /**
      * @defgroup SystemManagement System Management
      * @brief Functions for adding, removing, and managing systems
@@ -181,7 +540,8 @@ public:
      * @brief Add a system to the entity manager
      *
      * Creates a new system of type T and adds it to the update loop.
-     * Systems are updated in the order they were added.
+     * Systems are updated in the order they were added. Existing entities that
+     * match the system's required signature are added to it immediately.
      *
      * @tparam T System type to add
      * @tparam Args Constructor argument types
@@ -214,6 +574,29 @@ public:
     template<typename T>
     void RemoveSystem();
 
+    /**
+     * @brief Track membership for a system owned elsewhere
+     *
+     * The system's entity set is kept in sync with its required signature,
+     * but Update() does not call it. Used by SystemPipeline, which owns and
+     * updates its systems directly.
+     *
+     * @param system System to track (must outlive the registration)
+     */
+    void AttachSystem(System* system);
+
+    /**
+     * @brief Stop tracking a system registered with AttachSystem()
+     * @param system System to detach
+     */
+    void DetachSystem(System* system);
+
+    /**
+     * @brief All systems receiving membership updates (owned and attached)
+     * @return Systems in registration order
+     */
+    const std::vector<System*>& GetSystems() const { return m_trackedSystems; }
+
     /** @} */ // end of SystemManagement group
 
     /**
@@ -247,21 +630,92 @@ public:
     template<typename... ComponentTypes>
     std::vector<Entity> GetEntitiesWith();
 
+    /**
+     * @brief Get entities whose T component has a given enum field value
+     *
+     * The first query for a component type builds a value index over that
+     * field; immediate observers then keep it current as T is added, removed
+     * or replaced, so later queries return the pre-partitioned set without
+     * scanning. In-place writes to the field must be reported with
+     * MarkChanged<T>(), like any other observed change. One field per
+     * component type can be indexed.
+     *
+     * Player/enemy/boss roles are already signature tags (PlayerTag,
+     * EnemyTag, BossTag); query those with GetEntitiesWith instead. The
+     * index is for states that change at runtime, such as AIState.
+     *
+     * @tparam T Component type
+     * @tparam Key Enum (or small integer) field type
+     * @param field Indexed field, e.g. `&CharacterTypeComponent::type`
+     * @param value Value to match
+     * @return Matching entities (the set stays valid and follows later changes)
+     *
+     * @example
+     * ```cpp
+     * for (Entity chaser : entityManager.GetEntitiesWithValue(
+     *          &AIComponent::currentState, AIComponent::AIState::CHASE)) {
+     *     // ...
+     * }
+     *
+     * ai->ChangeState(AIComponent::AIState::CHASE);
+     * entityManager.MarkChanged<AIComponent>(entity); // Keeps an AIState index current
+     * ```
+     */
+    template<typename T, typename Key>
+    const SparseSet& GetEntitiesWithValue(Key T::*field, Key value);
+
 private:
     EntityID m_nextEntityID;
-    std::vector<Entity> m_entities;
+    SparseSet m_entities;                 ///< Live entities (O(1) validity checks)
+    std::vector<Signature> m_signatures;  ///< EntityID -> attached component types
     std::vector<Entity> m_entitiesToDestroy;
     
-    // Component storage: ComponentTypeID -> EntityID -> Component
-    std::unordered_map<ComponentTypeID, std::unordered_map<EntityID, std::unique_ptr<Component>>> m_components;
+    // Component storage: ComponentTypeID -> dense pool (null until the type is first added)
+    std::array<std::unique_ptr<ComponentPoolBase>, MAX_COMPONENT_TYPES> m_pools;
+    std::size_t m_compactCursor = 0; ///< Next storage CompactStorage() visits
+
+    // Shared component values: Shared<T> type ID -> pool (null if unused)
+    std::array<std::unique_ptr<SharedComponentPoolBase>, MAX_COMPONENT_TYPES> m_sharedPools;
+
+    // Relationship links, one store per Relation kind
+    std::array<RelationStore, RELATION_COUNT> m_relations;
+
+    // Value indices: ComponentTypeID -> index over one field (null if never queried)
+    std::array<std::unique_ptr<ComponentIndexBase>, MAX_COMPONENT_TYPES> m_indices;
     
     // System storage
     std::vector<std::unique_ptr<System>> m_systems;
     std::unordered_map<std::type_index, System*> m_systemMap;
+    std::vector<System*> m_trackedSystems; ///< Owned + attached systems (membership updates)
     
+    // Observer storage: ComponentTypeID -> observers of that type
+    struct PendingComponentEvent {
+        ObserverID observer;
+        ComponentTypeID typeID;
+        Entity entity;
+    };
+    std::array<std::vector<ComponentObserver>, MAX_COMPONENT_TYPES> m_observers;
+    std::unordered_map<ObserverID, ComponentTypeID> m_observerTypes;
+    std::vector<PendingComponentEvent> m_pendingComponentEvents;
+    std::vector<std::pair<ComponentTypeID, ComponentObserver>> m_stagedObservers; ///< Added mid-dispatch
+    ObserverID m_nextObserverID = 1;
+    int m_observerDispatchDepth = 0;
+    bool m_observersDirty = false; ///< Staged additions or disabled entries to apply
+
     void ProcessEntityDestruction();
-    void NotifySystemsEntityAdded(Entity entity);
-    void NotifySystemsEntityRemoved(Entity entity);
+    void UpdateSystemMembership(Entity entity, const Signature& oldSignature, const Signature& newSignature);
+    void AddMatchingEntities(System* system);
+    ObserverID AddObserver(ComponentTypeID typeID, ComponentEvent event, ComponentObserverCallback callback, ObserverDelivery delivery);
+    void NotifyObservers(ComponentTypeID typeID, ComponentEvent event, Entity entity);
+    void SetComponentBit(Entity entity, ComponentTypeID typeID);
+    void RemoveComponentByID(Entity entity, ComponentTypeID typeID);
+    void ApplyObserverChanges();
+    void SortByMortonKeys(const std::vector<ComponentTypeID>& typeIDs, float cellSize);
+
+    template<typename T>
+    ComponentPool<T>* GetPool() const {
+        return static_cast<ComponentPool<T>*>(m_pools[GetComponentTypeID<T>()].get());
+    }
 };
 
 // Template implementations
@@ -272,33 +726,40 @@ T* EntityManager::AddComponent(Entity entity, Args&&... args) {
     }
 
     ComponentTypeID typeID = GetComponentTypeID<T>();
-    auto component = std::make_unique<T>(std::forward<Args>(args)...);
-    component->owner = entity;
+    if constexpr (HasReflection<T>::value) {
+        GetTypeInfo<T>(); // Registers the type so tools can find it by ID
+    }
+    auto& pool = m_pools[typeID];
+    if (!pool) {
+        pool = std::make_unique<ComponentPool<T>>();
+    }
 
-    T* componentPtr = component.get();
-    m_components[typeID][entity.GetID()] = std::move(component);
+    T* componentPtr = static_cast<ComponentPool<T>&>(*pool).Emplace(entity, std::forward<Args>(args)...);
+    componentPtr->owner = entity;
+    SetComponentBit(entity, typeID);
 
     return componentPtr;
 }
 
-template<typename T>
-T* EntityManager::GetComponent(Entity entity) {
-    if (!IsEntityValid(entity)) {
-        return nullptr;
+template<typename Visitor>
+void EntityManager::ForEachComponent(ComponentTypeID typeID, Visitor&& visitor) const {
+    if (typeID >= MAX_COMPONENT_TYPES || !m_pools[typeID]) {
+        return;
     }
-
-    ComponentTypeID typeID = GetComponentTypeID<T>();
-    auto componentMapIt = m_components.find(typeID);
-    if (componentMapIt == m_components.end()) {
-        return nullptr;
+    const ComponentPoolBase& pool = *m_pools[typeID];
+    for (std::size_t i = 0; i < pool.Size(); ++i) {
+        visitor(pool.At(i));
     }
+}
 
-    auto componentIt = componentMapIt->second.find(entity.GetID());
-    if (componentIt == componentMapIt->second.end()) {
+template<typename T>
+T* EntityManager::GetComponent(Entity entity) {
+    if (!IsEntityValid(entity)) {
         return nullptr;
     }
 
-    return static_cast<T*>(componentIt->second.get());
+    ComponentPool<T>* pool = GetPool<T>();
+    return pool ? pool->Get(entity) : nullptr;
 }
 
 template<typename T>
@@ -308,7 +769,7 @@ const T* EntityManager::GetComponent(Entity entity) const {
 
 template<typename T>
 bool EntityManager::HasComponent(Entity entity) const {
-    return GetComponent<T>(entity) != nullptr;
+    return IsEntityValid(entity) && m_signatures[entity.GetID()].test(GetComponentTypeID<T>());
 }
 
 template<typename T>
@@ -317,10 +778,58 @@ void EntityManager::RemoveComponent(Entity entity) {
         return;
     }
 
+    RemoveComponentByID(entity, GetComponentTypeID<T>());
+}
+
+template<typename T>
+void EntityManager::AddTag(Entity entity) {
+    static_assert(IsTagComponent<T>, "Tags must be empty types not derived from Component");
+    if (!IsEntityValid(entity)) {
+        return;
+    }
+
+    if constexpr (HasReflection<T>::value) {
+        GetTypeInfo<T>(); // Registers the tag so tools can name it
+    }
+
     ComponentTypeID typeID = GetComponentTypeID<T>();
-    auto componentMapIt = m_components.find(typeID);
-    if (componentMapIt != m_components.end()) {
-        componentMapIt->second.erase(entity.GetID());
+    if (!m_signatures[entity.GetID()].test(typeID)) {
+        SetComponentBit(entity, typeID);
+    }
+}
+
+template<typename T>
+const T* EntityManager::SetShared(Entity entity, const T& value) {
+    static_assert(std::is_base_of_v<Component, T>, "Shared values must be components");
+    if (!IsEntityValid(entity)) {
+        return nullptr;
+    }
+
+    ComponentTypeID typeID = GetComponentTypeID<Shared<T>>();
+    auto& pool = m_sharedPools[typeID];
+    if (!pool) {
+        pool = std::make_unique<SharedComponentPool<T>>();
+    }
+
+    const T* stored = static_cast<SharedComponentPool<T>&>(*pool).Assign(entity.GetID(), value);
+    SetComponentBit(entity, typeID);
+    return stored;
+}
+
+template<typename T>
+const T* EntityManager::GetShared(Entity entity) const {
+    if (!IsEntityValid(entity)) {
+        return nullptr;
+    }
+
+    const auto& pool = m_sharedPools[GetComponentTypeID<Shared<T>>()];
+    return pool ? static_cast<const SharedComponentPool<T>&>(*pool).Get(entity.GetID()) : nullptr;
+}
+
+template<typename T>
+void EntityManager::MarkChanged(Entity entity) {
+    if (HasComponent<T>(entity)) {
+        NotifyObservers(GetComponentTypeID<T>(), ComponentEvent::CHANGED, entity);
     }
 }
 
@@ -332,6 +841,9 @@ T* EntityManager::AddSystem(Args&&... args) {
     T* systemPtr = system.get();
     m_systems.push_back(std::move(system));
     m_systemMap[std::type_index(typeid(T))] = systemPtr;
+    m_trackedSystems.push_back(systemPtr);
+
+    AddMatchingEntities(systemPtr);
 
     return systemPtr;
 }
@@ -351,6 +863,8 @@ void EntityManager::RemoveSystem() {
     if (it != m_systemMap.end()) {
         System* systemPtr = it->second;
         m_systemMap.erase(it);
+        m_trackedSystems.erase(std::remove(m_trackedSystems.begin(), m_trackedSystems.end(), systemPtr),
+                               m_trackedSystems.end());
 
         auto systemIt = std::find_if(m_systems.begin(), m_systems.end(),
             [systemPtr](const std::unique_ptr<System>& sys) {
@@ -367,12 +881,57 @@ template<typename... ComponentTypes>
 std::vector<Entity> EntityManager::GetEntitiesWith() {
     std::vector<Entity> result;
 
+    Signature required;
+    (required.set(GetComponentTypeID<ComponentTypes>()), ...);
+
     for (Entity entity : m_entities) {
-        bool hasAllComponents = (HasComponent<ComponentTypes>(entity) && ...);
-        if (hasAllComponents) {
+        if ((m_signatures[entity.GetID()] & required) == required) {
             result.push_back(entity);
         }
     }
 
     return result;
 }
+
+template<typename... ComponentTypes>
+void EntityManager::SortByPosition(float cellSize) {
+    SortByMortonKeys({GetComponentTypeID<ComponentTypes>()...}, cellSize);
+}
+
+template<typename T, typename Key>
+const SparseSet& EntityManager::GetEntitiesWithValue(Key T::*field, Key value) {
+    static_assert(std::is_base_of_v<Component, T>, "Only stored components can be indexed");
+    using Index = ComponentIndex<T, Key>;
+
+    ComponentTypeID typeID = GetComponentTypeID<T>();
+    auto& slot = m_indices[typeID];
+    if (!slot) {
+        auto index = std::make_unique<Index>(field);
+        Index* indexPtr = index.get();
+
+        if (ComponentPool<T>* pool = GetPool<T>()) {
+            for (std::size_t i = 0; i < pool->Size(); ++i) {
+                indexPtr->Insert(pool->GetEntities()[i], pool->Slot(i));
+            }
+        }
+
+        OnAdd<T>([this, indexPtr](Entity entity) {
+            indexPtr->Insert(entity, *GetComponent<T>(entity));
+        });
+        OnChange<T>([this, indexPtr](Entity entity) {
+            indexPtr->Update(entity, *GetComponent<T>(entity));
+        });
+        OnRemove<T>([indexPtr](Entity entity) { indexPtr->Erase(entity); });
+
+        slot = std::move(index);
+    }
+
+    auto* index = dynamic_cast<Index*>(slot.get());
+    if (!index || index->GetField() != field) {
+        std::cerr << "⚠️  GetEntitiesWithValue: component type " << typeID
+                  << " is already indexed by a different field" << std::endl;
+        static const SparseSet empty;
+        return empty;
+    }
+    return index->Get(value);
+}
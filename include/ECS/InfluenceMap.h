@@ -0,0 +1,166 @@
+/**
+ * @file InfluenceMap.h
+ * @brief Grid influence field built from moving sources with dirty-rectangle updates
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class InfluenceMap
+ * @brief Uniform grid where each cell holds the summed influence of nearby sources
+ *
+ * A source adds strength * (1 - distance / radius) to every cell whose
+ * centre lies within radius of the source's cell centre. Sources are
+ * snapped to cells, so a source moving inside its cell changes nothing.
+ *
+ * Updates are incremental: adding, moving or removing a source marks the
+ * cells of its old and new footprint dirty (their union, for short moves), and Update() recomputes only
+ * those rectangles, restamping just the sources that touch them. Cells are
+ * recomputed from scratch rather than patched with +/- deltas, so values
+ * never drift. When most of the grid is dirty, or so many sources moved
+ * that scanning them per rectangle would cost more, the whole map is
+ * rebuilt in one pass instead.
+ *
+ * An optional 1-2-1 blur (applied SetBlurPasses() times, separably)
+ * smooths the field; it is refreshed only around dirty rectangles too.
+ *
+ * Sample() reads one cell, so AI can query the field in O(1) per decision.
+ *
+ * @example
+ * ```cpp
+ * InfluenceMap threat(128, 32, 32.0f);
+ * int player = threat.AddSource(playerX, playerY, 1.0f, 200.0f);
+ * // Each frame
+ * threat.MoveSource(player, playerX, playerY);
+ * threat.Update();
+ * if (threat.Sample(enemyX, enemyY) > 0.7f) {
+ *     // Too close to the player: back off
+ * }
+ * ```
+ */
+class InfluenceMap {
+public:
+    /**
+     * @brief Create an empty map
+     * @param columns Cells across
+     * @param rows Cells down
+     * @param cellSize World size of one cell
+     * @param originX World X of the map's left edge
+     * @param originY World Y of the map's top edge
+     */
+    InfluenceMap(int columns, int rows, float cellSize, float originX = 0.0f, float originY = 0.0f);
+
+    /**
+     * @brief Add a source
+     * @param x World X
+     * @param y World Y
+     * @param strength Influence at the source's own cell (negative values subtract)
+     * @param radius World distance at which the influence reaches zero
+     * @return Source id for MoveSource()/SetSource()/RemoveSource()
+     */
+    int AddSource(float x, float y, float strength, float radius);
+
+    /// Move a source; only dirties the map if it changes cell
+    void MoveSource(int id, float x, float y);
+
+    /// Change every property of a source; only dirties the map if something visible changed
+    void SetSource(int id, float x, float y, float strength, float radius);
+
+    void RemoveSource(int id);
+
+    /// Remove every source and zero the map
+    void Clear();
+
+    /**
+     * @brief Recompute the cells dirtied since the last call
+     * @return Number of cells recomputed (before blurring)
+     */
+    std::size_t Update();
+
+    /**
+     * @brief Read the (blurred, if enabled) influence at a world position
+     * @return Cell value, or 0 outside the map
+     */
+    float Sample(float x, float y) const;
+
+    /// Read one cell (0 outside the map)
+    float SampleCell(int column, int row) const;
+
+    /**
+     * @brief Find the cell with the lowest or highest value within a search radius
+     * @param x World X to search around
+     * @param y World Y to search around
+     * @param searchRadius World radius of the search
+     * @param lowest true for the minimum, false for the maximum
+     * @param outX Receives the chosen cell's centre X
+     * @param outY Receives the chosen cell's centre Y
+     * @return false if the search area lies outside the map
+     */
+    bool FindExtreme(float x, float y, float searchRadius, bool lowest, float& outX, float& outY) const;
+
+    /**
+     * @brief Set how many 1-2-1 blur passes smooth the sampled field (0 = off)
+     *
+     * Changing the pass count rebuilds the whole map on the next Update().
+     */
+    void SetBlurPasses(int passes);
+
+    int GetColumns() const { return m_columns; }
+    int GetRows() const { return m_rows; }
+    float GetCellSize() const { return m_cellSize; }
+    std::size_t GetSourceCount() const { return m_sourceCount; }
+
+    /// Row-major cell values as sampled (blurred when enabled)
+    const float* Data() const { return m_blurPasses > 0 ? m_blurred.data() : m_values.data(); }
+
+private:
+    /// Inclusive cell rectangle
+    struct Rect {
+        int left;
+        int top;
+        int right;
+        int bottom;
+    };
+
+    struct Source {
+        int column;
+        int row;
+        float strength;
+        float radius;
+        bool alive;
+        bool visible;   ///< Footprint reaches at least one cell
+        Rect footprint; ///< Cells the source reaches, clipped to the map
+    };
+
+    int m_columns;
+    int m_rows;
+    float m_cellSize;
+    float m_originX;
+    float m_originY;
+    int m_blurPasses = 0;
+
+    std::vector<float> m_values;   ///< Raw summed influence
+    std::vector<float> m_blurred;  ///< m_values after blurring
+    std::vector<float> m_scratch;  ///< Blur working area
+    std::vector<float> m_scratch2;
+
+    std::vector<Source> m_sources;
+    std::vector<int> m_freeSources;
+    std::size_t m_sourceCount = 0;
+
+    std::vector<Rect> m_dirty;
+    bool m_fullRebuild = false;
+
+    int ColumnOf(float x) const;
+    int RowOf(float y) const;
+    void UpdateFootprint(Source& source) const;
+    void MarkDirty(const Rect& rect);
+    void Stamp(const Source& source, const Rect& clip);
+    void Recompute(const Rect& rect);
+    void Blur(const Rect& rect);
+};
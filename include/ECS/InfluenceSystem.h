@@ -0,0 +1,93 @@
+/**
+ * @file InfluenceSystem.h
+ * @brief Keeps threat, ally and danger influence maps in sync with their source entities
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include "System.h"
+#include "EntityManager.h"
+#include "Component.h"
+#include "InfluenceMap.h"
+#include <array>
+#include <vector>
+
+/**
+ * @class InfluenceSystem
+ * @brief Owns one InfluenceMap per InfluenceSourceComponent::Layer
+ *
+ * Entities with an InfluenceSourceComponent become sources of their layer
+ * when they join the system and stop being sources when they leave it.
+ * Each update pushes current positions into the maps; entities that stay in
+ * their cell cost nothing, and the maps recompute only the cells whose
+ * sources moved. AI reads the result with Sample() in O(1) per query
+ * instead of scanning entities.
+ *
+ * @example
+ * ```cpp
+ * auto* influence = entityManager.AddSystem<InfluenceSystem>(256, 32, 32.0f);
+ * entityManager.AddComponent<InfluenceSourceComponent>(player, InfluenceSourceComponent::Layer::THREAT, 1.0f, 200.0f);
+ *
+ * // Enemy decision: flee when the player's threat outweighs nearby allies
+ * using Layer = InfluenceSourceComponent::Layer;
+ * if (influence->Sample(Layer::THREAT, x, y) > influence->Sample(Layer::ALLIES, x, y)) {
+ *     float safeX, safeY;
+ *     influence->GetMap(Layer::THREAT).FindExtreme(x, y, 160.0f, true, safeX, safeY);
+ * }
+ * ```
+ */
+class InfluenceSystem : public System {
+public:
+    using Layer = InfluenceSourceComponent::Layer;
+    static constexpr std::size_t LAYER_COUNT = static_cast<std::size_t>(Layer::COUNT);
+
+    /// Entity query and further component access (used by SystemPipeline scheduling)
+    using Required = ComponentList<TransformComponent, InfluenceSourceComponent>;
+    using Reads = ComponentList<>;
+    using Writes = ComponentList<>;
+
+    /**
+     * @brief Constructor - every layer covers the same grid
+     * @param columns Cells across
+     * @param rows Cells down
+     * @param cellSize World size of one cell
+     * @param originX World X of the grid's left edge
+     * @param originY World Y of the grid's top edge
+     */
+    InfluenceSystem(int columns, int rows, float cellSize, float originX = 0.0f, float originY = 0.0f);
+
+    /**
+     * @brief Move sources and refresh the dirty parts of every map
+     * @param deltaTime Time elapsed since last update in seconds (unused)
+     */
+    void Update(float deltaTime) override;
+
+    void OnEntityAdded(Entity entity) override;
+    void OnEntityRemoved(Entity entity) override;
+
+    /// Influence of a layer at a world position (O(1))
+    float Sample(Layer layer, float x, float y) const { return GetMap(layer).Sample(x, y); }
+
+    const InfluenceMap& GetMap(Layer layer) const { return m_maps[static_cast<std::size_t>(layer)]; }
+    InfluenceMap& GetMap(Layer layer) { return m_maps[static_cast<std::size_t>(layer)]; }
+
+    /// Cells recomputed by the last Update(), summed over layers
+    std::size_t GetUpdatedCells() const { return m_updatedCells; }
+
+    const char* GetName() const override { return "InfluenceSystem"; }
+
+private:
+    /// Where an entity's source lives (indexed by entity ID)
+    struct Tracked {
+        int source = -1;
+        Layer layer = Layer::THREAT;
+    };
+
+    std::vector<InfluenceMap> m_maps;
+    std::vector<Tracked> m_tracked;
+    std::size_t m_updatedCells = 0;
+
+    void AddSource(Entity entity);
+};
@@ -38,6 +38,23 @@
  */
 class MovementSystem : public System {
 public:
+    /// Entity query and further component access (used by SystemPipeline scheduling)
+    using Required = ComponentList<TransformComponent, VelocityComponent>;
+    using Excluded = ComponentList<DormantTag>;
+    using Reads = ComponentList<>;
+    using Writes = ComponentList<TransformComponent>;
+
+    /**
+     * @brief Constructor - declares the Transform + Velocity requirement
+     *
+     * Dormant ballistic entities are left out; BallisticSystem evaluates
+     * their motion in closed form instead.
+     */
+    MovementSystem() {
+        Require(Required{});
+        Exclude(Excluded{});
+    }
+
     /**
      * @brief Update entity positions based on their velocities
      *
@@ -50,9 +67,7 @@ public:
      * @note This system automatically processes all entities with the required components
      */
     void Update(float deltaTime) override {
-        auto entities = m_entityManager->GetEntitiesWith<TransformComponent, VelocityComponent>();
-
-        for (Entity entity : entities) {
+        for (Entity entity : GetEntities()) {
             auto* transform = m_entityManager->GetComponent<TransformComponent>(entity);
             auto* velocity = m_entityManager->GetComponent<VelocityComponent>(entity);
 
@@ -62,4 +77,6 @@ public:
             }
         }
     }
+
+    const char* GetName() const override { return "MovementSystem"; }
 };
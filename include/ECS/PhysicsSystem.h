@@ -0,0 +1,190 @@
+/**
+ * @file PhysicsSystem.h
+ * @brief Rigid-body contact solver with sleeping islands
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include "System.h"
+#include "EntityManager.h"
+#include "Component.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class PhysicsSystem
+ * @brief Gravity, AABB contact resolution and sleeping for RigidBodyComponent entities
+ *
+ * Each step:
+ * 1. Apply gravity to awake dynamic bodies.
+ * 2. Broad phase: awake bodies are hashed into a uniform grid and tested
+ *    against each other and against the resting grid (static and sleeping
+ *    bodies, which is only updated when bodies fall asleep or wake up).
+ * 3. Sequential-impulse solver: normal impulses with restitution, Coulomb
+ *    friction, then positional correction of the remaining overlap.
+ * 4. Bodies touching each other form islands. An island whose bodies have all
+ *    been slower than SLEEP_SPEED for SLEEP_TIME is tagged SleepingTag, which
+ *    removes it from this system: sleeping bodies cost nothing per frame.
+ *    A body hitting a sleeping one faster than WAKE_SPEED, Wake() or
+ *    ApplyImpulse() wakes the whole island.
+ *
+ * Static bodies (inverse mass 0) are parked in the resting grid on their
+ * first step and must not be moved afterwards. Velocities changed directly
+ * on a sleeping body take effect only once it is woken.
+ *
+ * @example
+ * ```cpp
+ * auto* physics = entityManager.AddSystem<PhysicsSystem>();
+ *
+ * Entity floor = entityManager.CreateEntity();
+ * entityManager.AddComponent<TransformComponent>(floor, 0.0f, 500.0f);
+ * entityManager.AddComponent<VelocityComponent>(floor);
+ * entityManager.AddComponent<CollisionComponent>(floor, 2000.0f, 32.0f);
+ * entityManager.AddComponent<RigidBodyComponent>(floor, 0.0f); // static
+ *
+ * Entity crate = entityManager.CreateEntity();
+ * entityManager.AddComponent<TransformComponent>(crate, 100.0f, 0.0f);
+ * entityManager.AddComponent<VelocityComponent>(crate);
+ * entityManager.AddComponent<CollisionComponent>(crate, 32.0f, 32.0f);
+ * entityManager.AddComponent<RigidBodyComponent>(crate, 1.0f);
+ * ```
+ */
+class PhysicsSystem : public System {
+public:
+    /// Entity query and further component access (used by SystemPipeline scheduling).
+    /// Putting bodies to sleep and waking them adds and removes SleepingTag: a write.
+    using Required = ComponentList<TransformComponent, VelocityComponent, CollisionComponent, RigidBodyComponent>;
+    using Excluded = ComponentList<SleepingTag>;
+    using Reads = ComponentList<>;
+    using Writes = ComponentList<TransformComponent, VelocityComponent, RigidBodyComponent, SleepingTag>;
+
+    static constexpr float DEFAULT_GRAVITY = 500.0f;  ///< Downward acceleration (units/s^2)
+    static constexpr float DEFAULT_CELL_SIZE = 64.0f; ///< Broad-phase grid cell size
+    static constexpr float SLEEP_SPEED = 10.0f;       ///< Speed under which a body counts as resting
+    static constexpr float SLEEP_TIME = 0.5f;         ///< Seconds an island must rest before sleeping
+    static constexpr float WAKE_SPEED = 30.0f;        ///< Approach speed that wakes a sleeping body
+    static constexpr int SOLVER_ITERATIONS = 8;       ///< Velocity iterations per step
+
+    /**
+     * @brief Constructor - declares the body requirement; sleeping bodies are excluded
+     */
+    PhysicsSystem() {
+        Require(Required{});
+        Exclude(Excluded{});
+    }
+
+    /**
+     * @brief Advance the simulation by one step
+     * @param deltaTime Time elapsed since last update in seconds
+     */
+    void Update(float deltaTime) override;
+
+    /**
+     * @brief Track new bodies; park static ones and unpark woken ones
+     */
+    void OnEntityAdded(Entity entity) override;
+
+    void SetGravity(float gravity) { m_gravity = gravity; }
+    float GetGravity() const { return m_gravity; }
+
+    /**
+     * @brief Set the broad-phase cell size (about the size of a typical body)
+     */
+    void SetCellSize(float cellSize) { m_cellSize = cellSize; }
+
+    /**
+     * @brief Allow or forbid islands to sleep (forbidding wakes everything)
+     */
+    void SetSleepingEnabled(bool enabled);
+
+    /**
+     * @brief Wake the island a sleeping body belongs to
+     * @param entity Body to wake (no effect on static or awake bodies)
+     */
+    void Wake(Entity entity);
+
+    /**
+     * @brief Change a body's velocity by impulse / mass, waking it if needed
+     * @param entity Dynamic body
+     * @param impulseX X impulse
+     * @param impulseY Y impulse
+     */
+    void ApplyImpulse(Entity entity, float impulseX, float impulseY);
+
+    /// Whether a body is asleep (static bodies always are)
+    bool IsSleeping(Entity entity) const { return m_entityManager->HasComponent<SleepingTag>(entity); }
+
+    /// Contacts resolved in the last step
+    std::size_t GetContactCount() const { return m_contacts.size(); }
+
+    /// Islands of awake bodies in the last step
+    std::size_t GetIslandCount() const { return m_islandCount; }
+
+    const char* GetName() const override { return "PhysicsSystem"; }
+
+private:
+    /// Per-step copy of a body's state (resting bodies appear as immovable)
+    struct Body {
+        Entity entity;
+        TransformComponent* transform;
+        const CollisionComponent* box;
+        RigidBodyComponent* rigid;
+        float vx;
+        float vy;
+        float inverseMass;
+    };
+
+    /// Overlap between bodies a and b; normal points from a to b
+    struct Contact {
+        std::uint32_t a;
+        std::uint32_t b;
+        float nx;
+        float ny;
+        float penetration;
+        float restitution;
+        float friction;
+    };
+
+    using CellKey = std::int64_t;
+
+    float m_gravity = DEFAULT_GRAVITY;
+    float m_cellSize = DEFAULT_CELL_SIZE;
+    bool m_sleepingEnabled = true;
+    bool m_updating = false;
+    std::size_t m_islandCount = 0;
+
+    std::vector<Body> m_bodies;           ///< Awake bodies first, then resting bodies touched this step
+    std::size_t m_awakeCount = 0;
+    std::vector<Contact> m_contacts;
+    std::unordered_map<CellKey, std::vector<std::uint32_t>> m_awakeGrid; ///< Cell -> awake body indices
+    std::unordered_map<CellKey, std::vector<Entity>> m_restingGrid;      ///< Cell -> static/sleeping bodies
+    std::unordered_map<EntityID, std::uint32_t> m_restingIndex;          ///< Resting entity -> m_bodies index
+    std::unordered_map<int, std::vector<Entity>> m_sleepingIslands;      ///< Island id -> sleeping members
+    int m_nextIsland = 1;
+    std::vector<std::uint32_t> m_parent;  ///< Union-find over awake bodies
+    std::vector<Entity> m_pendingStatic;  ///< Static bodies to park on the next step
+    std::vector<int> m_islandsToWake;
+    std::vector<Entity> m_toSleep;
+
+    void GatherBodies();
+    void FindContacts();
+    void AddContact(std::uint32_t a, std::uint32_t b, CellKey cell);
+    std::uint32_t RestingBodyIndex(Entity entity);
+    void SolveVelocities();
+    void IntegratePositions(float deltaTime);
+    void CorrectPositions();
+    void UpdateIslands(float deltaTime);
+    void WakeQueuedIslands();
+    void Park(Entity entity);
+    void Unpark(Entity entity);
+
+    CellKey KeyOf(float x, float y) const;
+    std::uint32_t FindRoot(std::uint32_t index);
+
+    /// Visit the key of every grid cell an AABB touches
+    template<typename Visit>
+    void ForEachCell(float x, float y, float width, float height, Visit&& visit) const;
+};
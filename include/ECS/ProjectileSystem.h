@@ -0,0 +1,211 @@
+/**
+ * @file ProjectileSystem.h
+ * @brief Pooled bullets with swept collision against collider entities
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include "System.h"
+#include "EntityManager.h"
+#include "Component.h"
+#include "Engine/EventSystem.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @struct ProjectileHitEvent
+ * @brief Event fired when a projectile strikes a collider
+ */
+struct ProjectileHitEvent : public EventType<ProjectileHitEvent> {
+    Entity owner;   ///< Entity that fired the projectile (can be invalid)
+    Entity target;  ///< Entity that was hit
+    float damage;   ///< Damage carried by the projectile
+    float x;        ///< Impact X
+    float y;        ///< Impact Y
+
+    ProjectileHitEvent(Entity o, Entity t, float d, float hitX, float hitY)
+        : owner(o), target(t), damage(d), x(hitX), y(hitY) {}
+};
+
+/**
+ * @class ProjectileSystem
+ * @brief Fixed-capacity projectile pool, integrated in batches and swept against colliders
+ *
+ * Projectiles are not entities: each one is a slot in structure-of-arrays
+ * storage (position, velocity, remaining life, damage, owner, target mask)
+ * with a capacity fixed at construction, so firing never allocates.
+ *
+ * The system's entities are the colliders projectiles can hit (the same set
+ * CollisionSystem sees). Each step:
+ * 1. Colliders are hashed into a uniform grid by their bounding box.
+ * 2. Every projectile's movement this step is a segment, thickened by its
+ *    radius and tested against the colliders in the grid cells it crosses,
+ *    so fast projectiles can't tunnel through thin targets.
+ * 3. The earliest hit ends the projectile and is recorded; then all
+ *    survivors are integrated in one pass and expired ones are removed.
+ * 4. Hits are fired as ProjectileHitEvent on the event manager (if any)
+ *    and stay readable through GetHits() until the next step.
+ *
+ * Targets are matched against their CollisionComponent box whatever its
+ * shape. A projectile never hits its owner.
+ *
+ * @example
+ * ```cpp
+ * auto* projectiles = entityManager.AddSystem<ProjectileSystem>(4096, &eventManager);
+ * eventManager.Subscribe<ProjectileHitEvent>([](const ProjectileHitEvent& hit) {
+ *     // Apply hit.damage to hit.target
+ * });
+ *
+ * // Boss attack: a ring of 24 bullets that only hurt the player
+ * projectiles->SpawnRing(bossX, bossY, 24, 200.0f, 3.0f, 10.0f, boss, ProjectileSystem::TARGET_PLAYER);
+ * ```
+ */
+class ProjectileSystem : public System {
+public:
+    /// Entity query and further component access (used by SystemPipeline scheduling).
+    /// Hit events are dispatched immediately to game code, which may change anything.
+    using Required = ComponentList<TransformComponent, CollisionComponent>;
+    using Excluded = ComponentList<DormantTag>;
+    using Reads = ComponentList<>;
+    using Writes = ComponentList<AnyComponent>;
+
+    /// Which colliders a projectile may hit (bit mask)
+    enum Targets : std::uint8_t {
+        TARGET_PLAYER = 1 << 0, ///< Entities tagged PlayerTag
+        TARGET_ENEMY = 1 << 1,  ///< Entities tagged EnemyTag
+        TARGET_OTHER = 1 << 2,  ///< Colliders with neither tag
+        TARGET_ANY = TARGET_PLAYER | TARGET_ENEMY | TARGET_OTHER
+    };
+
+    static constexpr std::size_t DEFAULT_CAPACITY = 4096;
+    static constexpr float DEFAULT_CELL_SIZE = 64.0f;  ///< Target grid cell size
+    static constexpr float DEFAULT_RADIUS = 2.0f;      ///< Projectile radius
+
+    /**
+     * @brief Constructor - colliders outside the active region are not targets
+     * @param capacity Maximum live projectiles (further spawns are dropped)
+     * @param events Event manager receiving ProjectileHitEvent (optional)
+     */
+    explicit ProjectileSystem(std::size_t capacity = DEFAULT_CAPACITY, EventManager* events = nullptr);
+
+    /**
+     * @brief Sweep, integrate and expire projectiles
+     * @param deltaTime Time elapsed since last update in seconds
+     */
+    void Update(float deltaTime) override;
+
+    /**
+     * @brief Fire a projectile
+     * @param x Start X
+     * @param y Start Y
+     * @param vx X velocity (units/s)
+     * @param vy Y velocity (units/s)
+     * @param lifetime Seconds before it expires
+     * @param damage Damage reported on hit
+     * @param owner Firing entity (never hit by its own projectile)
+     * @param targets TARGET_* mask of what it can hit
+     * @param radius Projectile radius
+     * @return false if the pool is full and the projectile was dropped
+     */
+    bool Spawn(float x, float y, float vx, float vy, float lifetime, float damage,
+               Entity owner = Entity(), std::uint8_t targets = TARGET_ANY, float radius = DEFAULT_RADIUS);
+
+    /**
+     * @brief Fire a projectile that expires after travelling a given distance
+     *
+     * Matches a ranged ability: lifetime = range / speed.
+     *
+     * @param x Start X
+     * @param y Start Y
+     * @param targetX Point to aim at
+     * @param targetY Point to aim at
+     * @param speed Speed (units/s)
+     * @param range Distance before it expires
+     * @param damage Damage reported on hit
+     * @param owner Firing entity
+     * @param targets TARGET_* mask
+     * @return false if the pool is full or the aim point is the start point
+     */
+    bool SpawnToward(float x, float y, float targetX, float targetY, float speed, float range, float damage,
+                     Entity owner = Entity(), std::uint8_t targets = TARGET_ANY);
+
+    /**
+     * @brief Fire projectiles evenly spaced around a circle (boss bullet patterns)
+     * @param x Centre X
+     * @param y Centre Y
+     * @param count Number of projectiles
+     * @param speed Speed (units/s)
+     * @param lifetime Seconds before they expire
+     * @param damage Damage per projectile
+     * @param owner Firing entity
+     * @param targets TARGET_* mask
+     * @param angleOffset Rotation of the whole ring in radians
+     * @return Number of projectiles actually spawned
+     */
+    int SpawnRing(float x, float y, int count, float speed, float lifetime, float damage,
+                  Entity owner = Entity(), std::uint8_t targets = TARGET_ANY, float angleOffset = 0.0f);
+
+    /// Remove every live projectile
+    void Clear() { m_count = 0; }
+
+    /**
+     * @brief Visit every live projectile (for rendering)
+     * @param visit Callable taking (float x, float y, float radius)
+     */
+    template<typename Visit>
+    void ForEach(Visit&& visit) const {
+        for (std::size_t i = 0; i < m_count; ++i) {
+            visit(m_x[i], m_y[i], m_radius[i]);
+        }
+    }
+
+    /// Hits recorded by the last Update()
+    const std::vector<ProjectileHitEvent>& GetHits() const { return m_hits; }
+
+    std::size_t GetCount() const { return m_count; }
+    std::size_t GetCapacity() const { return m_x.size(); }
+
+    void SetEventManager(EventManager* events) { m_events = events; }
+
+    /// Set the target grid cell size (about the size of a typical target)
+    void SetCellSize(float cellSize) { m_cellSize = cellSize; }
+
+    const char* GetName() const override { return "ProjectileSystem"; }
+
+private:
+    /// Per-step copy of a collider
+    struct Target {
+        Entity entity;
+        float left;
+        float top;
+        float right;
+        float bottom;
+        std::uint8_t kind;  ///< TARGET_* bit
+    };
+
+    using CellKey = std::int64_t;
+
+    EventManager* m_events;
+    float m_cellSize = DEFAULT_CELL_SIZE;
+
+    // Projectile pool (structure of arrays, first m_count slots live)
+    std::size_t m_count = 0;
+    std::vector<float> m_x, m_y, m_vx, m_vy, m_life, m_damage, m_radius;
+    std::vector<Entity> m_owner;
+    std::vector<std::uint8_t> m_targets;
+
+    std::vector<Target> m_targetList;
+    std::unordered_map<CellKey, std::vector<std::uint32_t>> m_grid; ///< Cell -> m_targetList indices
+    std::vector<std::uint32_t> m_visited;  ///< Per target: last projectile (+1) that tested it
+    std::vector<ProjectileHitEvent> m_hits;
+
+    void BuildGrid();
+    void SweepProjectiles(float deltaTime);
+    void Integrate(float deltaTime);
+    void RemoveSlot(std::size_t slot);
+
+    CellKey KeyOf(std::int64_t cx, std::int64_t cy) const { return (cx << 32) ^ (cy & 0xFFFFFFFF); }
+};
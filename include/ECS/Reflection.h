@@ -0,0 +1,325 @@
+/**
+ * @file Reflection.h
+ * @brief Lightweight component reflection: field metadata, binary serialization, deltas
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include "Entity.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+struct Component;
+struct TypeInfo;
+
+/**
+ * @enum FieldType
+ * @brief Storage kind of a reflected field
+ *
+ * Everything except STRING and VECTOR is plain data and is copied with memcpy.
+ */
+enum class FieldType : std::uint8_t {
+    BOOL,
+    UINT8,
+    INT32,
+    FLOAT,
+    ENUM,     ///< Enum stored in its underlying integer type
+    ENTITY,   ///< Entity handle (32-bit ID)
+    STRING,   ///< std::string (length-prefixed)
+    VECTOR    ///< std::vector of a reflected element type (count-prefixed)
+};
+
+/**
+ * @brief Field flags controlling tools
+ */
+enum FieldFlags : std::uint32_t {
+    FIELD_NONE = 0,
+    FIELD_TRANSIENT = 1 << 0, ///< Runtime-only (not serialized or diffed), e.g. mixer channels
+    FIELD_READ_ONLY = 1 << 1, ///< Shown by the inspector but not editable
+    FIELD_HIDDEN = 1 << 2     ///< Not shown by the inspector
+};
+
+/**
+ * @struct VectorOps
+ * @brief Type-erased operations on a std::vector<E> field
+ */
+struct VectorOps {
+    std::size_t (*size)(const void* vector) = nullptr;
+    std::size_t (*capacity)(const void* vector) = nullptr;
+    void (*resize)(void* vector, std::size_t count) = nullptr;
+    void* (*at)(void* vector, std::size_t index) = nullptr;
+    const TypeInfo* (*element)() = nullptr; ///< Element type (resolved lazily)
+};
+
+/**
+ * @struct FieldInfo
+ * @brief Metadata for one reflected field
+ */
+struct FieldInfo {
+    const char* name = "";          ///< Field name as written in the struct
+    std::size_t offset = 0;         ///< Byte offset from the start of the object
+    std::size_t size = 0;           ///< sizeof the field
+    FieldType type = FieldType::INT32;
+    std::uint32_t flags = FIELD_NONE;
+    VectorOps vector;               ///< Only set for FieldType::VECTOR
+
+    bool IsPlainData() const { return type != FieldType::STRING && type != FieldType::VECTOR; }
+};
+
+/**
+ * @struct TypeInfo
+ * @brief Reflected description of a component (or nested element) type
+ *
+ * Serialization walks `podRuns` (adjacent plain-data fields merged into single
+ * memcpy ranges) and then `dynamicFields` (strings and vectors).
+ */
+struct TypeInfo {
+    /// A contiguous byte range of plain-data fields
+    struct PodRun {
+        std::size_t offset;
+        std::size_t size;
+    };
+
+    const char* name = "";
+    std::size_t size = 0;                     ///< sizeof the type
+    std::vector<FieldInfo> fields;            ///< All fields, in declaration order
+    std::vector<PodRun> podRuns;              ///< Serialized plain-data ranges
+    std::vector<std::size_t> dynamicFields;   ///< Indices of serialized string/vector fields
+    ComponentTypeID componentID = 0;          ///< Valid when isComponent is true
+    bool isComponent = false;
+    bool isTag = false;                       ///< Tag component (no storage, size 0)
+
+    /// Convert a Component base pointer to the start of the derived object
+    const void* (*fromBase)(const Component* component) = nullptr;
+
+    const FieldInfo* FindField(const std::string& fieldName) const;
+};
+
+/**
+ * @brief Reflection declaration for a type (specialize next to the type)
+ *
+ * @example
+ * ```cpp
+ * template<> struct Reflect<VelocityComponent> {
+ *     static void Describe(TypeBuilder<VelocityComponent>& t) {
+ *         t.Name("VelocityComponent").Field("vx", &VelocityComponent::vx).Field("vy", &VelocityComponent::vy);
+ *     }
+ * };
+ * ```
+ */
+template<typename T>
+struct Reflect;
+
+/// true if Reflect<T> has been specialized
+template<typename T, typename = void>
+struct HasReflection : std::false_type {};
+
+template<typename T>
+struct HasReflection<T, std::void_t<decltype(&Reflect<T>::Describe)>> : std::true_type {};
+
+template<typename T>
+const TypeInfo& GetTypeInfo();
+
+namespace detail {
+
+template<typename T>
+struct IsStdVector : std::false_type {};
+
+template<typename E, typename A>
+struct IsStdVector<std::vector<E, A>> : std::true_type {};
+
+template<typename F>
+constexpr FieldType DeduceFieldType() {
+    if constexpr (std::is_same_v<F, bool>) return FieldType::BOOL;
+    else if constexpr (std::is_same_v<F, unsigned char>) return FieldType::UINT8;
+    else if constexpr (std::is_same_v<F, int>) return FieldType::INT32;
+    else if constexpr (std::is_same_v<F, float>) return FieldType::FLOAT;
+    else if constexpr (std::is_enum_v<F>) return FieldType::ENUM;
+    else if constexpr (std::is_same_v<F, Entity>) return FieldType::ENTITY;
+    else if constexpr (std::is_same_v<F, std::string>) return FieldType::STRING;
+    else if constexpr (IsStdVector<F>::value) return FieldType::VECTOR;
+    else {
+        static_assert(sizeof(F) == 0, "Unsupported reflected field type");
+        return FieldType::INT32;
+    }
+}
+
+/// Component registry: ComponentTypeID -> TypeInfo (filled as types are reflected)
+std::array<const TypeInfo*, MAX_COMPONENT_TYPES>& ComponentTypeInfos();
+
+void FinalizeTypeInfo(TypeInfo& info);
+
+} // namespace detail
+
+/**
+ * @class TypeBuilder
+ * @brief Collects field metadata inside Reflect<T>::Describe()
+ *
+ * Offsets are measured on a default-constructed instance, so reflected types
+ * must be default-constructible.
+ */
+template<typename T>
+class TypeBuilder {
+public:
+    explicit TypeBuilder(TypeInfo& info) : m_info(info) {
+        m_info.size = sizeof(T);
+    }
+
+    TypeBuilder& Name(const char* name) {
+        m_info.name = name;
+        return *this;
+    }
+
+    /**
+     * @brief Register a data member
+     * @param name Field name
+     * @param member Pointer to member
+     * @param flags FieldFlags bitmask
+     */
+    template<typename F>
+    TypeBuilder& Field(const char* name, F T::*member, std::uint32_t flags = FIELD_NONE) {
+        FieldInfo field;
+        field.name = name;
+        field.offset = static_cast<std::size_t>(
+            reinterpret_cast<const unsigned char*>(&(m_sample.*member)) -
+            reinterpret_cast<const unsigned char*>(&m_sample));
+        field.size = sizeof(F);
+        field.type = detail::DeduceFieldType<F>();
+        field.flags = flags;
+
+        if constexpr (detail::IsStdVector<F>::value) {
+            using Element = typename F::value_type;
+            field.vector.size = [](const void* v) { return static_cast<const F*>(v)->size(); };
+            field.vector.capacity = [](const void* v) { return static_cast<const F*>(v)->capacity(); };
+            field.vector.resize = [](void* v, std::size_t n) { static_cast<F*>(v)->resize(n); };
+            field.vector.at = [](void* v, std::size_t i) -> void* { return &(*static_cast<F*>(v))[i]; };
+            field.vector.element = []() -> const TypeInfo* { return &GetTypeInfo<Element>(); };
+        }
+
+        m_info.fields.push_back(field);
+        return *this;
+    }
+
+private:
+    TypeInfo& m_info;
+    T m_sample{};
+};
+
+/**
+ * @brief Get (and lazily build) the reflection data for T
+ *
+ * Component and tag types are also entered into the ComponentTypeID registry
+ * so tools can look them up from an entity's signature.
+ */
+template<typename T>
+const TypeInfo& GetTypeInfo() {
+    static_assert(HasReflection<T>::value, "Type has no Reflect<T> specialization");
+    static const TypeInfo info = []() {
+        TypeInfo built;
+        {
+            TypeBuilder<T> builder(built);
+            Reflect<T>::Describe(builder);
+        }
+        if constexpr (std::is_base_of_v<Component, T>) {
+            built.isComponent = true;
+            built.componentID = GetComponentTypeID<T>();
+            built.fromBase = [](const Component* c) -> const void* { return static_cast<const T*>(c); };
+        } else if constexpr (IsTagComponent<T>) {
+            built.isComponent = true;
+            built.isTag = true;
+            built.componentID = GetComponentTypeID<T>();
+            built.size = 0;
+        }
+        detail::FinalizeTypeInfo(built);
+        return built;
+    }();
+
+    if constexpr (std::is_base_of_v<Component, T> || IsTagComponent<T>) {
+        static const bool registered = (detail::ComponentTypeInfos()[info.componentID] = &info, true);
+        (void)registered;
+    }
+    return info;
+}
+
+/**
+ * @namespace Reflection
+ * @brief Generic tools generated from TypeInfo
+ */
+namespace Reflection {
+
+/**
+ * @brief Look up a component type's reflection data by ID
+ * @return TypeInfo, or nullptr if the type has not been reflected/registered yet
+ */
+const TypeInfo* FindComponentType(ComponentTypeID typeID);
+
+/**
+ * @brief Append a binary encoding of an object
+ *
+ * Plain-data ranges are memcpy'd; strings and vectors are length-prefixed.
+ * Transient fields are skipped. The encoding is host-endian.
+ */
+void Serialize(const TypeInfo& type, const void* object, std::vector<std::uint8_t>& out);
+
+/**
+ * @brief Read an object previously written by Serialize()
+ * @param cursor Read position, advanced past the object on success
+ * @param end End of the input buffer
+ * @return false if the input is truncated
+ */
+bool Deserialize(const TypeInfo& type, void* object, const std::uint8_t*& cursor, const std::uint8_t* end);
+
+/**
+ * @brief Append only the fields that differ from a baseline
+ *
+ * Writes a 64-bit mask of changed field indices followed by each changed
+ * field. An unchanged object costs 8 bytes.
+ *
+ * @return true if any field changed
+ */
+bool SerializeDelta(const TypeInfo& type, const void* baseline, const void* object, std::vector<std::uint8_t>& out);
+
+/**
+ * @brief Apply a delta written by SerializeDelta() on top of an object
+ * @return false if the input is truncated
+ */
+bool ApplyDelta(const TypeInfo& type, void* object, const std::uint8_t*& cursor, const std::uint8_t* end);
+
+/**
+ * @brief Compare one field of two objects
+ */
+bool FieldEquals(const FieldInfo& field, const void* a, const void* b);
+
+/**
+ * @brief Human-readable value of a field (for inspectors and logs)
+ */
+std::string FormatField(const FieldInfo& field, const void* object);
+
+/**
+ * @brief Heap memory owned by an object's strings and vectors
+ *
+ * Counts allocated capacity (not size). Strings held in the small-string
+ * buffer count as zero. Does not include sizeof the object itself.
+ */
+std::size_t HeapBytes(const TypeInfo& type, const void* object);
+
+/**
+ * @brief Typed helpers
+ */
+template<typename T>
+void Serialize(const T& object, std::vector<std::uint8_t>& out) {
+    Serialize(GetTypeInfo<T>(), &object, out);
+}
+
+template<typename T>
+bool Deserialize(T& object, const std::uint8_t*& cursor, const std::uint8_t* end) {
+    return Deserialize(GetTypeInfo<T>(), &object, cursor, end);
+}
+
+} // namespace Reflection
@@ -0,0 +1,117 @@
+/**
+ * @file Relationship.h
+ * @brief Entity-to-entity links with a reverse index
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include "Entity.h"
+#include <algorithm>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @enum Relation
+ * @brief Kinds of link an entity can hold to another entity
+ *
+ * Each source holds at most one link of each kind (an enemy targets one
+ * entity, a child has one parent).
+ */
+enum class Relation {
+    TARGETS,   ///< Source is attacking/chasing the target (aggro, threat)
+    CHILD_OF,  ///< Source is attached to a parent entity
+    OWNED_BY,  ///< Source (item, projectile, summon) belongs to the target
+    RELATION_COUNT
+};
+
+/// Number of relation kinds
+constexpr std::size_t RELATION_COUNT = static_cast<std::size_t>(Relation::RELATION_COUNT);
+
+/**
+ * @class RelationStore
+ * @brief Links of one relation kind, indexed in both directions
+ *
+ * Forward lookups (what does X target) and reverse lookups (who targets X)
+ * are both hash lookups; reverse lists are unordered and unlinking one
+ * source is O(k) in the number of sources sharing its target.
+ */
+class RelationStore {
+public:
+    /**
+     * @brief Link source to target, replacing any previous link
+     */
+    void Set(Entity source, Entity target) {
+        Remove(source);
+        m_targets[source.GetID()] = target;
+        m_sources[target.GetID()].push_back(source);
+    }
+
+    /**
+     * @brief Drop source's link
+     * @return true if source had a link
+     */
+    bool Remove(Entity source) {
+        auto targetIt = m_targets.find(source.GetID());
+        if (targetIt == m_targets.end()) {
+            return false;
+        }
+
+        auto sourcesIt = m_sources.find(targetIt->second.GetID());
+        std::vector<Entity>& sources = sourcesIt->second;
+        auto it = std::find(sources.begin(), sources.end(), source);
+        *it = sources.back();
+        sources.pop_back();
+        if (sources.empty()) {
+            m_sources.erase(sourcesIt);
+        }
+
+        m_targets.erase(targetIt);
+        return true;
+    }
+
+    /**
+     * @brief Target source links to
+     * @return Target, or an invalid Entity if source has no link
+     */
+    Entity GetTarget(Entity source) const {
+        auto it = m_targets.find(source.GetID());
+        return it != m_targets.end() ? it->second : Entity();
+    }
+
+    /**
+     * @brief Entities linking to target
+     * @return Sources in no particular order (empty if none)
+     */
+    const std::vector<Entity>& GetSources(Entity target) const {
+        static const std::vector<Entity> none;
+        auto it = m_sources.find(target.GetID());
+        return it != m_sources.end() ? it->second : none;
+    }
+
+    /**
+     * @brief Drop every link to and from an entity (on destruction)
+     * @param entity Entity being destroyed
+     */
+    void RemoveEntity(Entity entity) {
+        Remove(entity);
+
+        auto sourcesIt = m_sources.find(entity.GetID());
+        if (sourcesIt == m_sources.end()) {
+            return;
+        }
+        for (Entity source : sourcesIt->second) {
+            m_targets.erase(source.GetID());
+        }
+        m_sources.erase(sourcesIt);
+    }
+
+    /// Number of links held
+    std::size_t Size() const { return m_targets.size(); }
+
+private:
+    std::unordered_map<EntityID, Entity> m_targets;               ///< Source -> target
+    std::unordered_map<EntityID, std::vector<Entity>> m_sources;  ///< Target -> sources
+};
@@ -0,0 +1,170 @@
+/**
+ * @file SharedComponent.h
+ * @brief Shared (flyweight) component storage: one value per distinct instance
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include "Entity.h"
+#include "Reflection.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Type key for a component stored as a shared value
+ *
+ * `Shared<T>` has its own ComponentTypeID and signature bit, so systems and
+ * queries can require it (`Require<Shared<CombatStatsComponent>>()`) and
+ * observers can watch it, independently of per-entity T components.
+ */
+template<typename T>
+struct Shared {};
+
+/**
+ * @class SharedComponentPoolBase
+ * @brief Type-erased interface used by EntityManager and debug tools
+ */
+class SharedComponentPoolBase {
+public:
+    virtual ~SharedComponentPoolBase() = default;
+
+    /**
+     * @brief Drop an entity's reference (frees the value when unreferenced)
+     * @return true if the entity held a reference
+     */
+    virtual bool Release(EntityID entity) = 0;
+
+    /// Reflection data of the value type
+    virtual const TypeInfo& GetValueType() const = 0;
+
+    /// Value an entity references, or nullptr
+    virtual const Component* GetValue(EntityID entity) const = 0;
+
+    /// Number of distinct values currently stored
+    virtual std::size_t GetValueCount() const = 0;
+
+    /// Number of entities referencing a value
+    virtual std::size_t GetReferenceCount() const = 0;
+
+    /// Memory held by the stored values (objects plus string/vector heap)
+    virtual std::size_t GetBytes() const = 0;
+};
+
+/**
+ * @class SharedComponentPool
+ * @brief Interned, reference-counted values of one component type
+ *
+ * Equal values are stored once. Equality is decided on the reflected binary
+ * encoding, so T must have a Reflect<T> specialization; transient fields are
+ * ignored. Values are immutable while shared: changing one entity's value
+ * assigns it a different (possibly new) entry, leaving other entities alone.
+ *
+ * @tparam T Component type
+ */
+template<typename T>
+class SharedComponentPool : public SharedComponentPoolBase {
+    static_assert(HasReflection<T>::value, "Shared components need a Reflect<T> specialization");
+
+public:
+    /**
+     * @brief Point an entity at a value, interning it if new
+     * @param entity Entity ID
+     * @param value Value to share
+     * @return Stored value (stable until its last reference is released)
+     */
+    const T* Assign(EntityID entity, const T& value) {
+        std::vector<std::uint8_t> encoded;
+        Reflection::Serialize(value, encoded);
+        std::string key(encoded.begin(), encoded.end());
+
+        std::uint32_t index;
+        auto lookupIt = m_lookup.find(key);
+        if (lookupIt != m_lookup.end()) {
+            index = lookupIt->second;
+        } else {
+            index = AllocateEntry();
+            Entry& entry = *m_entries[index];
+            entry.value = value;
+            entry.value.owner = Entity(); // Owned by no single entity
+            entry.key = key;
+            m_lookup.emplace(std::move(key), index);
+        }
+
+        // Take the new reference before dropping the old one so re-assigning
+        // an equal value never frees the entry in between
+        ++m_entries[index]->references;
+        Release(entity);
+        m_entityValues[entity] = index;
+        return &m_entries[index]->value;
+    }
+
+    /**
+     * @brief Get the value an entity references
+     * @return Value, or nullptr if the entity has none
+     */
+    const T* Get(EntityID entity) const {
+        auto it = m_entityValues.find(entity);
+        return it != m_entityValues.end() ? &m_entries[it->second]->value : nullptr;
+    }
+
+    bool Release(EntityID entity) override {
+        auto it = m_entityValues.find(entity);
+        if (it == m_entityValues.end()) {
+            return false;
+        }
+
+        std::uint32_t index = it->second;
+        m_entityValues.erase(it);
+
+        Entry& entry = *m_entries[index];
+        if (--entry.references == 0) {
+            m_lookup.erase(entry.key);
+            m_entries[index].reset();
+            m_freeEntries.push_back(index);
+        }
+        return true;
+    }
+
+    const TypeInfo& GetValueType() const override { return GetTypeInfo<T>(); }
+    const Component* GetValue(EntityID entity) const override { return Get(entity); }
+    std::size_t GetValueCount() const override { return m_lookup.size(); }
+    std::size_t GetReferenceCount() const override { return m_entityValues.size(); }
+
+    std::size_t GetBytes() const override {
+        std::size_t bytes = 0;
+        for (const auto& entry : m_entries) {
+            if (entry) {
+                bytes += sizeof(T) + Reflection::HeapBytes(GetTypeInfo<T>(), &entry->value);
+            }
+        }
+        return bytes;
+    }
+
+private:
+    struct Entry {
+        T value;
+        std::string key;              ///< Reflected encoding (interning key)
+        std::uint32_t references = 0;
+    };
+
+    std::vector<std::unique_ptr<Entry>> m_entries;             ///< Stable addresses; null = free slot
+    std::vector<std::uint32_t> m_freeEntries;
+    std::unordered_map<std::string, std::uint32_t> m_lookup;   ///< Encoding -> entry index
+    std::unordered_map<EntityID, std::uint32_t> m_entityValues; ///< Entity -> entry index
+
+    std::uint32_t AllocateEntry() {
+        if (!m_freeEntries.empty()) {
+            std::uint32_t index = m_freeEntries.back();
+            m_freeEntries.pop_back();
+            m_entries[index] = std::make_unique<Entry>();
+            return index;
+        }
+        m_entries.push_back(std::make_unique<Entry>());
+        return static_cast<std::uint32_t>(m_entries.size() - 1);
+    }
+};
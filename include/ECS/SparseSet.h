@@ -0,0 +1,188 @@
+/**
+ * @file SparseSet.h
+ * @brief Sparse set of entities with O(1) insert, erase and membership tests
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include "Entity.h"
+#include <vector>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+/**
+ * @class SparseSet
+ * @brief Packed entity container indexed by entity ID
+ *
+ * Stores entities in a dense array for cache-friendly linear iteration and keeps
+ * a sparse array (indexed by EntityID) that maps each entity to its dense slot.
+ * Insertion appends to the dense array; erasure swaps the last element into the
+ * freed slot, so both are O(1). Iteration order is not sorted and changes when
+ * entities are erased.
+ *
+ * @example
+ * ```cpp
+ * SparseSet set;
+ * set.Insert(Entity(4));
+ * set.Insert(Entity(9));
+ * set.Erase(Entity(4));        // Entity 9 moves into slot 0
+ * for (Entity e : set) { ... } // Iterates the dense array
+ * ```
+ */
+class SparseSet {
+public:
+    using const_iterator = std::vector<Entity>::const_iterator;
+
+    /// Sentinel stored in the sparse array for IDs that are not present
+    static constexpr std::uint32_t NPOS = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief Insert an entity into the set
+     * @param entity Entity to insert
+     * @return true if inserted, false if already present or invalid
+     */
+    bool Insert(Entity entity) {
+        if (!entity.IsValid() || Contains(entity)) {
+            return false;
+        }
+
+        EntityID id = entity.GetID();
+        if (id >= m_sparse.size()) {
+            m_sparse.resize(static_cast<std::size_t>(id) + 1, NPOS);
+        }
+
+        m_sparse[id] = static_cast<std::uint32_t>(m_dense.size());
+        m_dense.push_back(entity);
+        return true;
+    }
+
+    /**
+     * @brief Remove an entity from the set (swap-and-pop)
+     * @param entity Entity to remove
+     * @return true if removed, false if not present
+     */
+    bool Erase(Entity entity) {
+        if (!Contains(entity)) {
+            return false;
+        }
+
+        std::uint32_t index = m_sparse[entity.GetID()];
+        Entity last = m_dense.back();
+
+        m_dense[index] = last;
+        m_sparse[last.GetID()] = index;
+
+        m_dense.pop_back();
+        m_sparse[entity.GetID()] = NPOS;
+        return true;
+    }
+
+    /**
+     * @brief Check whether an entity is in the set
+     * @param entity Entity to look up
+     * @return true if present
+     */
+    bool Contains(Entity entity) const {
+        EntityID id = entity.GetID();
+        return id < m_sparse.size() && m_sparse[id] != NPOS;
+    }
+
+    /**
+     * @brief Get the dense index of an entity
+     * @param entity Entity to look up
+     * @return Dense slot index, or NPOS if not present
+     */
+    std::uint32_t IndexOf(Entity entity) const {
+        EntityID id = entity.GetID();
+        return id < m_sparse.size() ? m_sparse[id] : NPOS;
+    }
+
+    /**
+     * @brief Swap the dense slots of two entries
+     *
+     * Keeps the sparse index consistent. Used to reorder the dense array
+     * (e.g. for spatial locality) without changing membership.
+     *
+     * @param a First dense index
+     * @param b Second dense index
+     */
+    void SwapAt(std::size_t a, std::size_t b) {
+        if (a == b) return;
+        std::swap(m_dense[a], m_dense[b]);
+        m_sparse[m_dense[a].GetID()] = static_cast<std::uint32_t>(a);
+        m_sparse[m_dense[b].GetID()] = static_cast<std::uint32_t>(b);
+    }
+
+    /**
+     * @brief Remove all entities
+     */
+    void Clear() {
+        m_dense.clear();
+        m_sparse.clear();
+    }
+
+    /**
+     * @brief Release memory left over from entities that are gone
+     *
+     * Trims sparse entries past the highest ID still present, then returns
+     * spare capacity once less than half of an array is in use (so sets that
+     * shrink and regrow each frame do not reallocate every time).
+     *
+     * @return true if any memory was released
+     */
+    bool ShrinkToFit() {
+        while (!m_sparse.empty() && m_sparse.back() == NPOS) {
+            m_sparse.pop_back();
+        }
+        bool released = ShrinkVector(m_sparse);
+        released = ShrinkVector(m_dense) || released;
+        return released;
+    }
+
+    /// Bytes allocated by the dense and sparse arrays
+    std::size_t GetReservedBytes() const {
+        return m_dense.capacity() * sizeof(Entity) + m_sparse.capacity() * sizeof(std::uint32_t);
+    }
+
+    /// Bytes the current entries need (dense slots plus sparse up to the highest ID present)
+    std::size_t GetUsedBytes() const {
+        std::size_t sparseUsed = m_sparse.size();
+        while (sparseUsed > 0 && m_sparse[sparseUsed - 1] == NPOS) {
+            --sparseUsed;
+        }
+        return m_dense.size() * sizeof(Entity) + sparseUsed * sizeof(std::uint32_t);
+    }
+
+    std::size_t Size() const { return m_dense.size(); }
+    bool Empty() const { return m_dense.empty(); }
+
+    Entity operator[](std::size_t index) const { return m_dense[index]; }
+
+    /**
+     * @brief Get the packed entity array
+     * @return Const reference to the dense array
+     */
+    const std::vector<Entity>& Dense() const { return m_dense; }
+
+    const_iterator begin() const { return m_dense.begin(); }
+    const_iterator end() const { return m_dense.end(); }
+
+private:
+    /// Arrays this small are never worth reallocating
+    static constexpr std::size_t MIN_SHRINK_CAPACITY = 64;
+
+    template<typename T>
+    static bool ShrinkVector(std::vector<T>& values) {
+        if (values.capacity() <= MIN_SHRINK_CAPACITY || values.size() * 2 > values.capacity()) {
+            return false;
+        }
+        values.shrink_to_fit();
+        return true;
+    }
+
+    std::vector<Entity> m_dense;          ///< Packed entities in iteration order
+    std::vector<std::uint32_t> m_sparse;  ///< EntityID -> dense index (NPOS if absent)
+};
@@ -0,0 +1,106 @@
+/**
+ * @file SteeringSystem.h
+ * @brief Flocking and steering for swarms using a per-frame neighbour grid
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include "System.h"
+#include "EntityManager.h"
+#include "Component.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class SteeringSystem
+ * @brief Separation, alignment, cohesion, seek and obstacle avoidance for SteeringComponent entities
+ *
+ * Each step:
+ * 1. Agent positions and velocities are copied into structure-of-arrays.
+ * 2. Agents are counting-sorted into a dense uniform grid (cell size = the
+ *    largest neighbour radius), so each grid row of the 3x3 neighbourhood
+ *    is one contiguous span of the sorted arrays.
+ * 3. Neighbour sums are accumulated over those spans with branch-free
+ *    masked arithmetic, a loop the compiler can vectorize.
+ * 4. The behaviours are combined, clamped to maxForce and maxSpeed, and
+ *    written to VelocityComponent; MovementSystem moves the agents.
+ *
+ * Obstacles are circles registered with AddObstacle(); agents steer away
+ * from them once within neighborRadius of their edge.
+ *
+ * @example
+ * ```cpp
+ * auto* steering = entityManager.AddSystem<SteeringSystem>();
+ * for (int i = 0; i < 200; ++i) {
+ *     Entity bat = entityManager.CreateEntity();
+ *     entityManager.AddComponent<TransformComponent>(bat, x, y);
+ *     entityManager.AddComponent<VelocityComponent>(bat);
+ *     auto* agent = entityManager.AddComponent<SteeringComponent>(bat, 90.0f);
+ *     agent->seekTarget = player;
+ *     agent->seekWeight = 0.5f;
+ * }
+ * ```
+ */
+class SteeringSystem : public System {
+public:
+    /// Entity query and further component access (used by SystemPipeline scheduling)
+    using Required = ComponentList<TransformComponent, VelocityComponent, SteeringComponent>;
+    using Excluded = ComponentList<DormantTag>;
+    using Reads = ComponentList<>;
+    using Writes = ComponentList<VelocityComponent>;
+
+    /**
+     * @brief Constructor - dormant agents are not steered
+     */
+    SteeringSystem() {
+        Require(Required{});
+        Exclude(Excluded{});
+    }
+
+    /**
+     * @brief Steer every agent for this step
+     * @param deltaTime Time elapsed since last update in seconds
+     */
+    void Update(float deltaTime) override;
+
+    /**
+     * @brief Add a circular obstacle agents steer around
+     * @param x Centre X
+     * @param y Centre Y
+     * @param radius Radius
+     */
+    void AddObstacle(float x, float y, float radius);
+
+    void ClearObstacles();
+
+    /// Neighbours found for all agents in the last step (pairs counted from both sides)
+    std::size_t GetNeighborCount() const { return m_neighborCount; }
+
+    const char* GetName() const override { return "SteeringSystem"; }
+
+private:
+    // Agents in grid order (structure of arrays)
+    std::vector<Entity> m_agents;
+    std::vector<float> m_x, m_y, m_vx, m_vy;
+    std::vector<int> m_flock;
+
+    // Gather scratch (system order) and the counting sort
+    std::vector<Entity> m_unsorted;
+    std::vector<std::uint32_t> m_cellOf;
+    std::vector<std::uint32_t> m_cellStart;  ///< Cell -> first sorted index (size cells + 1)
+    std::vector<std::uint32_t> m_cellNext;   ///< Scatter cursor per cell
+
+    float m_cellSize = 1.0f;
+    float m_originX = 0.0f;
+    float m_originY = 0.0f;
+    int m_columns = 0;
+    int m_rows = 0;
+    std::size_t m_neighborCount = 0;
+
+    std::vector<float> m_obstacleX, m_obstacleY, m_obstacleRadius;
+
+    void BuildGrid();
+    void SteerAgents(float deltaTime);
+};
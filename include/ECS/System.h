@@ -8,26 +8,53 @@
 #pragma once
 
 #include "Entity.h"
+#include "SparseSet.h"
+#include <chrono>
 #include <vector>
-#include <set>
 
 class EntityManager;
 
+/**
+ * @brief Compile-time list of component types
+ *
+ * Used by systems to declare their entity query
+ * (`using Required = ComponentList<...>; using Excluded = ComponentList<...>;`)
+ * and any further components they read and write
+ * (`using Reads = ComponentList<...>; using Writes = ComponentList<...>;`)
+ * so SystemPipeline can derive which systems may run side by side.
+ */
+template<typename... ComponentTypes>
+struct ComponentList {};
+
+/**
+ * @brief Stands for every component type in a Reads/Writes list
+ *
+ * Systems that hand control to game code while updating (collision
+ * callbacks, immediately dispatched events) write AnyComponent: the
+ * handler may touch anything.
+ */
+struct AnyComponent {};
+
 /**
  * @class System
  * @brief Abstract base class for all ECS systems
  *
  * Systems contain the logic that operates on entities with specific components.
- * Each system maintains a set of entities it's interested in and processes
- * them during the Update() call.
+ * A system declares the components it needs with Require<...>() in its
+ * constructor; the EntityManager then keeps the system's entity set up to date
+ * as components are added and removed, so GetEntities() never needs a scan.
  *
- * Systems are notified when entities are added or removed from the world,
- * allowing them to maintain their own entity lists based on component requirements.
+ * OnEntityAdded()/OnEntityRemoved() fire when an entity starts or stops matching
+ * the system's requirements (not when it is merely created or destroyed).
+ * Systems with no requirements are never given entities and query the
+ * EntityManager directly instead.
  *
  * @example
  * ```cpp
  * class MovementSystem : public System {
  * public:
+ *     MovementSystem() { Require<PositionComponent, VelocityComponent>(); }
+ *
  *     void Update(float deltaTime) override {
  *         for (Entity entity : GetEntities()) {
  *             auto* pos = m_entityManager->GetComponent<PositionComponent>(entity);
@@ -59,20 +86,20 @@ public:
     virtual void Update(float deltaTime) = 0;
 
     /**
-     * @brief Called when an entity is added to the world
+     * @brief Called when an entity starts matching this system's requirements
      *
-     * Override this method to check if the entity has the required components
-     * for this system and add it to the system's entity list if appropriate.
+     * The entity is already in GetEntities() and all required components
+     * are attached when this is called.
      *
      * @param entity The entity that was added
      */
     virtual void OnEntityAdded([[maybe_unused]] Entity entity) {}
 
     /**
-     * @brief Called when an entity is removed from the world
+     * @brief Called when an entity stops matching this system's requirements
      *
-     * Override this method to remove the entity from the system's entity list
-     * and perform any necessary cleanup.
+     * Fires before the triggering component is removed (or before the entity's
+     * components are destroyed), so components can still be read for cleanup.
      *
      * @param entity The entity that was removed
      */
@@ -88,27 +115,129 @@ public:
      */
     void SetEntityManager(EntityManager* manager) { m_entityManager = manager; }
 
+    /**
+     * @brief Get the component signature this system requires
+     * @return Signature with one bit set per required component type
+     */
+    const Signature& GetSignature() const { return m_signature; }
+
+    /**
+     * @brief Get the component types that keep an entity out of this system
+     * @return Signature with one bit set per excluded component type
+     */
+    const Signature& GetExclusions() const { return m_exclusions; }
+
+    /**
+     * @brief Whether an entity with the given components belongs in this system
+     * @param signature Entity's component signature
+     * @return true if it has every required and no excluded component type
+     */
+    bool Matches(const Signature& signature) const {
+        return m_signature.any() && (signature & m_signature) == m_signature && (signature & m_exclusions).none();
+    }
+
+    /**
+     * @brief Get the set of entities managed by this system
+     * @return Const reference to the entity set (dense, unordered)
+     */
+    const SparseSet& GetEntities() const { return m_entities; }
+
+    /**
+     * @brief Display name used by debug tools
+     * @return System name (override in derived systems)
+     */
+    virtual const char* GetName() const { return "System"; }
+
+    /**
+     * @brief Wall-clock duration of the most recent Update() call
+     * @return Milliseconds (0 until the system has been updated once)
+     */
+    float GetLastUpdateMs() const { return m_lastUpdateMs; }
+
+    /**
+     * @brief Records the duration of a system update (scope-based)
+     *
+     * Wrapped around Update() by EntityManager and SystemPipeline so per-system
+     * timings are available to the ECS inspector.
+     */
+    class UpdateTimer {
+    public:
+        explicit UpdateTimer(System& system)
+            : m_system(system), m_start(std::chrono::steady_clock::now()) {}
+
+        ~UpdateTimer() {
+            std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - m_start;
+            m_system.m_lastUpdateMs = elapsed.count();
+        }
+
+        UpdateTimer(const UpdateTimer&) = delete;
+        UpdateTimer& operator=(const UpdateTimer&) = delete;
+
+    private:
+        System& m_system;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
 protected:
     EntityManager* m_entityManager = nullptr; ///< Reference to the entity manager
-    std::set<Entity> m_entities;              ///< Set of entities this system processes
+    SparseSet m_entities;                     ///< Entities matching m_signature
+    Signature m_signature;                    ///< Required component types
+    Signature m_exclusions;                   ///< Component types that disqualify an entity
+    float m_lastUpdateMs = 0.0f;              ///< Duration of the last Update() (see UpdateTimer)
+
+    /**
+     * @brief Declare component types an entity must have to be processed
+     *
+     * Call from the derived system's constructor. Requirements accumulate.
+     *
+     * @tparam ComponentTypes Required component types
+     */
+    template<typename... ComponentTypes>
+    void Require() {
+        (m_signature.set(GetComponentTypeID<ComponentTypes>()), ...);
+    }
+
+    /// Require every type in a ComponentList (`Require(Required{})`)
+    template<typename... ComponentTypes>
+    void Require(ComponentList<ComponentTypes...>) {
+        Require<ComponentTypes...>();
+    }
+
+    /**
+     * @brief Declare component types (usually tags) that keep an entity out
+     *
+     * Call from the derived system's constructor, after Require<...>().
+     * Adding an excluded type to a member removes it from the system;
+     * removing the type puts it back.
+     *
+     * @tparam ComponentTypes Excluded component types
+     */
+    template<typename... ComponentTypes>
+    void Exclude() {
+        (m_exclusions.set(GetComponentTypeID<ComponentTypes>()), ...);
+    }
+
+    /// Exclude every type in a ComponentList (`Exclude(Excluded{})`)
+    template<typename... ComponentTypes>
+    void Exclude(ComponentList<ComponentTypes...>) {
+        Exclude<ComponentTypes...>();
+    }
 
     /**
      * @brief Add an entity to this system's processing list
      * @param entity The entity to add
+     * @return true if the entity was not already present
      */
-    void AddEntity(Entity entity) { m_entities.insert(entity); }
+    bool AddEntity(Entity entity) { return m_entities.Insert(entity); }
 
     /**
      * @brief Remove an entity from this system's processing list
      * @param entity The entity to remove
+     * @return true if the entity was present
      */
-    void RemoveEntity(Entity entity) { m_entities.erase(entity); }
+    bool RemoveEntity(Entity entity) { return m_entities.Erase(entity); }
 
-    /**
-     * @brief Get the set of entities managed by this system
-     * @return Const reference to the entity set
-     */
-    const std::set<Entity>& GetEntities() const { return m_entities; }
+    friend class EntityManager;
 };
 
 // Forward declarations for common systems
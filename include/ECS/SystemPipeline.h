@@ -0,0 +1,293 @@
+/**
+ * @file SystemPipeline.h
+ * @brief Compile-time system pipeline with static dispatch and derived access sets
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include "System.h"
+#include "EntityManager.h"
+#include <tuple>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace detail {
+
+/// true if T appears in the ComponentList
+template<typename T, typename List>
+struct ListContains : std::false_type {};
+
+template<typename T, typename... Ts>
+struct ListContains<T, ComponentList<Ts...>> : std::bool_constant<(std::is_same_v<T, Ts> || ...)> {};
+
+/// true if the ComponentList is empty
+template<typename List>
+struct ListEmpty : std::false_type {};
+
+template<>
+struct ListEmpty<ComponentList<>> : std::true_type {};
+
+/// true if two ComponentLists share at least one type (AnyComponent matches any non-empty list)
+template<typename A, typename B>
+struct ListsIntersect : std::false_type {};
+
+template<typename... As, typename B>
+struct ListsIntersect<ComponentList<As...>, B>
+    : std::bool_constant<(ListContains<As, B>::value || ...) ||
+                         (ListContains<AnyComponent, ComponentList<As...>>::value && !ListEmpty<B>::value) ||
+                         (ListContains<AnyComponent, B>::value && sizeof...(As) > 0)> {};
+
+/// Concatenation of ComponentLists
+template<typename... Lists>
+struct ListConcat { using Type = ComponentList<>; };
+
+template<typename... As>
+struct ListConcat<ComponentList<As...>> { using Type = ComponentList<As...>; };
+
+template<typename... As, typename... Bs, typename... Rest>
+struct ListConcat<ComponentList<As...>, ComponentList<Bs...>, Rest...>
+    : ListConcat<ComponentList<As..., Bs...>, Rest...> {};
+
+/// S::Required, or an empty list if the system declares none
+template<typename S, typename = void>
+struct RequiredOf { using Type = ComponentList<>; };
+
+template<typename S>
+struct RequiredOf<S, std::void_t<typename S::Required>> { using Type = typename S::Required; };
+
+/// S::Excluded, or an empty list if the system declares none
+template<typename S, typename = void>
+struct ExcludedOf { using Type = ComponentList<>; };
+
+template<typename S>
+struct ExcludedOf<S, std::void_t<typename S::Excluded>> { using Type = typename S::Excluded; };
+
+/// Everything S reads: its query (Required and Excluded, which it passes to
+/// Require()/Exclude()) plus any further Reads
+template<typename S>
+using ReadSet = typename ListConcat<typename RequiredOf<S>::Type,
+                                    typename ExcludedOf<S>::Type,
+                                    typename S::Reads>::Type;
+
+/// Detects `using Reads = ComponentList<...>` and `using Writes = ComponentList<...>`
+template<typename S, typename = void>
+struct HasAccessDeclaration : std::false_type {};
+
+template<typename S>
+struct HasAccessDeclaration<S, std::void_t<typename S::Reads, typename S::Writes>> : std::true_type {};
+
+/// true if every type in the pack is distinct
+template<typename... Ts>
+struct AllDistinct : std::true_type {};
+
+template<typename T, typename... Ts>
+struct AllDistinct<T, Ts...> : std::bool_constant<!(std::is_same_v<T, Ts> || ...) && AllDistinct<Ts...>::value> {};
+
+} // namespace detail
+
+/**
+ * @brief Whether two systems touch overlapping data
+ *
+ * Systems conflict if either writes a component the other reads or writes.
+ * A system's reads are its query (Required/Excluded) plus its Reads list;
+ * adding or removing a tag counts as writing it, since it changes which
+ * entities other systems see. A system without Reads/Writes declarations
+ * is assumed to touch everything.
+ */
+template<typename A, typename B>
+constexpr bool SystemsConflict() {
+    if constexpr (!detail::HasAccessDeclaration<A>::value || !detail::HasAccessDeclaration<B>::value) {
+        return true;
+    } else {
+        return detail::ListsIntersect<typename A::Writes, detail::ReadSet<B>>::value ||
+               detail::ListsIntersect<typename A::Writes, typename B::Writes>::value ||
+               detail::ListsIntersect<typename B::Writes, detail::ReadSet<A>>::value;
+    }
+}
+
+namespace detail {
+
+template<typename A, typename... Systems>
+constexpr std::array<bool, sizeof...(Systems)> BuildConflictRow() {
+    return {{SystemsConflict<A, Systems>()...}};
+}
+
+/// Pairwise conflict matrix for a system list
+template<typename... Systems>
+constexpr std::array<std::array<bool, sizeof...(Systems)>, sizeof...(Systems)> BuildConflictMatrix() {
+    return {{BuildConflictRow<Systems, Systems...>()...}};
+}
+
+/**
+ * @brief Assign stage indices: a new stage starts when a system conflicts
+ *        with any earlier system in the current stage (order is preserved)
+ */
+template<std::size_t N>
+constexpr std::array<std::size_t, N> BuildStages(const std::array<std::array<bool, N>, N>& conflicts) {
+    std::array<std::size_t, N> stages{};
+    std::size_t stage = 0;
+    std::size_t stageStart = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = stageStart; j < i; ++j) {
+            if (conflicts[i][j]) {
+                ++stage;
+                stageStart = i;
+                break;
+            }
+        }
+        stages[i] = stage;
+    }
+    return stages;
+}
+
+} // namespace detail
+
+/**
+ * @class SystemPipeline
+ * @brief Fixed set of systems stored by value and updated without virtual dispatch
+ *
+ * An optional alternative to EntityManager::AddSystem() for gameplay code with
+ * a known system list. Systems live in a std::tuple, Update() calls each one's
+ * Update() with a qualified (non-virtual, inlinable) call in declaration order,
+ * and Get<T>() resolves at compile time.
+ *
+ * The pipeline registers its systems with the EntityManager via AttachSystem(),
+ * so entity membership is maintained exactly as for dynamically added systems.
+ * EntityManager::Update() still processes destruction and observer events and
+ * updates any dynamically added systems (tools, optional systems).
+ *
+ * Systems may declare their query as `Required`/`Excluded` ComponentLists
+ * (passed to Require()/Exclude() so the two cannot drift) plus `Reads`/`Writes`
+ * for any further access. The pipeline derives a conflict matrix and groups
+ * consecutive non-conflicting systems into stages (GetStage()) that a
+ * scheduler could run concurrently. Writes are declared by hand, so updates
+ * stay sequential; the stage data is informational.
+ *
+ * @tparam Systems System types (each distinct, derived from System)
+ *
+ * @example
+ * ```cpp
+ * using GameplayPipeline = SystemPipeline<MovementSystem, CollisionSystem>;
+ * GameplayPipeline pipeline(entityManager);
+ * pipeline.Get<CollisionSystem>().SetCollisionCallback(...);
+ *
+ * entityManager.Update(deltaTime);  // destruction, observers, dynamic systems
+ * pipeline.Update(deltaTime);       // static systems
+ * ```
+ */
+template<typename... Systems>
+class SystemPipeline {
+    static_assert(sizeof...(Systems) > 0, "SystemPipeline needs at least one system");
+    static_assert((std::is_base_of_v<System, Systems> && ...), "Pipeline entries must derive from System");
+    static_assert(detail::AllDistinct<Systems...>::value, "Pipeline systems must be distinct types");
+
+public:
+    /// Number of systems in the pipeline
+    static constexpr std::size_t SIZE = sizeof...(Systems);
+
+private:
+    static constexpr auto CONFLICTS = detail::BuildConflictMatrix<Systems...>();
+    static constexpr auto STAGES = detail::BuildStages(CONFLICTS);
+
+public:
+
+    /**
+     * @brief Construct default-constructed systems and attach them
+     * @param manager Entity manager providing entities and components
+     */
+    explicit SystemPipeline(EntityManager& manager)
+        : m_manager(manager) {
+        Attach();
+    }
+
+    /**
+     * @brief Take pre-constructed systems (for systems with constructor arguments)
+     * @param manager Entity manager providing entities and components
+     * @param systems System instances, in pipeline order
+     */
+    SystemPipeline(EntityManager& manager, Systems... systems)
+        : m_manager(manager), m_systems(std::move(systems)...) {
+        Attach();
+    }
+
+    /**
+     * @brief Detach all systems from the entity manager
+     */
+    ~SystemPipeline() {
+        std::apply([this](auto&... system) { (m_manager.DetachSystem(&system), ...); }, m_systems);
+    }
+
+    SystemPipeline(const SystemPipeline&) = delete;
+    SystemPipeline& operator=(const SystemPipeline&) = delete;
+
+    /**
+     * @brief Update every system in declaration order
+     * @param deltaTime Time elapsed since last frame in seconds
+     */
+    void Update(float deltaTime) {
+        (UpdateSystem<Systems>(deltaTime), ...);
+    }
+
+    /**
+     * @brief Access a system by type (resolved at compile time)
+     * @tparam T System type
+     * @return Reference to the system
+     */
+    template<typename T>
+    T& Get() { return std::get<T>(m_systems); }
+
+    template<typename T>
+    const T& Get() const { return std::get<T>(m_systems); }
+
+    /**
+     * @brief Position of a system type in the pipeline
+     * @tparam T System type
+     * @return Zero-based index
+     */
+    template<typename T>
+    static constexpr std::size_t IndexOf() {
+        constexpr bool matches[] = {std::is_same_v<T, Systems>...};
+        for (std::size_t i = 0; i < SIZE; ++i) {
+            if (matches[i]) return i;
+        }
+        return SIZE;
+    }
+
+    /**
+     * @brief Whether the systems at two indices touch overlapping data
+     */
+    static constexpr bool Conflicts(std::size_t a, std::size_t b) {
+        return CONFLICTS[a][b];
+    }
+
+    /**
+     * @brief Stage index of the system at a pipeline index
+     *
+     * Systems sharing a stage are consecutive and pairwise conflict-free.
+     */
+    static constexpr std::size_t GetStage(std::size_t index) {
+        return STAGES[index];
+    }
+
+    /// Number of stages the pipeline splits into
+    static constexpr std::size_t STAGE_COUNT = STAGES[SIZE - 1] + 1;
+
+private:
+    EntityManager& m_manager;
+    std::tuple<Systems...> m_systems;
+
+    void Attach() {
+        std::apply([this](auto&... system) { (m_manager.AttachSystem(&system), ...); }, m_systems);
+    }
+
+    template<typename S>
+    void UpdateSystem(float deltaTime) {
+        S& system = std::get<S>(m_systems);
+        System::UpdateTimer timer(system);
+        // Qualified call: bypasses the vtable so the compiler can inline it
+        system.S::Update(deltaTime);
+    }
+};
@@ -0,0 +1,67 @@
+/**
+ * @file AtlasPacker.h
+ * @brief Shelf rectangle packer for texture atlas pages
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include <vector>
+
+/**
+ * @class AtlasPacker
+ * @brief Places rectangles into a fixed-size page, row ("shelf") by row
+ *
+ * Each rectangle goes onto the shortest open shelf it fits on, or starts a
+ * new shelf below the last one. Glyphs of one font size have similar
+ * heights, so shelves waste little space and insertion is a short scan.
+ * Nothing is ever removed; a full page is replaced by a new one.
+ *
+ * @example
+ * ```cpp
+ * AtlasPacker packer(512, 512);
+ * int x, y;
+ * if (packer.Insert(glyphW, glyphH, x, y)) {
+ *     SDL_UpdateTexture(page, &rect, pixels, pitch);  // rect at (x, y)
+ * }
+ * ```
+ */
+class AtlasPacker {
+public:
+    /// Empty pixels kept right of and below every rectangle (no filtering bleed)
+    static constexpr int PADDING = 1;
+
+    AtlasPacker(int width = 0, int height = 0) { Reset(width, height); }
+
+    /**
+     * @brief Empty the page and set its size
+     */
+    void Reset(int width, int height);
+
+    /**
+     * @brief Find room for a width x height rectangle
+     * @param[out] x,y Top-left corner in the page
+     * @return false if the page has no room left for it
+     */
+    bool Insert(int width, int height, int& x, int& y);
+
+    int GetWidth() const { return m_width; }
+    int GetHeight() const { return m_height; }
+
+    /// Pixels covered by inserted rectangles (including padding) / page pixels
+    float GetUsage() const;
+
+private:
+    struct Shelf {
+        int y;
+        int height;
+        int used;     ///< Width taken from the left edge
+    };
+
+    std::vector<Shelf> m_shelves;
+    int m_width = 0;
+    int m_height = 0;
+    int m_nextY = 0;  ///< Top of the next shelf
+    long m_area = 0;
+};
@@ -0,0 +1,75 @@
+/**
+ * @file DynamicResolution.h
+ * @brief Frame-time feedback controller for the world render scale
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+/**
+ * @class DynamicResolution
+ * @brief Picks a render scale that keeps frame work inside the frame budget
+ *
+ * Feed it the busy time of every frame (update + render, without the frame
+ * cap sleep). Once a full window of frames has been collected, the average
+ * is compared with the frame budget:
+ * - above dropThreshold x budget: lower the scale by one step
+ * - below raiseThreshold x budget: raise it by one step
+ *
+ * The gap between the two thresholds and clearing the window after every
+ * change are the hysteresis: the scale never flips back and forth between
+ * neighbouring steps because one frame was slow.
+ *
+ * @example
+ * ```cpp
+ * DynamicResolution::Settings settings;
+ * settings.minScale = 0.5f;
+ * controller.Configure(settings);
+ * // every frame:
+ * renderer->SetRenderScale(controller.Update(busyMs));
+ * ```
+ */
+class DynamicResolution {
+public:
+    /// Frames averaged before each decision
+    static constexpr int WINDOW = 30;
+
+    struct Settings {
+        bool enabled = false;
+        float minScale = 0.5f;        ///< Lowest world scale (fraction of the logical resolution)
+        float maxScale = 1.0f;        ///< Highest world scale
+        float step = 0.1f;            ///< Scale change per decision
+        float targetFrameMs = 1000.0f / 60.0f;
+        float dropThreshold = 0.9f;   ///< Lower the scale above this share of the budget
+        float raiseThreshold = 0.6f;  ///< Raise it below this share
+    };
+
+    DynamicResolution() { Reset(); }
+
+    /**
+     * @brief Apply settings and start again at the maximum scale
+     */
+    void Configure(const Settings& settings);
+
+    /**
+     * @brief Record a frame and return the scale to render the next frame at
+     * @param busyMs Milliseconds spent updating and rendering the frame
+     */
+    float Update(float busyMs);
+
+    /**
+     * @brief Forget collected frame times and return to the maximum scale
+     */
+    void Reset();
+
+    float GetScale() const { return m_scale; }
+    bool IsEnabled() const { return m_settings.enabled; }
+    const Settings& GetSettings() const { return m_settings; }
+
+private:
+    Settings m_settings;
+    float m_scale = 1.0f;
+    int m_frameCount = 0;
+    float m_frameSum = 0.0f;
+};
@@ -0,0 +1,125 @@
+/**
+ * @file ECSInspector.h
+ * @brief In-game overlay showing live ECS statistics and component values
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include "Engine/Renderer.h"
+#include "ECS/Entity.h"
+#include <string>
+#include <vector>
+
+class EntityManager;
+class InputManager;
+
+/**
+ * @class ECSInspector
+ * @brief Debug overlay for diagnosing slow levels
+ *
+ * Shows:
+ * - Total entity count
+ * - Per-component-type counts and memory (object size plus string/vector
+ *   heap, from reflection data)
+ * - Per-system entity counts and last update times
+ * - Field values of an entity picked with the mouse
+ * - Renderer draw calls and state calls made/skipped last frame
+ *
+ * The text is rebuilt at most REFRESH_INTERVAL times per second and drawn
+ * into a cached render-target texture, so an open inspector costs one texture
+ * copy per frame instead of thousands of BitmapFont rectangles. The time spent
+ * rebuilding is shown in the overlay itself.
+ *
+ * @example
+ * ```cpp
+ * if (keybindings.IsActionJustPressed(GameAction::DEBUG_TOGGLE, input)) {
+ *     inspector.Toggle();
+ * }
+ * inspector.HandleInput(*input, *renderer, entityManager, cameraX);
+ * inspector.Update(deltaTime, entityManager);
+ * inspector.Render(renderer);  // last, on top of the HUD
+ * ```
+ */
+class ECSInspector {
+public:
+    /// Seconds between statistics refreshes
+    static constexpr float REFRESH_INTERVAL = 0.25f;
+
+    ECSInspector() = default;
+
+    /**
+     * @brief Show or hide the overlay
+     */
+    void Toggle();
+
+    /**
+     * @brief Check whether the overlay is shown
+     */
+    bool IsVisible() const { return m_visible; }
+
+    /**
+     * @brief Select the entity under the mouse on left click
+     * @param input Input manager providing mouse state
+     * @param renderer Renderer that maps the window mouse position to logical coordinates
+     * @param manager Entity manager to pick from
+     * @param cameraX Horizontal camera offset (world x = logical x + cameraX)
+     */
+    void HandleInput(const InputManager& input, const Renderer& renderer, const EntityManager& manager, float cameraX);
+
+    /**
+     * @brief Refresh statistics when the refresh interval has elapsed
+     * @param deltaTime Time elapsed since last frame in seconds
+     * @param manager Entity manager to inspect
+     */
+    void Update(float deltaTime, const EntityManager& manager);
+
+    /**
+     * @brief Provide renderer counters shown on the next refresh
+     * @param stats Typically Renderer::GetLastFrameStats()
+     */
+    void SetRenderStats(const RenderStats& stats) { m_renderStats = stats; }
+
+    /**
+     * @brief Draw the cached overlay (redraws the layer only when text changed)
+     * @param renderer Renderer to draw with
+     */
+    void Render(Renderer* renderer);
+
+    /**
+     * @brief Clear the selection and cached text (e.g. after a level reset)
+     */
+    void Reset();
+
+    /**
+     * @brief Free the cached layer texture
+     *
+     * Call while the renderer is still alive (e.g. from a state's OnExit());
+     * textures are otherwise released together with their renderer.
+     */
+    void ReleaseResources();
+
+private:
+    bool m_visible = false;
+    Entity m_selected;                  ///< Entity whose fields are listed
+    float m_refreshTimer = 0.0f;
+    float m_lastRebuildMs = 0.0f;       ///< Cost of the last statistics rebuild
+    RenderStats m_renderStats;          ///< Renderer counters for the last frame
+    std::vector<std::string> m_lines;   ///< Overlay text, one entry per line
+    bool m_layerDirty = true;           ///< Text changed since the layer was drawn
+
+    SDL_Texture* m_layer = nullptr;     ///< Cached text layer (render target)
+    SDL_Renderer* m_layerOwner = nullptr;
+    int m_layerWidth = 0;               ///< Allocated texture size
+    int m_layerHeight = 0;
+    int m_contentWidth = 0;             ///< Size of the drawn panel within the texture
+    int m_contentHeight = 0;
+
+    void RebuildText(const EntityManager& manager);
+    void AppendComponentStats(const EntityManager& manager);
+    void AppendSystemStats(const EntityManager& manager);
+    void AppendSelection(const EntityManager& manager);
+    bool RedrawLayer(Renderer* renderer);
+    void DrawLines(Renderer* renderer, int x, int y) const;
+};
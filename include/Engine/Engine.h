@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "Engine/DynamicResolution.h"
 #include <memory>
 #include <chrono>
 
@@ -206,6 +207,14 @@ private:
      */
     void CapFrameRate();
 
+    /**
+     * @brief Read [visual] dynamic_resolution_* settings into m_dynamicResolution
+     *
+     * Only enabled when the renderer draws into a frame target
+     * (render_to_target), since the scale is applied to that target.
+     */
+    void ConfigureDynamicResolution();
+
 public:
     /**
      * @brief Recreate renderer using current config (applies VSync changes)
@@ -225,6 +234,7 @@ private:
     int m_targetFPS;                            ///< Target frames per second (default: 60)
     float m_deltaTime;                          ///< Time elapsed since last frame in seconds
     float m_fps;                                ///< Current frames per second
+    DynamicResolution m_dynamicResolution;      ///< World render scale from frame-time feedback
 
     /// High-resolution timestamp of the previous frame
     std::chrono::high_resolution_clock::time_point m_lastFrameTime;
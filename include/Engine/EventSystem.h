@@ -8,7 +8,11 @@
 #pragma once
 
 #include "ECS/Entity.h"
-#include <functional>
+#include "ECS/Component.h"
+#include "Engine/InplaceFunction.h"
+#include <algorithm>
+#include <type_traits>
+#include <utility>
 #include <unordered_map>
 #include <vector>
 #include <memory>
@@ -148,7 +152,8 @@ struct LevelUpEvent : public EventType<LevelUpEvent> {
  */
 class EventManager {
 public:
-    using EventHandler = std::function<void(const Event&)>;
+    /// Generic handler; room for the typed-handler wrapper plus its captures
+    using EventHandler = InplaceFunction<void(const Event&), 64>;
     
     EventManager() = default;
     ~EventManager() = default;
@@ -156,23 +161,24 @@ public:
     /**
      * @brief Subscribe to an event type
      * @tparam T Event type to subscribe to
+     * @tparam Handler Callable taking `const T&` (stored inline, no allocation)
      * @param handler Function to call when event is fired
      * @return Subscription ID for unsubscribing
      */
-    template<typename T>
-    int Subscribe(const std::function<void(const T&)>& handler) {
+    template<typename T, typename Handler>
+    int Subscribe(Handler&& handler) {
         static_assert(std::is_base_of_v<Event, T>, "T must derive from Event");
         
         int id = m_nextSubscriptionId++;
         std::type_index typeIndex(typeid(T));
         
         // Wrap the typed handler in a generic handler
-        EventHandler genericHandler = [handler](const Event& event) {
+        EventHandler genericHandler = [handler = std::forward<Handler>(handler)](const Event& event) mutable {
             const T& typedEvent = static_cast<const T&>(event);
             handler(typedEvent);
         };
         
-        m_subscribers[typeIndex].emplace_back(id, genericHandler);
+        m_subscribers[typeIndex].emplace_back(id, std::move(genericHandler));
         return id;
     }
     
@@ -0,0 +1,186 @@
+/**
+ * @file InplaceFunction.h
+ * @brief Fixed-capacity, allocation-free replacement for std::function
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template<typename Signature, std::size_t Capacity = 32>
+class InplaceFunction;
+
+/**
+ * @class InplaceFunction
+ * @brief Type-erased callable stored in a fixed inline buffer
+ *
+ * Behaves like std::function for the callbacks used by engine systems
+ * (collision, combat, events) but never allocates: the callable is stored
+ * directly inside the object. A callable that does not fit in Capacity bytes
+ * (or needs stricter alignment) is rejected at compile time, so large captures
+ * are caught instead of silently hitting the heap.
+ *
+ * Calls go through a single function pointer; copying and destruction go
+ * through a second "manager" pointer that is only touched on assignment.
+ *
+ * @tparam R Return type
+ * @tparam Args Argument types
+ * @tparam Capacity Inline storage size in bytes
+ *
+ * @example
+ * ```cpp
+ * InplaceFunction<void(const CollisionInfo&)> callback = [this](const CollisionInfo& info) {
+ *     OnCollision(info);
+ * };
+ * if (callback) callback(info);
+ * ```
+ */
+template<typename R, typename... Args, std::size_t Capacity>
+class InplaceFunction<R(Args...), Capacity> {
+public:
+    /// Inline storage size in bytes
+    static constexpr std::size_t CAPACITY = Capacity;
+
+    InplaceFunction() noexcept = default;
+    InplaceFunction(std::nullptr_t) noexcept {}
+
+    /**
+     * @brief Store a callable (lambda, functor or function pointer)
+     * @param callable Callable to store; must fit in Capacity bytes
+     */
+    template<typename F,
+             typename Decayed = std::decay_t<F>,
+             typename = std::enable_if_t<!std::is_same_v<Decayed, InplaceFunction> &&
+                                         std::is_invocable_r_v<R, Decayed&, Args...>>>
+    InplaceFunction(F&& callable) {
+        static_assert(sizeof(Decayed) <= Capacity,
+                      "Callable too large for InplaceFunction; capture less or raise Capacity");
+        static_assert(alignof(Decayed) <= alignof(std::max_align_t),
+                      "Callable alignment exceeds InplaceFunction storage alignment");
+        static_assert(std::is_copy_constructible_v<Decayed>, "Callable must be copyable");
+        static_assert(std::is_nothrow_move_constructible_v<Decayed>,
+                      "Callable must be nothrow move constructible (InplaceFunction moves are noexcept)");
+
+        if constexpr (std::is_pointer_v<Decayed> || std::is_member_pointer_v<Decayed>) {
+            if (callable == nullptr) {
+                return;
+            }
+        }
+
+        ::new (static_cast<void*>(m_storage)) Decayed(std::forward<F>(callable));
+        m_invoke = &Invoke<Decayed>;
+        m_manage = &Manage<Decayed>;
+    }
+
+    InplaceFunction(const InplaceFunction& other) {
+        CopyFrom(other);
+    }
+
+    InplaceFunction(InplaceFunction&& other) noexcept {
+        MoveFrom(other);
+    }
+
+    InplaceFunction& operator=(const InplaceFunction& other) {
+        if (this != &other) {
+            Reset();
+            CopyFrom(other);
+        }
+        return *this;
+    }
+
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    InplaceFunction& operator=(std::nullptr_t) noexcept {
+        Reset();
+        return *this;
+    }
+
+    ~InplaceFunction() {
+        Reset();
+    }
+
+    /**
+     * @brief Invoke the stored callable
+     *
+     * Calling an empty InplaceFunction is undefined; check with operator bool.
+     */
+    R operator()(Args... args) const {
+        return m_invoke(const_cast<unsigned char*>(m_storage), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Check whether a callable is stored
+     */
+    explicit operator bool() const noexcept { return m_invoke != nullptr; }
+
+    friend bool operator==(const InplaceFunction& f, std::nullptr_t) noexcept { return !f; }
+    friend bool operator!=(const InplaceFunction& f, std::nullptr_t) noexcept { return static_cast<bool>(f); }
+
+private:
+    enum class Operation { COPY, MOVE, DESTROY };
+
+    using Invoker = R (*)(void*, Args&&...);
+    using Manager = void (*)(Operation, void* destination, void* source);
+
+    alignas(std::max_align_t) unsigned char m_storage[Capacity];
+    Invoker m_invoke = nullptr;
+    Manager m_manage = nullptr;
+
+    template<typename F>
+    static R Invoke(void* storage, Args&&... args) {
+        return (*static_cast<F*>(storage))(std::forward<Args>(args)...);
+    }
+
+    template<typename F>
+    static void Manage(Operation operation, void* destination, void* source) {
+        switch (operation) {
+            case Operation::COPY:
+                ::new (destination) F(*static_cast<const F*>(source));
+                break;
+            case Operation::MOVE:
+                ::new (destination) F(std::move(*static_cast<F*>(source)));
+                static_cast<F*>(source)->~F();
+                break;
+            case Operation::DESTROY:
+                static_cast<F*>(destination)->~F();
+                break;
+        }
+    }
+
+    void CopyFrom(const InplaceFunction& other) {
+        if (other.m_invoke) {
+            other.m_manage(Operation::COPY, m_storage, const_cast<unsigned char*>(other.m_storage));
+            m_invoke = other.m_invoke;
+            m_manage = other.m_manage;
+        }
+    }
+
+    void MoveFrom(InplaceFunction& other) noexcept {
+        if (other.m_invoke) {
+            other.m_manage(Operation::MOVE, m_storage, other.m_storage);
+            m_invoke = other.m_invoke;
+            m_manage = other.m_manage;
+            other.m_invoke = nullptr;
+            other.m_manage = nullptr;
+        }
+    }
+
+    void Reset() noexcept {
+        if (m_invoke) {
+            m_manage(Operation::DESTROY, m_storage, nullptr);
+            m_invoke = nullptr;
+            m_manage = nullptr;
+        }
+    }
+};
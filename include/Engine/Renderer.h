@@ -13,6 +13,8 @@
 #include <unordered_map>
 #include <memory>
 
+class GlyphAtlas;
+
 /**
  * @struct Color
  * @brief RGBA color representation
@@ -173,9 +175,29 @@ public:
     SDL_Texture* GetSDLTexture() const { return m_texture; }
 
 private:
+    friend class Renderer;   ///< Renderer caches modulation state per texture
+
     SDL_Texture* m_texture;  ///< SDL texture handle (GPU memory)
     int m_width;             ///< Texture width in pixels
     int m_height;            ///< Texture height in pixels
+
+    Color m_colorMod;                  ///< Color/alpha modulation last set on m_texture (SDL default: white)
+    SDL_BlendMode m_blendMode;         ///< Blend mode last set through the Renderer
+    bool m_blendModeKnown;             ///< false until the Renderer has set m_blendMode
+};
+
+/**
+ * @struct RenderStats
+ * @brief Per-frame renderer counters
+ *
+ * "State calls" are SDL draw color, blend mode, render target and texture
+ * modulation changes. The Renderer remembers the current value of each and
+ * skips calls that would not change it.
+ */
+struct RenderStats {
+    int drawCalls = 0;           ///< Primitives and texture copies submitted
+    int stateCalls = 0;          ///< State changes passed on to SDL
+    int stateCallsSkipped = 0;   ///< State changes avoided because the value was already set
 };
 
 class Renderer {
@@ -201,16 +223,129 @@ public:
     void DrawTexture(std::shared_ptr<Texture> texture, const Rectangle& srcRect, const Rectangle& destRect);
     void DrawTexture(std::shared_ptr<Texture> texture, const Rectangle& srcRect, const Rectangle& destRect, bool flipHorizontal, bool flipVertical);
 
+    /**
+     * @brief Draw a batch of textured triangles in one call (e.g. text quads)
+     */
+    void DrawGeometry(SDL_Texture* texture, const SDL_Vertex* vertices, int vertexCount,
+                      const int* indices, int indexCount);
+
+    /**
+     * @brief Atlas shared by all TrueTypeFonts drawing with this renderer (created on first use)
+     */
+    GlyphAtlas& GetGlyphAtlas();
+
+    // Cached render state (skips SDL calls when the value is unchanged)
+    void SetDrawColor(const Color& color);
+    void SetBlendMode(SDL_BlendMode mode);
+    bool SetRenderTarget(SDL_Texture* target);  ///< false if SDL rejected the target
+    SDL_Texture* GetRenderTarget() const { return m_target; }
+    void SetTextureModulation(const std::shared_ptr<Texture>& texture, const Color& color);
+    void SetTextureBlendMode(const std::shared_ptr<Texture>& texture, SDL_BlendMode mode);
+
+    /**
+     * @brief Forget the cached state after drawing with raw SDL calls on GetSDLRenderer()
+     */
+    void InvalidateStateCache();
+
+    /**
+     * @brief Submit batched draw commands to the driver now
+     *
+     * Lets frame timing include the cost of this frame's draws instead of
+     * deferring it to Present().
+     */
+    void Flush();
+
+    /// Counters for the last presented frame
+    const RenderStats& GetLastFrameStats() const { return m_lastFrameStats; }
+
     // Getters
     SDL_Renderer* GetSDLRenderer() const { return m_renderer; }
     void GetLogicalSize(int& w, int& h) const;
     void UpdateLogicalToOutput();
 
+    /**
+     * @brief Convert a window position (e.g. SDL_GetMouseState) to logical coordinates
+     *
+     * Accounts for high-DPI output, letterbox bars and the frame target's
+     * upscale (the same rectangle Present() copies the frame to), so the
+     * result is in the coordinates drawing uses. Positions over the bars
+     * fall outside 0..logical size.
+     */
+    void WindowToLogical(int windowX, int windowY, float& logicalX, float& logicalY) const;
+
     // Utility: draw black bars for letterboxing/pillarboxing
     void DrawLetterboxBars(int logicalW, int logicalH);
 
+    /**
+     * @brief true when frames are drawn into a logical-size target and upscaled once in Present()
+     *
+     * Enabled with [visual] render_to_target. Each primitive is then drawn
+     * unscaled at the logical resolution and SDL scales only the final
+     * copy; letterbox bars come from clearing the window before that copy.
+     */
+    bool IsUsingFrameTarget() const { return m_frameTarget != nullptr; }
+
+    /**
+     * @brief Draw the world at a fraction of the logical resolution (frame target only)
+     *
+     * Applies from the next BeginWorldLayer(); frames that never call it
+     * (menus, combat, game over) stay at full resolution. Drawing keeps using logical
+     * coordinates; SDL scales them into the top-left part of the frame
+     * target, and Present() upscales only that part. The texture is never
+     * reallocated, so changing the scale every few frames is cheap.
+     *
+     * @param scale 0.1 to 1.0
+     */
+    void SetRenderScale(float scale);
+    float GetRenderScale() const { return m_renderScale; }
+
+    /**
+     * @brief Draw the world at the scale set by SetRenderScale()
+     *
+     * Call right after Clear(), before the first world primitive. Does
+     * nothing at full scale, without a frame target, or after BeginUILayer().
+     */
+    void BeginWorldLayer();
+
+    /**
+     * @brief Draw the rest of the frame (HUD, overlays) at full logical resolution
+     *
+     * Switches to a separate transparent layer that Present() blends over
+     * the upscaled world. Does nothing when the world is already at full
+     * scale or no frame target is in use.
+     */
+    void BeginUILayer();
+
 private:
     SDL_Renderer* m_renderer;
 
+    // Logical-resolution frame target (null = SDL logical size scaling)
+    bool m_renderToTarget = false;
+    SDL_Texture* m_frameTarget = nullptr;
+    int m_logicalWidth = 0;
+    int m_logicalHeight = 0;
+    bool m_integerScale = false;
+
+    // Dynamic resolution: world scale and the full-resolution UI layer
+    float m_renderScale = 1.0f;     ///< Requested by SetRenderScale()
+    float m_frameScale = 1.0f;      ///< Scale of the frame being drawn
+    SDL_Texture* m_uiTarget = nullptr;
+    bool m_uiLayerActive = false;   ///< BeginUILayer() was called this frame
+
+    // Render state as last set on m_renderer
+    Color m_drawColor;
+    bool m_drawColorKnown = false;
+    SDL_BlendMode m_drawBlendMode = SDL_BLENDMODE_NONE;
+    bool m_drawBlendModeKnown = false;
+    SDL_Texture* m_target = nullptr;
+
+    RenderStats m_frameStats;       ///< Frame in progress
+    RenderStats m_lastFrameStats;   ///< Snapshot taken by Present()
+
+    void ApplyLogicalSize(int logicalW, int logicalH, bool integerScale);
+    void DestroyFrameTarget();
+    SDL_Rect GetFrameDestination(int outW, int outH) const;
+
     std::unordered_map<std::string, std::shared_ptr<Texture>> m_textureCache;
+    std::unique_ptr<GlyphAtlas> m_glyphAtlas;
 };
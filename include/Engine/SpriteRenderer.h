@@ -8,7 +8,10 @@
 #pragma once
 
 #include "Renderer.h"
+#include "ECS/CollisionMask.h"
+#include <memory>
 #include <string>
+#include <vector>
 
 /**
  * @struct SpriteFrame
@@ -72,4 +75,20 @@ public:
      * @return SpriteFrame representing the specified frame
      */
     static SpriteFrame CreateFrame(int frameIndex, int frameWidth, int frameHeight, int framesPerRow = 1);
+
+    /**
+     * @brief Build a collision mask per frame from a sprite sheet's alpha channel
+     *
+     * Decodes the image once (no renderer needed) and keeps only the packed
+     * masks; call at load time, not per frame.
+     *
+     * @param texturePath Path to the sprite sheet
+     * @param frames Frames to build masks for
+     * @param scale Scale the sprite is drawn at
+     * @param alphaThreshold Alpha at or above which a pixel is solid
+     * @return One mask per frame, or nullptr if the image fails to load
+     */
+    static std::shared_ptr<const std::vector<CollisionMask>> LoadCollisionMasks(
+        const std::string& texturePath, const std::vector<SpriteFrame>& frames, float scale = 1.0f,
+        Uint8 alphaThreshold = CollisionMask::DEFAULT_ALPHA_THRESHOLD);
 };
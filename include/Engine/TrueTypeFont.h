@@ -0,0 +1,152 @@
+/**
+ * @file TrueTypeFont.h
+ * @brief SDL_ttf text drawn from a shared, persistent glyph atlas
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include "Engine/AtlasPacker.h"
+#include "Engine/Renderer.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct _TTF_Font;
+
+/**
+ * @class GlyphAtlas
+ * @brief Texture pages that glyphs from every TrueTypeFont are packed into
+ *
+ * Owned by the Renderer (Renderer::GetGlyphAtlas()), so pages live exactly
+ * as long as the SDL renderer that created them. Each instance gets a new
+ * generation number; fonts compare it to notice a recreated renderer and
+ * re-rasterize into the new atlas.
+ */
+class GlyphAtlas {
+public:
+    static constexpr int PAGE_SIZE = 512;
+
+    /// Where a glyph's pixels are stored
+    struct Slot {
+        int page = -1;
+        SDL_Rect rect{0, 0, 0, 0};
+    };
+
+    explicit GlyphAtlas(SDL_Renderer* renderer);
+    ~GlyphAtlas();
+
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+    /**
+     * @brief Copy a rasterized glyph into a page, opening a new page when all are full
+     * @param glyph Surface from TTF_RenderGlyph*_Blended (converted to ARGB8888 if needed)
+     * @param[out] slot Page and rectangle the glyph was stored at
+     */
+    bool Add(SDL_Surface* glyph, Slot& slot);
+
+    SDL_Texture* GetPage(int page) const { return m_pages[page].texture; }
+    int GetPageCount() const { return static_cast<int>(m_pages.size()); }
+    std::uint32_t GetGeneration() const { return m_generation; }
+
+private:
+    struct Page {
+        SDL_Texture* texture;
+        AtlasPacker packer;
+    };
+
+    SDL_Renderer* m_renderer;
+    std::vector<Page> m_pages;
+    std::uint32_t m_generation;
+
+    bool AddPage();
+};
+
+/**
+ * @class TrueTypeFont
+ * @brief Proportional text from a .ttf file, one textured quad per glyph
+ *
+ * Glyphs are rasterized in white the first time they are drawn and packed
+ * into the Renderer's GlyphAtlas; advances and kerning are cached on first
+ * use too. After that, drawing a string is layout from cached numbers plus
+ * one SDL_RenderGeometry call per atlas page it touches. The text color is
+ * carried by the vertex colors, so changing it costs nothing.
+ *
+ * Requires the engine to be built with SDL2_ttf (HAVE_SDL2_TTF); without
+ * it Load() fails and callers keep using BitmapFont.
+ *
+ * @example
+ * ```cpp
+ * TrueTypeFont font;
+ * if (font.Load("assets/fonts/ui.ttf", 18)) {
+ *     font.DrawText(renderer, "Score: 1200", 16, 16, Color(255, 255, 255));
+ *     int width = font.MeasureText("Score: 1200");
+ * }
+ * ```
+ */
+class TrueTypeFont {
+public:
+    TrueTypeFont() = default;
+    ~TrueTypeFont();
+
+    TrueTypeFont(const TrueTypeFont&) = delete;
+    TrueTypeFont& operator=(const TrueTypeFont&) = delete;
+
+    /**
+     * @brief Open a font file at a point size (closes any previous one)
+     * @return false if the file cannot be opened or SDL_ttf is unavailable
+     */
+    bool Load(const std::string& path, int pointSize);
+
+    void Free();
+
+    bool IsLoaded() const { return m_font != nullptr; }
+
+    /**
+     * @brief Draw UTF-8 text with its top-left corner at (x, y)
+     *
+     * '\n' starts a new line. Characters the font lacks take no space.
+     */
+    void DrawText(Renderer* renderer, const std::string& text, int x, int y, const Color& color);
+
+    /**
+     * @brief Width in pixels of the widest line of text
+     */
+    int MeasureText(const std::string& text);
+
+    int GetLineHeight() const { return m_lineSkip; }
+
+private:
+    /// Glyph images are line-sized: placed at the pen position on the line's top edge
+    struct Glyph {
+        bool measured = false;
+        bool rasterized = false;
+        int advance = 0;
+        GlyphAtlas::Slot slot;     ///< page -1 for glyphs with no pixels (space)
+    };
+
+    static constexpr std::int16_t KERNING_UNKNOWN = INT16_MIN;
+
+    _TTF_Font* m_font = nullptr;
+    int m_lineSkip = 0;
+
+    std::array<Glyph, 128> m_ascii;                   ///< Fast path for ASCII
+    std::unordered_map<std::uint32_t, Glyph> m_glyphs; ///< Everything else
+    std::vector<std::int16_t> m_asciiKerning;         ///< 128 x 128 pairs, KERNING_UNKNOWN until looked up
+    std::unordered_map<std::uint32_t, int> m_kerning; ///< Other BMP pairs (previous << 16 | codepoint)
+
+    std::uint32_t m_atlasGeneration = 0;  ///< Atlas the slots refer to (0 = none)
+
+    // Batch being built for one atlas page
+    std::vector<SDL_Vertex> m_vertices;
+    std::vector<int> m_indices;
+
+    Glyph& GetGlyph(std::uint32_t codepoint);
+    bool Rasterize(GlyphAtlas& atlas, std::uint32_t codepoint, Glyph& glyph);
+    int Kerning(std::uint32_t previous, std::uint32_t codepoint);
+    void ForgetRasterizedGlyphs();
+};
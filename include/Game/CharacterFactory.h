@@ -54,6 +54,7 @@ struct CharacterTemplate {
     std::string spritePath;
     int spriteWidth = 32;
     int spriteHeight = 32;
+    std::string collisionShape = "box"; ///< "box", "circle" or "capsule" inscribed in the sprite box
 
     // Audio
     std::string attackSound;
@@ -359,6 +360,22 @@ private:
             typeComp->jobId = tmpl.jobId;
         }
 
+        // Role tags (signature bits only) for cheap player/enemy queries
+        switch (tmpl.type) {
+            case CharacterTypeComponent::CharacterType::PLAYER:
+                m_entityManager->AddTag<PlayerTag>(entity);
+                break;
+            case CharacterTypeComponent::CharacterType::BOSS:
+                m_entityManager->AddTag<BossTag>(entity);
+                m_entityManager->AddTag<EnemyTag>(entity);
+                break;
+            case CharacterTypeComponent::CharacterType::ENEMY:
+                m_entityManager->AddTag<EnemyTag>(entity);
+                break;
+            default:
+                break;
+        }
+
         // Add health component
         m_entityManager->AddComponent<HealthComponent>(entity, tmpl.maxHealth, tmpl.armor, tmpl.healthRegen);
 
@@ -376,7 +393,8 @@ private:
         }
 
         // Add collision component
-        m_entityManager->AddComponent<CollisionComponent>(entity, static_cast<float>(tmpl.spriteWidth), static_cast<float>(tmpl.spriteHeight));
+        m_entityManager->AddComponent<CollisionComponent>(entity, static_cast<float>(tmpl.spriteWidth), static_cast<float>(tmpl.spriteHeight),
+                                                          CollisionComponent::ShapeFromName(tmpl.collisionShape));
 
         // Add AI component for non-player characters
         if (tmpl.hasAI && tmpl.type != CharacterTypeComponent::CharacterType::PLAYER) {
@@ -586,6 +604,7 @@ private:
         tmpl.spritePath = config.Get(sectionName, "sprite_path", "").AsString();
         tmpl.spriteWidth = config.Get(sectionName, "sprite_width", 32).AsInt();
         tmpl.spriteHeight = config.Get(sectionName, "sprite_height", 32).AsInt();
+        tmpl.collisionShape = config.Get(sectionName, "collision_shape", "box").AsString();
 
         // Fine-grained job/archetype id (optional)
         tmpl.jobId = config.Get(sectionName, "job", "").AsString();
@@ -0,0 +1,194 @@
+/**
+ * @file CombatAI.h
+ * @brief Compact battle model and time-sliced Monte Carlo search for enemy turns
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/**
+ * @namespace BattleRules
+ * @brief Damage rules shared by CombatState and the search model
+ *
+ * Keeping them in one place means the AI always plans with the rules the
+ * battle actually uses.
+ */
+namespace BattleRules {
+    constexpr int ATTACK_MIN = 15;      ///< Lowest physical attack roll
+    constexpr int ATTACK_ROLLS = 10;    ///< Physical rolls are ATTACK_MIN + [0, ATTACK_ROLLS)
+    constexpr int MAGIC_MIN = 22;       ///< Lowest spell roll
+    constexpr int MAGIC_ROLLS = 10;     ///< Spell rolls are MAGIC_MIN + [0, MAGIC_ROLLS)
+    constexpr float MAGIC_COST = 10.0f; ///< Mana per spell
+
+    /// Physical damage: roll plus the attacker's bonus, less the target's defense, halved when defending
+    inline float PhysicalDamage(int roll, float attackBonus, float defense, bool defending) {
+        float damage = static_cast<float>(roll) + attackBonus - defense;
+        damage = damage < 1.0f ? 1.0f : damage;
+        return defending ? static_cast<float>(static_cast<int>(damage * 0.5f + 0.5f)) : damage;
+    }
+
+    /// Spell damage ignores defense but is still halved by defending
+    inline float MagicDamage(int roll, bool defending) {
+        return defending ? static_cast<float>((roll + 1) / 2) : static_cast<float>(roll);
+    }
+}
+
+/**
+ * @struct BattleMove
+ * @brief One action for the acting unit
+ */
+struct BattleMove {
+    enum Type : std::uint8_t {
+        ATTACK, ///< Physical attack on target
+        DEFEND, ///< Halve incoming damage until the unit's next turn
+        MAGIC   ///< Spell on target (costs BattleRules::MAGIC_COST mana)
+    };
+
+    Type type = ATTACK;
+    std::int8_t target = -1; ///< Unit index (-1 for DEFEND)
+};
+
+/**
+ * @struct BattleUnit
+ * @brief Copyable snapshot of one combatant
+ */
+struct BattleUnit {
+    float health = 0.0f;
+    float maxHealth = 1.0f;
+    float mana = 0.0f;
+    float attackBonus = 0.0f; ///< Added to physical rolls
+    float defense = 0.0f;     ///< Subtracted from incoming physical damage
+    bool isPlayer = false;
+    bool isAlive = false;
+    bool defending = false;
+};
+
+/**
+ * @struct BattleState
+ * @brief Fixed-size, trivially copyable battle snapshot the search plays forward
+ *
+ * Units are stored in turn order; turn is the index of the unit about to
+ * act. Copying a state is a memcpy of a few hundred bytes, so playouts can
+ * clone it freely.
+ */
+struct BattleState {
+    static constexpr int MAX_UNITS = 8;
+    static constexpr int MAX_MOVES = 2 * MAX_UNITS + 1;
+
+    std::array<BattleUnit, MAX_UNITS> units{};
+    int count = 0;
+    int turn = 0;
+
+    /**
+     * @brief List the moves available to the unit at turn
+     *
+     * Enemies may attack, cast (with enough mana) or defend; players only
+     * attack, matching what their actions do in CombatState.
+     *
+     * @param out Receives up to MAX_MOVES moves
+     * @return Number of moves (0 if the battle is over or the actor is down)
+     */
+    int LegalMoves(BattleMove* out) const;
+
+    /**
+     * @brief Play a move for the unit at turn and pass the turn on
+     *
+     * Damage is rolled from rng. The turn moves to the next living unit,
+     * whose defend stance ends as its turn begins.
+     */
+    void Apply(const BattleMove& move, std::mt19937& rng);
+
+    /// true once one side has no living units
+    bool IsOver() const;
+
+    /**
+     * @brief Outcome from the enemies' point of view
+     * @return 1 if the players are all down, 0 if the enemies are, otherwise
+     *         0.5 plus half the difference in remaining health fractions
+     */
+    float Score() const;
+
+    /// Hand the turn to the next living unit after the current one
+    void AdvanceTurn();
+};
+
+/**
+ * @class CombatAI
+ * @brief Picks an enemy's move by Monte Carlo search, a slice at a time
+ *
+ * Each candidate move at the root is an arm of a UCB1 bandit. An iteration
+ * picks the arm with the best upper confidence bound, plays it on a copy of
+ * the root state, continues with a quick greedy/random playout policy for
+ * both sides up to a depth limit, and backs up BattleState::Score(). The
+ * most-visited move wins.
+ *
+ * Think() runs iterations until a wall-clock budget is spent, so the search
+ * can be spread over the frames of the enemy's action delay without
+ * stalling any of them. Difficulty scales with the iteration cap: a few
+ * dozen iterations plays loosely, a few thousand plays close to best.
+ *
+ * @example
+ * ```cpp
+ * ai.Begin(state, seed);
+ * // Every frame while the enemy "thinks"
+ * ai.Think(2.0);
+ * // When its turn resolves
+ * BattleMove move = ai.GetBestMove();
+ * ```
+ */
+class CombatAI {
+public:
+    static constexpr int DEFAULT_MAX_ITERATIONS = 2000;
+    static constexpr int DEFAULT_PLAYOUT_DEPTH = 12;
+
+    /**
+     * @brief Start a search for the unit at state.turn
+     * @param state Battle snapshot (copied)
+     * @param seed Random seed for damage rolls and playouts
+     */
+    void Begin(const BattleState& state, std::uint32_t seed);
+
+    /**
+     * @brief Run search iterations for up to budgetMs milliseconds
+     * @return true once the iteration cap is reached (or there is nothing to decide)
+     */
+    bool Think(double budgetMs);
+
+    /**
+     * @brief Best move found so far
+     *
+     * Before any iteration runs this is the first legal move (an attack on
+     * the first living opponent).
+     */
+    BattleMove GetBestMove() const;
+
+    bool IsDone() const { return m_iterations >= m_maxIterations || m_arms.size() <= 1; }
+    int GetIterations() const { return m_iterations; }
+
+    /// Set the search effort (difficulty)
+    void SetMaxIterations(int iterations) { m_maxIterations = iterations < 1 ? 1 : iterations; }
+    void SetPlayoutDepth(int depth) { m_playoutDepth = depth < 1 ? 1 : depth; }
+
+private:
+    struct Arm {
+        BattleMove move;
+        int visits = 0;
+        double reward = 0.0;
+    };
+
+    BattleState m_root;
+    std::vector<Arm> m_arms;
+    std::mt19937 m_rng;
+    int m_iterations = 0;
+    int m_maxIterations = DEFAULT_MAX_ITERATIONS;
+    int m_playoutDepth = DEFAULT_PLAYOUT_DEPTH;
+
+    void Iterate();
+    BattleMove PlayoutMove(const BattleState& state);
+};
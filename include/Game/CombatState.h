@@ -6,6 +6,7 @@
 #include "Game/GameConfig.h"
 #include "Game/GameStateManager.h"
 #include "Game/CharacterFactory.h"
+#include "Game/CombatAI.h"
 #include <memory>
 #include <vector>
 
@@ -49,10 +50,11 @@ struct CombatParticipant {
     float maxHealth;
     float currentMana;
     float maxMana;
+    bool defending;      ///< Halves incoming damage until this participant's next turn
 
     CombatParticipant(Entity e, bool player, float init)
         : entity(e), isPlayer(player), isAlive(true), turnOrder(0), initiative(init),
-          currentHealth(100.0f), maxHealth(100.0f), currentMana(30.0f), maxMana(30.0f) {}
+          currentHealth(100.0f), maxHealth(100.0f), currentMana(30.0f), maxMana(30.0f), defending(false) {}
 };
 
 /**
@@ -62,7 +64,7 @@ struct CombatParticipant {
  * Features:
  * - Turn-based combat with initiative order
  * - Player action selection (Attack, Defend, Magic, Item, Flee)
- * - AI enemy actions
+ * - AI enemy actions (Monte Carlo search, see CombatAI)
  * - Health/MP management
  * - Battle results and experience
  * - Smooth transitions back to playing state
@@ -113,6 +115,9 @@ private:
     CombatAction m_selectedAction;
     int m_selectedActionIndex;
     std::vector<CombatAction> m_availableActions;
+
+    // Enemy decision search, run a slice per frame during the action delay
+    CombatAI m_enemyAI;
     
     // Battle results
     int m_experienceGained;
@@ -153,6 +158,8 @@ private:
     void ExecuteAttack(Entity attacker, Entity target);
     void ExecuteDefend(Entity defender);
     void ExecuteMagic(Entity caster, Entity target);
+    void ApplyDamage(CombatParticipant& target, int damage);
+    BattleState BuildBattleState() const;
     bool AttemptFlee();
 
     // Battle state checks
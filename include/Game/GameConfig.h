@@ -128,6 +128,7 @@ public:
     int GetEnemyHeightRandomRange() const;
     int GetEnemyWidth() const;
     int GetEnemyHeight() const;
+    std::string GetEnemyCollisionShape() const;
 
     // Animation settings
     float GetAnimationFrameDuration() const;
@@ -164,6 +165,8 @@ public:
     float GetCriticalChance() const;
     float GetCriticalMultiplier() const;
     float GetFleeSuccessRate() const;
+    int GetEnemyAIIterations() const;       ///< Search effort per enemy turn (difficulty)
+    float GetEnemyAIFrameBudgetMs() const;  ///< Search time allowed per frame
 
     // Combat timing
     float GetTurnStartDelay() const;
@@ -0,0 +1,94 @@
+/**
+ * @file LevelStats.h
+ * @brief Incrementally maintained level aggregates for win checks and the HUD
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#pragma once
+
+#include "ECS/EntityManager.h"
+#include <unordered_map>
+
+/**
+ * @class LevelStats
+ * @brief Alive counts and enemy health totals kept current by component observers
+ *
+ * Subscribes to the player/enemy/boss tags and HealthComponent, so every read
+ * is O(1) no matter how many entities the level has. An entity counts as
+ * alive while it is tagged and its HealthComponent (if any) is not dead.
+ *
+ * In-place health changes must be reported with
+ * `EntityManager::MarkChanged<HealthComponent>()`.
+ *
+ * @example
+ * ```cpp
+ * m_entityManager = std::make_unique<EntityManager>();
+ * m_levelStats.Attach(*m_entityManager);
+ * // ...
+ * if (winOnDefeatAllEnemies && m_levelStats.GetAliveEnemies() == 0) { ... }
+ * ```
+ */
+class LevelStats {
+public:
+    LevelStats() = default;
+
+    /**
+     * @brief Start tracking a (new) entity manager
+     *
+     * Resets all totals and counts entities that already exist. The
+     * observers live in the manager, so attach again after recreating it.
+     * The LevelStats must outlive the manager's last structural change.
+     *
+     * @param manager Entity manager to track
+     */
+    void Attach(EntityManager& manager);
+
+    /// Alive entities tagged PlayerTag
+    int GetAlivePlayers() const { return m_alivePlayers; }
+
+    /// Alive entities tagged EnemyTag (bosses included)
+    int GetAliveEnemies() const { return m_aliveEnemies; }
+
+    /// Alive entities tagged BossTag
+    int GetAliveBosses() const { return m_aliveBosses; }
+
+    /// Whether any boss is still alive
+    bool IsBossAlive() const { return m_aliveBosses > 0; }
+
+    /// Current health summed over alive enemies
+    float GetTotalEnemyHealth() const { return m_enemyHealth; }
+
+    /// Maximum health summed over alive enemies
+    float GetTotalEnemyMaxHealth() const { return m_enemyMaxHealth; }
+
+private:
+    /// What one entity currently adds to the totals
+    struct Contribution {
+        bool player = false;
+        bool enemy = false;
+        bool boss = false;
+        float health = 0.0f;
+        float maxHealth = 0.0f;
+    };
+
+    EntityManager* m_manager = nullptr;
+    std::unordered_map<EntityID, Contribution> m_contributions;
+
+    int m_alivePlayers = 0;
+    int m_aliveEnemies = 0;
+    int m_aliveBosses = 0;
+    float m_enemyHealth = 0.0f;
+    float m_enemyMaxHealth = 0.0f;
+
+    void Reset();
+
+    /**
+     * @brief Replace an entity's contribution with one computed from its components
+     * @param entity Entity that changed
+     * @param removing Component type being detached right now (treated as absent)
+     */
+    void Refresh(Entity entity, ComponentTypeID removing = MAX_COMPONENT_TYPES);
+
+    void Apply(const Contribution& contribution, int sign);
+};
@@ -26,9 +26,16 @@
 #include "GameState.h"
 #include "ECS/EntityManager.h"      // Entity-Component-System management
 #include "ECS/CollisionSystem.h"    // Collision detection and response
+#include "ECS/MovementSystem.h"     // Velocity integration
+#include "ECS/BallisticSystem.h"    // Closed-form motion for off-screen movers
+#include "ECS/SystemPipeline.h"     // Statically dispatched gameplay systems
 #include "Game/GameConfig.h"        // Game configuration and settings
 #include "Game/CharacterFactory.h"  // Character creation and customization
 #include "Game/PlayerCustomization.h" // Player appearance and stats
+#include "Game/LevelStats.h"        // Alive counts for win checks and HUD
+#include "Engine/ECSInspector.h"    // Debug overlay for ECS statistics
+#include "Engine/KeybindingManager.h" // Configurable actions (debug toggle)
+#include "Engine/RenderQueue.h"     // Back-to-front sprite ordering
 #include <memory>
 
 /**
@@ -154,6 +161,18 @@ private:
      */
     std::unique_ptr<EntityManager> m_entityManager;
 
+    /// Fixed gameplay systems, updated without virtual dispatch
+    using GameplayPipeline = SystemPipeline<BallisticSystem, MovementSystem, CollisionSystem>;
+
+    /**
+     * @brief Core gameplay systems (dormancy, movement, collision)
+     *
+     * Owned here rather than by the EntityManager so their updates are
+     * statically dispatched. Must be destroyed before m_entityManager.
+     * Optional systems (audio) are still added dynamically.
+     */
+    std::unique_ptr<GameplayPipeline> m_systemPipeline;
+
     /**
      * @brief Game configuration system
      *
@@ -181,6 +200,14 @@ private:
      */
     Entity m_player;
 
+    /**
+     * @brief Alive enemy/boss counts and enemy HP, maintained by observers
+     *
+     * Re-attached whenever m_entityManager is recreated. Declared after it
+     * is not required: the manager never fires events while being destroyed.
+     */
+    LevelStats m_levelStats;
+
     // ========== GAME STATE VARIABLES ==========
 
     /**
@@ -277,8 +304,87 @@ private:
      */
     static constexpr float COLLISION_COOLDOWN_TIME = 1.0f;
 
+    /**
+     * @brief World units around the view in which ballistic enemies stay active
+     */
+    static constexpr float ACTIVE_REGION_MARGIN = 200.0f;
+
+    // ========== MEMORY LAYOUT ==========
+
+    /**
+     * @brief Time until component pools are next sorted by position
+     *
+     * Entities drift as they move; re-sorting periodically keeps nearby
+     * entities adjacent in memory for collision and AI neighbour queries.
+     */
+    float m_spatialSortTimer = 0.0f;
+
+    /**
+     * @brief Seconds between spatial sorts of transform/collision/AI pools
+     */
+    static constexpr float SPATIAL_SORT_INTERVAL = 1.0f;
+
+    /**
+     * @brief Whether component storage is being compacted over several frames
+     */
+    bool m_compactingStorage = false;
+
+    /**
+     * @brief Storage stats when the current compaction started (for the log)
+     */
+    StorageStats m_storageBeforeCompaction;
+
+    /**
+     * @brief Fragmentation left by the last compaction
+     *
+     * Spare chunks keep small worlds above zero, so compaction restarts only
+     * once churn has pushed fragmentation well past this level.
+     */
+    float m_compactedFragmentation = 0.0f;
+
+    /**
+     * @brief Fragmentation increase (0-1) that starts another compaction
+     */
+    static constexpr float STORAGE_COMPACT_THRESHOLD = 0.25f;
+
+    /**
+     * @brief Milliseconds per frame spent compacting storage
+     */
+    static constexpr float STORAGE_COMPACT_BUDGET_MS = 0.25f;
+
+    // ========== DEBUG TOOLS ==========
+
+    /**
+     * @brief Key bindings used for configurable actions (debug toggle)
+     */
+    std::unique_ptr<KeybindingManager> m_keybindings;
+
+    /**
+     * @brief Live ECS inspector overlay (toggled with GameAction::DEBUG_TOGGLE)
+     */
+    ECSInspector m_inspector;
+
+    // ========== SPRITE ORDERING ==========
+
+    /**
+     * @brief Orders the player and enemies by the screen Y of their feet
+     *
+     * Sprites lower on screen are drawn later, so they overlap the ones
+     * behind them. Indices returned by Sort() refer to m_drawList.
+     */
+    RenderQueue m_renderQueue;
+    std::vector<Entity> m_drawList;
+
     // ========== PRIVATE HELPER METHODS ==========
 
+    /**
+     * @brief Create the system pipeline and dynamic systems for m_entityManager
+     *
+     * Wires the collision callback and adds the audio system when an
+     * audio manager is available.
+     */
+    void CreateSystems();
+
     /**
      * @brief Create and configure the player character
      *
@@ -314,6 +420,16 @@ private:
      */
     void DrawHUD();
 
+    /**
+     * @brief Draw the animated player sprite (or shape fallback) at a screen position
+     */
+    void DrawPlayer(Renderer* renderer, int screenX, int screenY);
+
+    /**
+     * @brief Draw one ECS enemy from its sprite, or its render color as a fallback
+     */
+    void DrawEnemy(Renderer* renderer, Entity enemy, int screenX, int screenY);
+
     /**
      * @brief Check for game over conditions
      *
@@ -13,6 +13,7 @@
 
 AudioSystem::AudioSystem(AudioManager& audioManager) 
     : m_audioManager(audioManager) {
+    Require(Required{});
 }
 
 void AudioSystem::Update(float deltaTime) {
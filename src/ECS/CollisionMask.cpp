@@ -0,0 +1,180 @@
+/**
+ * @file CollisionMask.cpp
+ * @brief Implementation of 1-bit collision masks
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "ECS/CollisionMask.h"
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define COLLISION_MASK_SSE2 1
+#endif
+
+namespace {
+
+constexpr int WORD_BITS = 64;
+
+/// Word of a row shifted right by `shift` pixels, taken from words j-1 and j
+inline std::uint64_t ShiftedWord(const std::uint64_t* row, int j, int shift) {
+    if (shift == 0) {
+        return row[j];
+    }
+    return (row[j] << shift) | (row[j - 1] >> (WORD_BITS - shift));
+}
+
+} // namespace
+
+CollisionMask::CollisionMask(int width, int height)
+    : m_width(std::max(width, 0)),
+      m_height(std::max(height, 0)),
+      m_words((m_width + WORD_BITS - 1) / WORD_BITS),
+      m_stride(m_words + 2),
+      m_bits(static_cast<std::size_t>(m_stride) * m_height, 0),
+      m_mirroredBits(m_bits.size(), 0) {}
+
+CollisionMask CollisionMask::FromAlpha(const std::uint8_t* alpha, int width, int height, int rowStride,
+                                       int pixelStride, std::uint8_t threshold, float scale) {
+    if (!alpha || width <= 0 || height <= 0 || scale <= 0.0f) {
+        return CollisionMask();
+    }
+
+    int maskWidth = std::max(1, static_cast<int>(width * scale + 0.5f));
+    int maskHeight = std::max(1, static_cast<int>(height * scale + 0.5f));
+    CollisionMask mask(maskWidth, maskHeight);
+
+    for (int y = 0; y < maskHeight; ++y) {
+        int sourceY = std::min(height - 1, static_cast<int>(y / scale));
+        const std::uint8_t* sourceRow = alpha + static_cast<std::ptrdiff_t>(sourceY) * rowStride;
+        for (int x = 0; x < maskWidth; ++x) {
+            int sourceX = std::min(width - 1, static_cast<int>(x / scale));
+            if (sourceRow[static_cast<std::ptrdiff_t>(sourceX) * pixelStride] >= threshold) {
+                mask.Set(x, y);
+            }
+        }
+    }
+    return mask;
+}
+
+bool CollisionMask::Overlaps(const CollisionMask& a, int ax, int ay, bool aMirrored,
+                             const CollisionMask& b, int bx, int by, bool bMirrored) {
+    // Work in the frame of the left-hand mask so the other one only shifts right
+    if (bx < ax) {
+        return Overlaps(b, bx, by, bMirrored, a, ax, ay, aMirrored);
+    }
+
+    int offset = bx - ax;
+    int top = std::max(ay, by);
+    int bottom = std::min(ay + a.m_height, by + b.m_height);
+    if (offset >= a.m_width || top >= bottom) {
+        return false;
+    }
+
+    // Word k of a lines up with b's words k - wordShift - 1 and k - wordShift
+    int wordShift = offset / WORD_BITS;
+    int bitShift = offset % WORD_BITS;
+    int firstWord = wordShift;
+    int endWord = std::min(a.m_words, wordShift + b.m_words + 1);
+
+    for (int y = top; y < bottom; ++y) {
+        const std::uint64_t* rowA = a.Row(y - ay, aMirrored);
+        const std::uint64_t* rowB = b.Row(y - by, bMirrored) - wordShift;
+        int k = firstWord;
+
+#ifdef COLLISION_MASK_SSE2
+        // Two words per step; a shift count of 64 yields zero, so bitShift 0 needs no branch
+        const __m128i left = _mm_cvtsi32_si128(bitShift);
+        const __m128i right = _mm_cvtsi32_si128(WORD_BITS - bitShift);
+        __m128i hits = _mm_setzero_si128();
+        for (; k + 1 < endWord; k += 2) {
+            __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rowB + k));
+            __m128i previous = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rowB + k - 1));
+            __m128i shifted = _mm_or_si128(_mm_sll_epi64(current, left), _mm_srl_epi64(previous, right));
+            __m128i solid = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rowA + k));
+            hits = _mm_or_si128(hits, _mm_and_si128(solid, shifted));
+        }
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(hits, _mm_setzero_si128())) != 0xFFFF) {
+            return true;
+        }
+#endif
+
+        for (; k < endWord; ++k) {
+            if (rowA[k] & ShiftedWord(rowB, k, bitShift)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool CollisionMask::OverlapsRect(int x, int y, bool mirrored, int left, int top, int right, int bottom) const {
+    int x0 = std::max(left - x, 0);
+    int x1 = std::min(right - x, m_width);
+    int y0 = std::max(top - y, 0);
+    int y1 = std::min(bottom - y, m_height);
+    if (x0 >= x1 || y0 >= y1) {
+        return false;
+    }
+
+    int firstWord = x0 / WORD_BITS;
+    int lastWord = (x1 - 1) / WORD_BITS;
+    std::uint64_t firstBits = ~std::uint64_t(0) << (x0 % WORD_BITS);
+    std::uint64_t lastBits = ~std::uint64_t(0) >> (WORD_BITS - 1 - (x1 - 1) % WORD_BITS);
+    if (firstWord == lastWord) {
+        firstBits &= lastBits;
+    }
+
+    for (int row = y0; row < y1; ++row) {
+        const std::uint64_t* bits = Row(row, mirrored);
+        if (bits[firstWord] & firstBits) {
+            return true;
+        }
+        if (lastWord == firstWord) {
+            continue;
+        }
+        for (int k = firstWord + 1; k < lastWord; ++k) {
+            if (bits[k]) {
+                return true;
+            }
+        }
+        if (bits[lastWord] & lastBits) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CollisionMask::Set(int x, int y, bool solid) {
+    if (x < 0 || y < 0 || x >= m_width || y >= m_height) {
+        return;
+    }
+
+    auto update = [solid](std::uint64_t& word, int bit) {
+        std::uint64_t flag = std::uint64_t(1) << bit;
+        word = solid ? (word | flag) : (word & ~flag);
+    };
+    std::size_t row = static_cast<std::size_t>(y) * m_stride + 1;
+    int mirroredX = m_width - 1 - x;
+    update(m_bits[row + x / WORD_BITS], x % WORD_BITS);
+    update(m_mirroredBits[row + mirroredX / WORD_BITS], mirroredX % WORD_BITS);
+}
+
+bool CollisionMask::Test(int x, int y, bool mirrored) const {
+    if (x < 0 || y < 0 || x >= m_width || y >= m_height) {
+        return false;
+    }
+    return (Row(y, mirrored)[x / WORD_BITS] >> (x % WORD_BITS)) & 1;
+}
+
+int CollisionMask::CountSolid() const {
+    int count = 0;
+    for (std::uint64_t word : m_bits) {
+        while (word) {
+            word &= word - 1;
+            ++count;
+        }
+    }
+    return count;
+}
@@ -1,12 +1,13 @@
 /**
  * @file CollisionSystem.cpp
- * @brief Implementation of AABB collision detection system
+ * @brief Implementation of shape-aware collision detection system
  * @author Ryan Butler
  * @date 2025
  */
 
 #include "ECS/CollisionSystem.h"
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 
 /**
@@ -14,30 +15,30 @@
  *
  * Performs collision detection between all entities that have both
  * TransformComponent and CollisionComponent. Uses an O(n²) brute-force
- * approach suitable for arcade games with moderate entity counts.
+ * broad phase suitable for arcade games with moderate entity counts.
  *
  * Process:
- * 1. Get all entities with required components
- * 2. Check every pair of entities for collision (avoiding duplicates)
- * 3. Call collision callback for each detected collision
- * 4. Provide debug output periodically
+ * 1. Snapshot the system's entity set (callbacks may add/remove components)
+ * 2. Copy bounding boxes and shapes into dense per-shape arrays
+ * 3. Broad phase: every pair of bounding boxes (avoiding duplicates); each
+ *    overlapping pair goes to the batch for its shape combination
+ * 4. Narrow phase: one loop per shape combination over its whole batch
+ * 5. Call collision callback for each hit, in pair order
+ * 6. Provide debug output periodically
  *
  * @param deltaTime Time elapsed since last frame (unused for collision detection)
  *
  * @note Performance: O(n²) where n is number of collidable entities
  * @note Suitable for <100 entities; consider spatial partitioning for more
  * @note Debug output appears every 5 seconds to monitor entity count
- *
- * Optimization opportunities for large entity counts:
- * - Spatial partitioning (quadtree, grid)
- * - Broad phase / narrow phase separation
- * - Component-based filtering (collision layers)
+ * @note Shapes are tested where entities stood at the start of the update
  */
 void CollisionSystem::Update(float deltaTime) {
     (void)deltaTime; // Collision detection doesn't need frame timing
 
-    // Get all entities that can participate in collision detection
-    auto entities = m_entityManager->GetEntitiesWith<TransformComponent, CollisionComponent>();
+    // Snapshot the entities that can participate in collision detection.
+    // Callbacks may change membership, so don't iterate the live set.
+    m_frameEntities.assign(GetEntities().begin(), GetEntities().end());
 
     // Debug monitoring: Track entity count over time
     static int frameCount = 0;
@@ -46,146 +47,195 @@ void CollisionSystem::Update(float deltaTime) {
     // Output debug info every 300 frames (approximately every 5 seconds at 60 FPS)
     // This helps developers monitor performance and entity lifecycle
     if (frameCount % 300 == 0) {
-        std::cout << "🔍 CollisionSystem: Checking " << entities.size()
+        std::cout << "🔍 CollisionSystem: Checking " << m_frameEntities.size()
                   << " entities for collisions" << std::endl;
     }
 
-    // Brute-force collision detection: check every pair of entities
-    // This is O(n²) but suitable for arcade games with moderate entity counts
-    for (size_t i = 0; i < entities.size(); ++i) {
-        for (size_t j = i + 1; j < entities.size(); ++j) {
-            // Check collision between entities[i] and entities[j]
-            // Note: We start j at i+1 to avoid checking the same pair twice
-            CheckCollision(entities[i], entities[j]);
+    GatherShapes();
+    FindCandidates();
+    RunNarrowPhase();
+
+    for (const Candidate& candidate : m_candidates) {
+        if (candidate.hit) {
+            ReportCollision(candidate);
         }
     }
 }
 
 /**
- * @brief Check collision between two specific entities
+ * @brief Copy each snapshot entity's bounding box and shape into dense arrays
+ */
+void CollisionSystem::GatherShapes() {
+    std::size_t count = m_frameEntities.size();
+    m_left.resize(count);
+    m_top.resize(count);
+    m_right.resize(count);
+    m_bottom.resize(count);
+    m_shapes.resize(count);
+    m_shapeSlots.resize(count);
+    m_masked.resize(count);
+    m_shapeArrays.Clear();
+
+    for (std::size_t i = 0; i < count; ++i) {
+        Entity entity = m_frameEntities[i];
+        const auto* transform = m_entityManager->ReadComponent<TransformComponent>(entity);
+        const auto* collider = m_entityManager->ReadComponent<CollisionComponent>(entity);
+        const auto* mask = m_entityManager->ReadComponent<CollisionMaskComponent>(entity);
+
+        m_left[i] = transform->x;
+        m_top[i] = transform->y;
+        m_right[i] = transform->x + collider->width;
+        m_bottom[i] = transform->y + collider->height;
+        m_shapes[i] = collider->shape;
+        m_shapeSlots[i] = m_shapeArrays.Add(transform->x, transform->y, *collider);
+        m_masked[i] = mask && mask->Current();
+    }
+}
+
+/**
+ * @brief Brute-force broad phase over bounding boxes
  *
- * Performs AABB (Axis-Aligned Bounding Box) collision detection between
- * two entities. If a collision is detected, calls the registered collision
- * callback with detailed collision information.
+ * Every pair whose boxes overlap becomes a candidate and is appended to the
+ * batch of its shape combination, lower shape first.
+ */
+void CollisionSystem::FindCandidates() {
+    m_candidates.clear();
+    for (auto& batch : m_batches) {
+        batch.Clear();
+    }
+
+    std::size_t count = m_frameEntities.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        for (std::size_t j = i + 1; j < count; ++j) {
+            // Note: We start j at i+1 to avoid checking the same pair twice
+            float overlapX = std::min(m_right[i], m_right[j]) - std::max(m_left[i], m_left[j]);
+            float overlapY = std::min(m_bottom[i], m_bottom[j]) - std::max(m_top[i], m_top[j]);
+            if (overlapX <= 0.0f || overlapY <= 0.0f) {
+                continue;
+            }
+
+            std::size_t low = i, high = j;
+            if (m_shapes[j] < m_shapes[i]) {
+                std::swap(low, high);
+            }
+            auto& batch = m_batches[CollisionShapes::PairKind(m_shapes[low], m_shapes[high])];
+            batch.a.push_back(m_shapeSlots[low]);
+            batch.b.push_back(m_shapeSlots[high]);
+            batch.candidate.push_back(static_cast<std::uint32_t>(m_candidates.size()));
+            // Masks replace the grazing-edge tolerance for box pairs
+            batch.minOverlap.push_back(m_masked[i] || m_masked[j] ? 0.0f : MIN_OVERLAP);
+
+            m_candidates.push_back({static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(j),
+                                    overlapX, overlapY, false});
+        }
+    }
+}
+
+/**
+ * @brief Run each shape combination's batch through its pair test
  *
- * @param entityA First entity to check
- * @param entityB Second entity to check
+ * The test per batch comes from the compile-time CollisionShapes::PAIR_TESTS
+ * table, so there is one indirect call per shape combination per frame and
+ * none per pair.
+ */
+void CollisionSystem::RunNarrowPhase() {
+    for (int kind = 0; kind < CollisionShapes::PAIR_KIND_COUNT; ++kind) {
+        CollisionPairBatch& batch = m_batches[kind];
+        if (batch.a.empty()) {
+            continue;
+        }
+        batch.hit.assign(batch.a.size(), 0);
+        CollisionShapes::PAIR_TESTS[kind](m_shapeArrays, batch);
+        for (std::size_t i = 0; i < batch.hit.size(); ++i) {
+            m_candidates[batch.candidate[i]].hit = batch.hit[i] != 0;
+        }
+    }
+}
+
+/**
+ * @brief Confirm a narrow-phase hit and notify the game
  *
- * @note Both entities must have TransformComponent and CollisionComponent
- * @note Missing components are logged for debugging purposes
- * @note Collision callback is only called if collision is detected
- * @note Overlap values indicate how much the entities are intersecting
+ * Earlier callbacks may have removed components, so both entities are
+ * validated again. If either entity has a pixel mask, solid pixels must
+ * touch as well.
  *
- * Collision Detection Process:
- * 1. Validate both entities have required components
- * 2. Perform AABB collision test
- * 3. Calculate overlap amounts if collision detected
- * 4. Call collision callback with collision information
+ * @param candidate Pair that passed its shape test
  */
-void CollisionSystem::CheckCollision(Entity entityA, Entity entityB) {
+void CollisionSystem::ReportCollision(const Candidate& candidate) {
+    Entity entityA = m_frameEntities[candidate.a];
+    Entity entityB = m_frameEntities[candidate.b];
+
     // Get required components from both entities
     auto* transformA = m_entityManager->GetComponent<TransformComponent>(entityA);
     auto* collisionA = m_entityManager->GetComponent<CollisionComponent>(entityA);
     auto* transformB = m_entityManager->GetComponent<TransformComponent>(entityB);
     auto* collisionB = m_entityManager->GetComponent<CollisionComponent>(entityB);
 
-    // Validate that both entities have all required components
+    // Validate that both entities still have all required components
     if (!transformA || !collisionA || !transformB || !collisionB) {
         // Debug output to help identify component setup issues
-        // This helps developers ensure entities are properly configured
         if (!transformA) std::cout << "⚠️  Entity " << entityA.GetID() << " missing TransformComponent" << std::endl;
         if (!collisionA) std::cout << "⚠️  Entity " << entityA.GetID() << " missing CollisionComponent" << std::endl;
         if (!transformB) std::cout << "⚠️  Entity " << entityB.GetID() << " missing TransformComponent" << std::endl;
         if (!collisionB) std::cout << "⚠️  Entity " << entityB.GetID() << " missing CollisionComponent" << std::endl;
-        return; // Cannot perform collision detection without required components
+        return; // Cannot report a collision without required components
     }
 
-    // Perform AABB collision detection
-    float overlapX, overlapY;
-    if (AABB(transformA, collisionA, transformB, collisionB, overlapX, overlapY)) {
-        // Collision detected! Call the registered callback if one exists
-        if (m_collisionCallback) {
-            // Create collision information structure
-            CollisionInfo info;
-            info.entityA = entityA;      // First entity involved
-            info.entityB = entityB;      // Second entity involved
-            info.overlapX = overlapX;    // How much they overlap horizontally
-            info.overlapY = overlapY;    // How much they overlap vertically
-
-            // Notify the game logic about this collision
-            m_collisionCallback(info);
-        }
+    const auto* maskA = m_entityManager->ReadComponent<CollisionMaskComponent>(entityA);
+    const auto* maskB = m_entityManager->ReadComponent<CollisionMaskComponent>(entityB);
+    bool precise = (maskA && maskA->Current()) || (maskB && maskB->Current());
+    if (precise && !MasksOverlap(transformA, collisionA, maskA, transformB, collisionB, maskB)) {
+        return;
+    }
+
+    // Collision confirmed! Call the registered callback if one exists
+    if (m_collisionCallback) {
+        // Create collision information structure
+        CollisionInfo info;
+        info.entityA = entityA;                 // First entity involved
+        info.entityB = entityB;                 // Second entity involved
+        info.overlapX = candidate.overlapX;     // Bounding box overlap horizontally
+        info.overlapY = candidate.overlapY;     // Bounding box overlap vertically
+
+        // Notify the game logic about this collision
+        m_collisionCallback(info);
     }
 }
 
 /**
- * @brief Axis-Aligned Bounding Box collision detection
- *
- * Performs AABB collision detection between two rectangular entities.
- * This is the most common collision detection method for 2D games,
- * providing fast and reliable collision detection for rectangular objects.
- *
- * @param transformA Transform component of first entity
- * @param collisionA Collision component of first entity
- * @param transformB Transform component of second entity
- * @param collisionB Collision component of second entity
- * @param overlapX Output: horizontal overlap amount (if collision detected)
- * @param overlapY Output: vertical overlap amount (if collision detected)
+ * @brief Pixel-precise narrow phase for a box-overlapping pair
  *
- * @return true if entities are colliding, false otherwise
- *
- * @note Overlap values are only valid when return value is true
- * @note Uses top-left origin coordinate system (Y increases downward)
- * @note Collision boxes are axis-aligned (no rotation support)
- *
- * AABB Algorithm:
- * - Two rectangles collide if they overlap on BOTH X and Y axes
- * - X overlap: leftA < rightB AND rightA > leftB
- * - Y overlap: topA < bottomB AND bottomA > topB
- * - Overlap amounts help determine collision response (push-back direction)
- *
- * @example
- * ```cpp
- * float overlapX, overlapY;
- * if (AABB(transformA, collisionA, transformB, collisionB, overlapX, overlapY)) {
- *     // Collision detected!
- *     // overlapX and overlapY tell us how much they're intersecting
- *     // Use this for collision response (push entities apart)
- * }
- * ```
+ * Positions are floored to whole pixels. Two masks are compared with
+ * CollisionMask::Overlaps (64 pixels per word AND); a mask against an
+ * unmasked entity checks for solid pixels inside that entity's box.
  */
-bool CollisionSystem::AABB(const TransformComponent* transformA, const CollisionComponent* collisionA,
-                           const TransformComponent* transformB, const CollisionComponent* collisionB,
-                           float& overlapX, float& overlapY) {
-
-    // Calculate bounding box for entity A
-    // Top-left corner is at (transformA->x, transformA->y)
-    float leftA = transformA->x;                        // Left edge
-    float rightA = transformA->x + collisionA->width;   // Right edge
-    float topA = transformA->y;                         // Top edge
-    float bottomA = transformA->y + collisionA->height; // Bottom edge
-
-    // Calculate bounding box for entity B
-    // Top-left corner is at (transformB->x, transformB->y)
-    float leftB = transformB->x;                        // Left edge
-    float rightB = transformB->x + collisionB->width;   // Right edge
-    float topB = transformB->y;                         // Top edge
-    float bottomB = transformB->y + collisionB->height; // Bottom edge
-
-    // Compute overlap extents on both axes
-    float ox = std::min(rightA, rightB) - std::max(leftA, leftB);
-    float oy = std::min(bottomA, bottomB) - std::max(topA, topB);
-
-    // Require a small minimum overlap on both axes to consider it a collision
-    // This reduces "near-miss" sensitivity from grazing edges
-    constexpr float MIN_OVERLAP = 4.0f; // pixels
-
-    if (ox > MIN_OVERLAP && oy > MIN_OVERLAP) {
-        overlapX = ox;
-        overlapY = oy;
-        return true;
+bool CollisionSystem::MasksOverlap(const TransformComponent* transformA, const CollisionComponent* collisionA,
+                                   const CollisionMaskComponent* maskA,
+                                   const TransformComponent* transformB, const CollisionComponent* collisionB,
+                                   const CollisionMaskComponent* maskB) const {
+    const CollisionMask* shapeA = maskA ? maskA->Current() : nullptr;
+    const CollisionMask* shapeB = maskB ? maskB->Current() : nullptr;
+
+    auto pixel = [](float value) { return static_cast<int>(std::floor(value)); };
+
+    if (shapeA && shapeB) {
+        return CollisionMask::Overlaps(*shapeA, pixel(transformA->x + maskA->offsetX),
+                                       pixel(transformA->y + maskA->offsetY), maskA->flipHorizontal,
+                                       *shapeB, pixel(transformB->x + maskB->offsetX),
+                                       pixel(transformB->y + maskB->offsetY), maskB->flipHorizontal);
     }
 
-    // No collision detected
-    return false;
+    // Exactly one side is masked; the other is its solid box
+    auto maskAgainstBox = [&pixel](const TransformComponent* transform, const CollisionMaskComponent* mask,
+                                   const CollisionMask* shape,
+                                   const TransformComponent* boxTransform, const CollisionComponent* box) {
+        return shape->OverlapsRect(pixel(transform->x + mask->offsetX), pixel(transform->y + mask->offsetY),
+                                   mask->flipHorizontal,
+                                   pixel(boxTransform->x), pixel(boxTransform->y),
+                                   pixel(boxTransform->x + box->width), pixel(boxTransform->y + box->height));
+    };
+    if (shapeA) {
+        return maskAgainstBox(transformA, maskA, shapeA, transformB, collisionB);
+    }
+    return maskAgainstBox(transformB, maskB, shapeB, transformA, collisionA);
 }
@@ -66,7 +66,7 @@ void TurnManagementSystem::InitializeCombat(const std::vector<Entity>& participa
             auto* turnOrder = m_entityManager->AddComponent<TurnOrderComponent>(entity);
 
             // Set base initiative from combat stats or use default
-            if (auto* combatStats = m_entityManager->GetComponent<CombatStatsComponent>(entity)) {
+            if (const auto* combatStats = m_entityManager->ReadComponent<CombatStatsComponent>(entity)) {
                 turnOrder->initiative = combatStats->speed; // Speed determines initiative
             } else {
                 turnOrder->initiative = 10; // Default initiative for entities without combat stats
@@ -182,7 +182,7 @@ void CombatActionSystem::Update([[maybe_unused]] float deltaTime) {
 }
 
 void CombatActionSystem::ExecuteAttack(Entity attacker, Entity target) {
-    auto* attackerStats = m_entityManager->GetComponent<CombatStatsComponent>(attacker);
+    const auto* attackerStats = m_entityManager->ReadComponent<CombatStatsComponent>(attacker);
     auto* targetHealth = m_entityManager->GetComponent<HealthComponent>(target);
     
     if (!attackerStats || !targetHealth) {
@@ -278,7 +278,7 @@ bool CombatActionSystem::ExecuteFlee(Entity entity) {
 }
 
 float CombatActionSystem::CalculateDamage([[maybe_unused]] Entity attacker, Entity target, float baseDamage) {
-    auto* targetStats = m_entityManager->GetComponent<CombatStatsComponent>(target);
+    const auto* targetStats = m_entityManager->ReadComponent<CombatStatsComponent>(target);
     auto* targetTurnOrder = m_entityManager->GetComponent<TurnOrderComponent>(target);
     
     float damage = baseDamage;
@@ -308,7 +308,7 @@ float CombatActionSystem::CalculateDamage([[maybe_unused]] Entity attacker, Enti
 }
 
 bool CombatActionSystem::CheckHit(Entity attacker, [[maybe_unused]] Entity target) {
-    auto* attackerStats = m_entityManager->GetComponent<CombatStatsComponent>(attacker);
+    const auto* attackerStats = m_entityManager->ReadComponent<CombatStatsComponent>(attacker);
     float accuracy = attackerStats ? attackerStats->accuracy : (m_config ? m_config->GetAccuracyBase() : 85.0f);
     
     std::random_device rd;
@@ -319,7 +319,7 @@ bool CombatActionSystem::CheckHit(Entity attacker, [[maybe_unused]] Entity targe
 }
 
 bool CombatActionSystem::CheckCritical(Entity attacker) {
-    auto* attackerStats = m_entityManager->GetComponent<CombatStatsComponent>(attacker);
+    const auto* attackerStats = m_entityManager->ReadComponent<CombatStatsComponent>(attacker);
     float critChance = attackerStats ? attackerStats->criticalChance : (m_config ? m_config->GetCriticalChance() : 5.0f);
     
     std::random_device rd;
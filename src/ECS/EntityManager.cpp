@@ -6,7 +6,36 @@
  */
 
 #include "ECS/EntityManager.h"
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <limits>
+#include <numeric>
+
+namespace {
+
+/// Move the low 16 bits of v to the even bit positions
+std::uint32_t SpreadBits(std::uint32_t v) {
+    v &= 0x0000FFFF;
+    v = (v | (v << 8)) & 0x00FF00FF;
+    v = (v | (v << 4)) & 0x0F0F0F0F;
+    v = (v | (v << 2)) & 0x33333333;
+    v = (v | (v << 1)) & 0x55555555;
+    return v;
+}
+
+/// Z-order curve index of a 16-bit cell coordinate pair
+std::uint32_t MortonCode(std::uint32_t x, std::uint32_t y) {
+    return SpreadBits(x) | (SpreadBits(y) << 1);
+}
+
+/// Cell coordinate along one axis, clamped to the 16 bits a Morton code holds
+std::uint32_t CellCoordinate(float offset, float cellSize) {
+    float cell = std::min(offset / cellSize, 65535.0f);
+    return cell > 0.0f ? static_cast<std::uint32_t>(cell) : 0u;
+}
+
+} // namespace
 
 /**
  * @brief Constructor - initializes entity management system
@@ -38,7 +67,8 @@ EntityManager::~EntityManager() = default;
  *
  * @note Entity IDs are never reused (monotonically increasing)
  * @note New entity is automatically added to the active entity list
- * @note All registered systems are notified of the new entity
+ * @note Systems are not notified here; an entity joins a system once it has
+ *       all of the system's required components
  *
  * @example
  * ```cpp
@@ -51,12 +81,12 @@ Entity EntityManager::CreateEntity() {
     // Create entity with next available ID
     Entity entity(m_nextEntityID++);
 
-    // Add to active entity list
-    m_entities.push_back(entity);
-
-    // Notify all systems that a new entity was created
-    // Systems can then check if the entity has components they care about
-    NotifySystemsEntityAdded(entity);
+    // Add to active entity list with an empty signature
+    m_entities.Insert(entity);
+    if (entity.GetID() >= m_signatures.size()) {
+        m_signatures.resize(static_cast<std::size_t>(entity.GetID()) + 1);
+    }
+    m_signatures[entity.GetID()].reset();
 
     return entity;
 }
@@ -101,8 +131,8 @@ void EntityManager::DestroyEntity(Entity entity) {
  *
  * @return true if entity is valid and active, false otherwise
  *
- * @note Returns false for entities marked for destruction but not yet processed
- * @note Linear search - O(n) complexity, suitable for moderate entity counts
+ * @note Entities marked for destruction stay valid until the next Update()
+ * @note Constant time - backed by a sparse set indexed by entity ID
  *
  * @example
  * ```cpp
@@ -113,49 +143,469 @@ void EntityManager::DestroyEntity(Entity entity) {
  * ```
  */
 bool EntityManager::IsEntityValid(Entity entity) const {
-    return std::find(m_entities.begin(), m_entities.end(), entity) != m_entities.end();
+    return m_entities.Contains(entity);
+}
+
+Signature EntityManager::GetSignature(Entity entity) const {
+    if (!IsEntityValid(entity)) {
+        return Signature();
+    }
+    return m_signatures[entity.GetID()];
+}
+
+const Component* EntityManager::GetComponent(Entity entity, ComponentTypeID typeID) const {
+    if (!IsEntityValid(entity) || typeID >= MAX_COMPONENT_TYPES ||
+        !m_signatures[entity.GetID()].test(typeID)) {
+        return nullptr;
+    }
+
+    return m_pools[typeID] ? m_pools[typeID]->Find(entity) : nullptr;
+}
+
+std::size_t EntityManager::GetComponentCount(ComponentTypeID typeID) const {
+    if (typeID >= MAX_COMPONENT_TYPES) {
+        return 0;
+    }
+    if (m_sharedPools[typeID]) {
+        return m_sharedPools[typeID]->GetReferenceCount();
+    }
+
+    if (m_pools[typeID]) {
+        return m_pools[typeID]->Size();
+    }
+
+    // Tags have no storage; count the signature bits
+    std::size_t count = 0;
+    for (Entity entity : m_entities) {
+        if (m_signatures[entity.GetID()].test(typeID)) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Set a component type bit after its storage has been updated
+ *
+ * If the bit was already set (replacement) only CHANGED observers fire;
+ * otherwise system membership is updated and ADDED observers fire.
+ */
+void EntityManager::SetComponentBit(Entity entity, ComponentTypeID typeID) {
+    Signature oldSignature = m_signatures[entity.GetID()];
+    if (oldSignature.test(typeID)) {
+        NotifyObservers(typeID, ComponentEvent::CHANGED, entity);
+        return;
+    }
+
+    Signature newSignature = oldSignature;
+    newSignature.set(typeID);
+    m_signatures[entity.GetID()] = newSignature;
+    UpdateSystemMembership(entity, oldSignature, newSignature);
+    NotifyObservers(typeID, ComponentEvent::ADDED, entity);
+}
+
+/**
+ * @brief Detach any kind of component (stored, tag or shared) by type ID
+ */
+void EntityManager::RemoveComponentByID(Entity entity, ComponentTypeID typeID) {
+    if (!IsEntityValid(entity) || !m_signatures[entity.GetID()].test(typeID)) {
+        return;
+    }
+
+    // Notify observers and systems first so they can still read the component
+    NotifyObservers(typeID, ComponentEvent::REMOVED, entity);
+
+    Signature oldSignature = m_signatures[entity.GetID()];
+    Signature newSignature = oldSignature;
+    newSignature.reset(typeID);
+    UpdateSystemMembership(entity, oldSignature, newSignature);
+    m_signatures[entity.GetID()] = newSignature;
+
+    if (m_pools[typeID]) {
+        m_pools[typeID]->Remove(entity);
+    }
+    if (m_sharedPools[typeID]) {
+        m_sharedPools[typeID]->Release(entity.GetID());
+    }
+}
+
+/**
+ * @brief Reorder pools and system entity lists by Morton code of position
+ *
+ * Entities without a TransformComponent sort after all positioned ones.
+ * Ties (same cell) keep their current relative order, so repeated sorts of a
+ * mostly static scene move almost nothing.
+ */
+void EntityManager::SortByMortonKeys(const std::vector<ComponentTypeID>& typeIDs, float cellSize) {
+    ComponentPool<TransformComponent>* transforms = GetPool<TransformComponent>();
+    if (!transforms || transforms->Size() == 0 || cellSize <= 0.0f) {
+        return;
+    }
+
+    // Measure cells from the occupied area's corner so 16 bits per axis go far
+    float minX = std::numeric_limits<float>::max();
+    float minY = std::numeric_limits<float>::max();
+    for (std::size_t i = 0; i < transforms->Size(); ++i) {
+        minX = std::min(minX, transforms->Slot(i).x);
+        minY = std::min(minY, transforms->Slot(i).y);
+    }
+
+    constexpr std::uint32_t UNPOSITIONED = std::numeric_limits<std::uint32_t>::max();
+    std::vector<std::uint32_t> keys(m_signatures.size(), UNPOSITIONED); // EntityID -> Morton code
+    for (std::size_t i = 0; i < transforms->Size(); ++i) {
+        const TransformComponent& transform = transforms->Slot(i);
+        keys[transforms->GetEntities()[i].GetID()] =
+            MortonCode(CellCoordinate(transform.x - minX, cellSize), CellCoordinate(transform.y - minY, cellSize));
+    }
+
+    std::vector<std::uint32_t> order;
+    auto computeOrder = [&](const SparseSet& entities) {
+        order.resize(entities.Size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) {
+            std::uint32_t keyA = keys[entities[a].GetID()];
+            std::uint32_t keyB = keys[entities[b].GetID()];
+            return keyA != keyB ? keyA < keyB : a < b;
+        });
+    };
+
+    for (ComponentTypeID typeID : typeIDs) {
+        if (typeID < MAX_COMPONENT_TYPES && m_pools[typeID]) {
+            computeOrder(m_pools[typeID]->GetEntities());
+            m_pools[typeID]->Permute(order);
+        }
+    }
+
+    // Systems iterate their own entity lists; visit entities in the same order
+    const ComponentTypeID transformID = GetComponentTypeID<TransformComponent>();
+    for (System* system : m_trackedSystems) {
+        if (system->GetSignature().test(transformID)) {
+            computeOrder(system->m_entities);
+            detail::ApplyPermutation(order, [system](std::size_t a, std::size_t b) {
+                system->m_entities.SwapAt(a, b);
+            });
+        }
+    }
+}
+
+StorageStats EntityManager::GetStorageStats() const {
+    StorageStats stats;
+    for (const auto& pool : m_pools) {
+        if (pool) {
+            stats += pool->GetStats();
+        }
+    }
+    return stats;
+}
+
+bool EntityManager::CompactStorage(float budgetMs) {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point deadline = Clock::now() +
+        std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float, std::milli>(budgetMs));
+
+    // Targets: every pool slot, then each tracked system's entity list, then m_entities
+    const std::size_t targetCount = MAX_COMPONENT_TYPES + m_trackedSystems.size() + 1;
+    do {
+        if (m_compactCursor >= targetCount) {
+            m_compactCursor = 0; // Systems were removed since the last call
+        }
+
+        std::size_t target = m_compactCursor++;
+        if (target < MAX_COMPONENT_TYPES) {
+            if (m_pools[target]) {
+                m_pools[target]->ShrinkToFit();
+            }
+        } else if (target - MAX_COMPONENT_TYPES < m_trackedSystems.size()) {
+            m_trackedSystems[target - MAX_COMPONENT_TYPES]->m_entities.ShrinkToFit();
+        } else {
+            m_entities.ShrinkToFit();
+        }
+
+        if (m_compactCursor == targetCount) {
+            m_compactCursor = 0;
+            return true;
+        }
+    } while (Clock::now() < deadline);
+
+    return false;
+}
+
+void EntityManager::SetRelation(Entity source, Relation relation, Entity target) {
+    if (!IsEntityValid(source) || !IsEntityValid(target)) {
+        return;
+    }
+    m_relations[static_cast<std::size_t>(relation)].Set(source, target);
+}
+
+void EntityManager::RemoveRelation(Entity source, Relation relation) {
+    m_relations[static_cast<std::size_t>(relation)].Remove(source);
+}
+
+Entity EntityManager::GetRelation(Entity source, Relation relation) const {
+    return m_relations[static_cast<std::size_t>(relation)].GetTarget(source);
+}
+
+const std::vector<Entity>& EntityManager::GetRelationSources(Relation relation, Entity target) const {
+    return m_relations[static_cast<std::size_t>(relation)].GetSources(target);
 }
 
 void EntityManager::Update(float deltaTime) {
     // Process entity destruction
     ProcessEntityDestruction();
+
+    // Sync point: deliver observer events buffered since the last update
+    FlushObserverEvents();
     
     // Update all systems
     for (auto& system : m_systems) {
+        System::UpdateTimer timer(*system);
         system->Update(deltaTime);
     }
 }
 
 void EntityManager::ProcessEntityDestruction() {
     for (Entity entity : m_entitiesToDestroy) {
-        // Remove from entities list
-        auto it = std::find(m_entities.begin(), m_entities.end(), entity);
-        if (it != m_entities.end()) {
-            m_entities.erase(it);
+        // Skip duplicates queued more than once in the same frame
+        if (!m_entities.Contains(entity)) {
+            continue;
+        }
+
+        // Notify observers and drop out of every system while components are still readable
+        Signature signature = m_signatures[entity.GetID()];
+        for (ComponentTypeID typeID = 0; typeID < MAX_COMPONENT_TYPES; ++typeID) {
+            if (signature.test(typeID)) {
+                NotifyObservers(typeID, ComponentEvent::REMOVED, entity);
+            }
         }
-        
-        // Remove all components
-        for (auto& componentMap : m_components) {
-            componentMap.second.erase(entity.GetID());
+        UpdateSystemMembership(entity, signature, Signature());
+        m_signatures[entity.GetID()].reset();
+
+        // Remove all components and shared value references
+        for (ComponentTypeID typeID = 0; typeID < MAX_COMPONENT_TYPES; ++typeID) {
+            if (!signature.test(typeID)) {
+                continue;
+            }
+            if (m_pools[typeID]) {
+                m_pools[typeID]->Remove(entity);
+            }
+            if (m_sharedPools[typeID]) {
+                m_sharedPools[typeID]->Release(entity.GetID());
+            }
+        }
+
+        // Drop links from and to the entity so nothing keeps a dangling reference
+        for (RelationStore& relation : m_relations) {
+            relation.RemoveEntity(entity);
         }
-        
-        // Notify systems
-        NotifySystemsEntityRemoved(entity);
+
+        // Remove from entities list
+        m_entities.Erase(entity);
     }
-    
+
     m_entitiesToDestroy.clear();
 }
 
-void EntityManager::NotifySystemsEntityAdded(Entity entity) {
-    for (auto& system : m_systems) {
-        system->OnEntityAdded(entity);
+/**
+ * @brief Add or remove an entity from systems after its signature changes
+ *
+ * Compares the entity against each system's required (and excluded)
+ * components before and after the change. Systems the entity stops
+ * matching get OnEntityRemoved(); systems it starts matching get
+ * OnEntityAdded(). Systems with an empty signature opt out of automatic
+ * membership.
+ *
+ * @param entity Entity whose components changed
+ * @param oldSignature Signature before the change
+ * @param newSignature Signature after the change
+ */
+void EntityManager::UpdateSystemMembership(Entity entity, const Signature& oldSignature, const Signature& newSignature) {
+    for (System* system : m_trackedSystems) {
+        bool wasMatching = system->Matches(oldSignature);
+        bool isMatching = system->Matches(newSignature);
+
+        if (wasMatching && !isMatching) {
+            if (system->RemoveEntity(entity)) {
+                system->OnEntityRemoved(entity);
+            }
+        } else if (!wasMatching && isMatching) {
+            if (system->AddEntity(entity)) {
+                system->OnEntityAdded(entity);
+            }
+        }
     }
 }
 
-void EntityManager::NotifySystemsEntityRemoved(Entity entity) {
-    for (auto& system : m_systems) {
-        system->OnEntityRemoved(entity);
+void EntityManager::AttachSystem(System* system) {
+    if (!system || std::find(m_trackedSystems.begin(), m_trackedSystems.end(), system) != m_trackedSystems.end()) {
+        return;
+    }
+
+    system->SetEntityManager(this);
+    m_trackedSystems.push_back(system);
+    AddMatchingEntities(system);
+}
+
+void EntityManager::DetachSystem(System* system) {
+    m_trackedSystems.erase(std::remove(m_trackedSystems.begin(), m_trackedSystems.end(), system),
+                           m_trackedSystems.end());
+}
+
+/**
+ * @brief Populate a newly added system with existing matching entities
+ * @param system System to populate
+ */
+void EntityManager::AddMatchingEntities(System* system) {
+    if (system->GetSignature().none()) {
+        return;
+    }
+
+    for (Entity entity : m_entities) {
+        if (system->Matches(m_signatures[entity.GetID()]) && system->AddEntity(entity)) {
+            system->OnEntityAdded(entity);
+        }
+    }
+}
+
+/**
+ * @brief Register an observer for one component type and event
+ *
+ * Observers registered from inside a callback are staged and become active
+ * once the current dispatch finishes.
+ */
+ObserverID EntityManager::AddObserver(ComponentTypeID typeID, ComponentEvent event,
+                                      ComponentObserverCallback callback, ObserverDelivery delivery) {
+    ComponentObserver observer;
+    observer.id = m_nextObserverID++;
+    observer.event = event;
+    observer.delivery = delivery;
+    observer.callback = std::move(callback);
+
+    ObserverID id = observer.id;
+    m_observerTypes[id] = typeID;
+
+    if (m_observerDispatchDepth > 0) {
+        m_stagedObservers.emplace_back(typeID, std::move(observer));
+        m_observersDirty = true;
+    } else {
+        m_observers[typeID].push_back(std::move(observer));
+    }
+    return id;
+}
+
+/**
+ * @brief Unregister an observer
+ *
+ * The entry is only disabled here, so an observer may remove itself from inside
+ * its own callback; disabled entries are erased once no dispatch is running.
+ *
+ * @param id Observer handle
+ */
+void EntityManager::RemoveObserver(ObserverID id) {
+    auto typeIt = m_observerTypes.find(id);
+    if (typeIt == m_observerTypes.end()) {
+        return;
+    }
+
+    ComponentTypeID typeID = typeIt->second;
+    m_observerTypes.erase(typeIt);
+
+    for (auto& observer : m_observers[typeID]) {
+        if (observer.id == id) {
+            observer.active = false;
+        }
+    }
+    for (auto& staged : m_stagedObservers) {
+        if (staged.second.id == id) {
+            staged.second.active = false;
+        }
+    }
+    m_observersDirty = true;
+
+    if (m_observerDispatchDepth == 0) {
+        ApplyObserverChanges();
     }
 }
 
+/**
+ * @brief Dispatch a structural change to observers of one component type
+ *
+ * Costs a single empty-vector check when nobody observes the type. Immediate
+ * observers run now; deferred ones are queued for FlushObserverEvents().
+ *
+ * @param typeID Component type that changed
+ * @param event Kind of change
+ * @param entity Entity whose component changed
+ */
+void EntityManager::NotifyObservers(ComponentTypeID typeID, ComponentEvent event, Entity entity) {
+    auto& observers = m_observers[typeID];
+    if (observers.empty()) {
+        return;
+    }
 
+    ++m_observerDispatchDepth;
+    for (ComponentObserver& observer : observers) {
+        if (observer.event != event || !observer.active) {
+            continue;
+        }
+
+        if (observer.delivery == ObserverDelivery::DEFERRED) {
+            m_pendingComponentEvents.push_back({observer.id, typeID, entity});
+        } else {
+            observer.callback(entity);
+        }
+    }
+    if (--m_observerDispatchDepth == 0) {
+        ApplyObserverChanges();
+    }
+}
+
+void EntityManager::FlushObserverEvents() {
+    if (m_pendingComponentEvents.empty()) {
+        return;
+    }
+
+    // Swap out the queue so callbacks can buffer new events for the next flush
+    std::vector<PendingComponentEvent> events;
+    events.swap(m_pendingComponentEvents);
+
+    ++m_observerDispatchDepth;
+    for (const PendingComponentEvent& pending : events) {
+        for (ComponentObserver& observer : m_observers[pending.typeID]) {
+            if (observer.id == pending.observer) {
+                if (observer.active) {
+                    observer.callback(pending.entity);
+                }
+                break;
+            }
+        }
+    }
+    if (--m_observerDispatchDepth == 0) {
+        ApplyObserverChanges();
+    }
+}
+
+/**
+ * @brief Activate staged observers and drop removed ones
+ *
+ * Only runs when no dispatch is in progress, so observer vectors are never
+ * resized underneath a running callback.
+ */
+void EntityManager::ApplyObserverChanges() {
+    if (!m_observersDirty) {
+        return;
+    }
+    m_observersDirty = false;
+
+    auto isRemoved = [](const ComponentObserver& observer) { return !observer.active; };
+
+    for (auto& staged : m_stagedObservers) {
+        if (staged.second.active) {
+            m_observers[staged.first].push_back(std::move(staged.second));
+        }
+    }
+    m_stagedObservers.clear();
+
+    for (auto& observers : m_observers) {
+        observers.erase(std::remove_if(observers.begin(), observers.end(), isRemoved), observers.end());
+    }
+}
\ No newline at end of file
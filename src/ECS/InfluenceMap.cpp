@@ -0,0 +1,343 @@
+/**
+ * @file InfluenceMap.cpp
+ * @brief Implementation of incrementally updated influence maps
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "ECS/InfluenceMap.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define INFLUENCE_MAP_SSE2 1
+#endif
+
+namespace {
+
+/**
+ * @brief out[i] = 0.25 * (a[i] + c[i]) + 0.5 * b[i]
+ *
+ * The 1-2-1 kernel for both blur directions: rows above/at/below for the
+ * vertical pass, the same row shifted by -1/0/+1 for the horizontal one.
+ */
+void BlendRows(float* out, const float* a, const float* b, const float* c, int count) {
+    int i = 0;
+#ifdef INFLUENCE_MAP_SSE2
+    const __m128 quarter = _mm_set1_ps(0.25f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    for (; i + 4 <= count; i += 4) {
+        __m128 outer = _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(c + i));
+        __m128 blended = _mm_add_ps(_mm_mul_ps(outer, quarter), _mm_mul_ps(_mm_loadu_ps(b + i), half));
+        _mm_storeu_ps(out + i, blended);
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i] = (a[i] + c[i]) * 0.25f + b[i] * 0.5f;
+    }
+}
+
+} // namespace
+
+InfluenceMap::InfluenceMap(int columns, int rows, float cellSize, float originX, float originY)
+    : m_columns(std::max(columns, 1)), m_rows(std::max(rows, 1)), m_cellSize(cellSize),
+      m_originX(originX), m_originY(originY),
+      m_values(static_cast<std::size_t>(m_columns) * m_rows, 0.0f) {}
+
+int InfluenceMap::AddSource(float x, float y, float strength, float radius) {
+    int id;
+    if (!m_freeSources.empty()) {
+        id = m_freeSources.back();
+        m_freeSources.pop_back();
+    } else {
+        id = static_cast<int>(m_sources.size());
+        m_sources.emplace_back();
+    }
+
+    Source& source = m_sources[id];
+    source = Source{ColumnOf(x), RowOf(y), strength, radius, true, false, Rect{0, 0, -1, -1}};
+    UpdateFootprint(source);
+    ++m_sourceCount;
+    if (source.visible) {
+        MarkDirty(source.footprint);
+    }
+    return id;
+}
+
+void InfluenceMap::MoveSource(int id, float x, float y) {
+    if (id < 0 || id >= static_cast<int>(m_sources.size()) || !m_sources[id].alive) {
+        return;
+    }
+    SetSource(id, x, y, m_sources[id].strength, m_sources[id].radius);
+}
+
+void InfluenceMap::SetSource(int id, float x, float y, float strength, float radius) {
+    if (id < 0 || id >= static_cast<int>(m_sources.size()) || !m_sources[id].alive) {
+        return;
+    }
+
+    Source& source = m_sources[id];
+    int column = ColumnOf(x);
+    int row = RowOf(y);
+    if (column == source.column && row == source.row && strength == source.strength && radius == source.radius) {
+        return;
+    }
+    const bool wasVisible = source.visible;
+    const Rect before = source.footprint;
+    source.column = column;
+    source.row = row;
+    source.strength = strength;
+    source.radius = radius;
+    UpdateFootprint(source);
+
+    // A short move leaves the footprints mostly overlapping: dirty their union once
+    const Rect& after = source.footprint;
+    if (wasVisible && source.visible) {
+        Rect merged{std::min(before.left, after.left), std::min(before.top, after.top),
+                    std::max(before.right, after.right), std::max(before.bottom, after.bottom)};
+        auto area = [](const Rect& r) {
+            return static_cast<long long>(r.right - r.left + 1) * (r.bottom - r.top + 1);
+        };
+        if (area(merged) <= area(before) + area(after)) {
+            MarkDirty(merged);
+            return;
+        }
+    }
+    if (wasVisible) {
+        MarkDirty(before);
+    }
+    if (source.visible) {
+        MarkDirty(after);
+    }
+}
+
+void InfluenceMap::RemoveSource(int id) {
+    if (id < 0 || id >= static_cast<int>(m_sources.size()) || !m_sources[id].alive) {
+        return;
+    }
+    if (m_sources[id].visible) {
+        MarkDirty(m_sources[id].footprint);
+    }
+    m_sources[id].alive = false;
+    m_freeSources.push_back(id);
+    --m_sourceCount;
+}
+
+void InfluenceMap::Clear() {
+    m_sources.clear();
+    m_freeSources.clear();
+    m_sourceCount = 0;
+    m_dirty.clear();
+    m_fullRebuild = false;
+    std::fill(m_values.begin(), m_values.end(), 0.0f);
+    std::fill(m_blurred.begin(), m_blurred.end(), 0.0f);
+}
+
+std::size_t InfluenceMap::Update() {
+    if (m_dirty.empty() && !m_fullRebuild) {
+        return 0;
+    }
+
+    // Rebuilding once beats recomputing most of the grid piecemeal, or
+    // scanning every source for each of many rectangles
+    std::size_t dirtyCells = 0;
+    for (const Rect& rect : m_dirty) {
+        dirtyCells += static_cast<std::size_t>(rect.right - rect.left + 1) * (rect.bottom - rect.top + 1);
+    }
+    if (m_fullRebuild || dirtyCells * 2 > m_values.size() ||
+        m_dirty.size() * m_sources.size() > m_values.size()) {
+        m_dirty.assign(1, Rect{0, 0, m_columns - 1, m_rows - 1});
+        dirtyCells = m_values.size();
+    }
+
+    for (const Rect& rect : m_dirty) {
+        Recompute(rect);
+    }
+    if (m_blurPasses > 0) {
+        for (const Rect& rect : m_dirty) {
+            Blur(rect);
+        }
+    }
+
+    m_dirty.clear();
+    m_fullRebuild = false;
+    return dirtyCells;
+}
+
+float InfluenceMap::Sample(float x, float y) const {
+    return SampleCell(ColumnOf(x), RowOf(y));
+}
+
+float InfluenceMap::SampleCell(int column, int row) const {
+    if (column < 0 || row < 0 || column >= m_columns || row >= m_rows) {
+        return 0.0f;
+    }
+    return Data()[static_cast<std::size_t>(row) * m_columns + column];
+}
+
+bool InfluenceMap::FindExtreme(float x, float y, float searchRadius, bool lowest, float& outX, float& outY) const {
+    const int column = ColumnOf(x);
+    const int row = RowOf(y);
+    const int reach = static_cast<int>(std::ceil(searchRadius / m_cellSize));
+    const float reachSq = searchRadius * searchRadius;
+    const float* values = Data();
+
+    bool found = false;
+    float best = 0.0f;
+    for (int r = std::max(row - reach, 0); r <= std::min(row + reach, m_rows - 1); ++r) {
+        float dy = (r - row) * m_cellSize;
+        for (int c = std::max(column - reach, 0); c <= std::min(column + reach, m_columns - 1); ++c) {
+            float dx = (c - column) * m_cellSize;
+            if (dx * dx + dy * dy > reachSq) {
+                continue;
+            }
+            float value = values[static_cast<std::size_t>(r) * m_columns + c];
+            if (!found || (lowest ? value < best : value > best)) {
+                found = true;
+                best = value;
+                outX = m_originX + (c + 0.5f) * m_cellSize;
+                outY = m_originY + (r + 0.5f) * m_cellSize;
+            }
+        }
+    }
+    return found;
+}
+
+void InfluenceMap::SetBlurPasses(int passes) {
+    passes = std::max(passes, 0);
+    if (passes == m_blurPasses) {
+        return;
+    }
+    m_blurPasses = passes;
+    m_blurred.assign(passes > 0 ? m_values.size() : 0, 0.0f);
+    m_fullRebuild = passes > 0;
+}
+
+int InfluenceMap::ColumnOf(float x) const {
+    return static_cast<int>(std::floor((x - m_originX) / m_cellSize));
+}
+
+int InfluenceMap::RowOf(float y) const {
+    return static_cast<int>(std::floor((y - m_originY) / m_cellSize));
+}
+
+/**
+ * @brief Recompute the cells a source can reach, clipped to the map
+ */
+void InfluenceMap::UpdateFootprint(Source& source) const {
+    Rect& rect = source.footprint;
+    if (source.radius <= 0.0f) {
+        source.visible = false;
+        return;
+    }
+    int reach = static_cast<int>(std::ceil(source.radius / m_cellSize));
+    rect.left = std::max(source.column - reach, 0);
+    rect.top = std::max(source.row - reach, 0);
+    rect.right = std::min(source.column + reach, m_columns - 1);
+    rect.bottom = std::min(source.row + reach, m_rows - 1);
+    source.visible = rect.left <= rect.right && rect.top <= rect.bottom;
+}
+
+void InfluenceMap::MarkDirty(const Rect& rect) {
+    if (!m_fullRebuild) {
+        m_dirty.push_back(rect);
+    }
+}
+
+/**
+ * @brief Add a source's falloff to the cells of its footprint inside clip
+ */
+void InfluenceMap::Stamp(const Source& source, const Rect& clip) {
+    Rect rect = source.footprint;
+    rect.left = std::max(rect.left, clip.left);
+    rect.top = std::max(rect.top, clip.top);
+    rect.right = std::min(rect.right, clip.right);
+    rect.bottom = std::min(rect.bottom, clip.bottom);
+
+    const float inverseRadius = 1.0f / source.radius;
+    for (int row = rect.top; row <= rect.bottom; ++row) {
+        float dy = (row - source.row) * m_cellSize;
+        float* cells = m_values.data() + static_cast<std::size_t>(row) * m_columns;
+        for (int column = rect.left; column <= rect.right; ++column) {
+            float dx = (column - source.column) * m_cellSize;
+            float falloff = 1.0f - std::sqrt(dx * dx + dy * dy) * inverseRadius;
+            cells[column] += source.strength * std::max(falloff, 0.0f);
+        }
+    }
+}
+
+/**
+ * @brief Zero a rectangle and restamp every source that reaches it
+ */
+void InfluenceMap::Recompute(const Rect& rect) {
+    for (int row = rect.top; row <= rect.bottom; ++row) {
+        float* cells = m_values.data() + static_cast<std::size_t>(row) * m_columns;
+        std::fill(cells + rect.left, cells + rect.right + 1, 0.0f);
+    }
+
+    for (const Source& source : m_sources) {
+        const Rect& footprint = source.footprint;
+        if (source.alive && source.visible &&
+            footprint.left <= rect.right && footprint.right >= rect.left &&
+            footprint.top <= rect.bottom && footprint.bottom >= rect.top) {
+            Stamp(source, rect);
+        }
+    }
+}
+
+/**
+ * @brief Refresh the blurred cells a change inside rect can affect
+ *
+ * Each pass spreads a change one cell, so the output region is rect grown
+ * by the pass count, computed from raw values in rect grown by twice that.
+ * Edges of the working area repeat their outermost cell; that is exact at
+ * the map border and only disturbs cells outside the output region elsewhere.
+ */
+void InfluenceMap::Blur(const Rect& rect) {
+    const int passes = m_blurPasses;
+    auto grow = [this](const Rect& r, int by) {
+        return Rect{std::max(r.left - by, 0), std::max(r.top - by, 0),
+                    std::min(r.right + by, m_columns - 1), std::min(r.bottom + by, m_rows - 1)};
+    };
+    const Rect output = grow(rect, passes);
+    const Rect input = grow(rect, 2 * passes);
+    const int width = input.right - input.left + 1;
+    const int height = input.bottom - input.top + 1;
+
+    m_scratch.resize(static_cast<std::size_t>(width) * height);
+    m_scratch2.resize(m_scratch.size());
+    for (int row = 0; row < height; ++row) {
+        const float* source = m_values.data() + static_cast<std::size_t>(input.top + row) * m_columns + input.left;
+        std::copy(source, source + width, m_scratch.data() + static_cast<std::size_t>(row) * width);
+    }
+
+    for (int pass = 0; pass < passes; ++pass) {
+        // Horizontal: scratch -> scratch2
+        for (int row = 0; row < height; ++row) {
+            const float* in = m_scratch.data() + static_cast<std::size_t>(row) * width;
+            float* out = m_scratch2.data() + static_cast<std::size_t>(row) * width;
+            if (width == 1) {
+                out[0] = in[0];
+                continue;
+            }
+            out[0] = in[0] * 0.75f + in[1] * 0.25f;
+            BlendRows(out + 1, in, in + 1, in + 2, width - 2);
+            out[width - 1] = in[width - 1] * 0.75f + in[width - 2] * 0.25f;
+        }
+        // Vertical: scratch2 -> scratch
+        for (int row = 0; row < height; ++row) {
+            const float* above = m_scratch2.data() + static_cast<std::size_t>(std::max(row - 1, 0)) * width;
+            const float* centre = m_scratch2.data() + static_cast<std::size_t>(row) * width;
+            const float* below = m_scratch2.data() + static_cast<std::size_t>(std::min(row + 1, height - 1)) * width;
+            BlendRows(m_scratch.data() + static_cast<std::size_t>(row) * width, above, centre, below, width);
+        }
+    }
+
+    for (int row = output.top; row <= output.bottom; ++row) {
+        const float* blurred = m_scratch.data() + static_cast<std::size_t>(row - input.top) * width +
+                               (output.left - input.left);
+        std::copy(blurred, blurred + (output.right - output.left + 1),
+                  m_blurred.data() + static_cast<std::size_t>(row) * m_columns + output.left);
+    }
+}
@@ -0,0 +1,58 @@
+/**
+ * @file InfluenceSystem.cpp
+ * @brief Implementation of the influence map system
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "ECS/InfluenceSystem.h"
+
+InfluenceSystem::InfluenceSystem(int columns, int rows, float cellSize, float originX, float originY)
+    : m_maps(LAYER_COUNT, InfluenceMap(columns, rows, cellSize, originX, originY)) {
+    Require(Required{});
+}
+
+void InfluenceSystem::Update([[maybe_unused]] float deltaTime) {
+    for (Entity entity : GetEntities()) {
+        const auto* transform = m_entityManager->ReadComponent<TransformComponent>(entity);
+        const auto* source = m_entityManager->ReadComponent<InfluenceSourceComponent>(entity);
+        Tracked& tracked = m_tracked[entity.GetID()];
+
+        if (source->layer != tracked.layer) {
+            GetMap(tracked.layer).RemoveSource(tracked.source);
+            AddSource(entity);
+        } else {
+            GetMap(tracked.layer).SetSource(tracked.source, transform->x, transform->y,
+                                            source->strength, source->radius);
+        }
+    }
+
+    m_updatedCells = 0;
+    for (InfluenceMap& map : m_maps) {
+        m_updatedCells += map.Update();
+    }
+}
+
+void InfluenceSystem::OnEntityAdded(Entity entity) {
+    if (entity.GetID() >= m_tracked.size()) {
+        m_tracked.resize(entity.GetID() + 1);
+    }
+    AddSource(entity);
+}
+
+void InfluenceSystem::OnEntityRemoved(Entity entity) {
+    if (entity.GetID() >= m_tracked.size()) {
+        return;
+    }
+    Tracked& tracked = m_tracked[entity.GetID()];
+    GetMap(tracked.layer).RemoveSource(tracked.source);
+    tracked = Tracked();
+}
+
+void InfluenceSystem::AddSource(Entity entity) {
+    const auto* transform = m_entityManager->ReadComponent<TransformComponent>(entity);
+    const auto* source = m_entityManager->ReadComponent<InfluenceSourceComponent>(entity);
+    Tracked& tracked = m_tracked[entity.GetID()];
+    tracked.layer = source->layer;
+    tracked.source = GetMap(source->layer).AddSource(transform->x, transform->y, source->strength, source->radius);
+}
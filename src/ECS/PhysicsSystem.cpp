@@ -0,0 +1,447 @@
+/**
+ * @file PhysicsSystem.cpp
+ * @brief Implementation of the rigid-body contact solver with sleeping islands
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "ECS/PhysicsSystem.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+/// Overlap left unresolved so resting contacts stay touching (avoids jitter)
+constexpr float PENETRATION_SLOP = 0.5f;
+
+/// Share of the remaining overlap removed per step
+constexpr float CORRECTION_PERCENT = 0.8f;
+
+/// Impacts slower than this do not bounce (keeps stacks from buzzing)
+constexpr float RESTITUTION_SPEED = 50.0f;
+
+} // namespace
+
+template<typename Visit>
+void PhysicsSystem::ForEachCell(float x, float y, float width, float height, Visit&& visit) const {
+    auto first = [this](float v) { return static_cast<std::int64_t>(std::floor(v / m_cellSize)); };
+    for (std::int64_t cy = first(y); cy <= first(y + height); ++cy) {
+        for (std::int64_t cx = first(x); cx <= first(x + width); ++cx) {
+            visit((cx << 32) ^ (cy & 0xFFFFFFFF));
+        }
+    }
+}
+
+PhysicsSystem::CellKey PhysicsSystem::KeyOf(float x, float y) const {
+    auto cx = static_cast<std::int64_t>(std::floor(x / m_cellSize));
+    auto cy = static_cast<std::int64_t>(std::floor(y / m_cellSize));
+    return (cx << 32) ^ (cy & 0xFFFFFFFF);
+}
+
+void PhysicsSystem::Update(float deltaTime) {
+    m_updating = true;
+
+    // Static bodies join the resting grid once and are never simulated
+    for (Entity entity : m_pendingStatic) {
+        if (m_entityManager->IsEntityValid(entity) && !IsSleeping(entity)) {
+            Park(entity);
+            m_entityManager->AddTag<SleepingTag>(entity);
+        }
+    }
+    m_pendingStatic.clear();
+
+    GatherBodies();
+    if (m_awakeCount > 0) {
+        for (std::size_t i = 0; i < m_awakeCount; ++i) {
+            m_bodies[i].vy += m_gravity * m_bodies[i].rigid->gravityScale * deltaTime;
+        }
+
+        FindContacts();
+        SolveVelocities();
+        IntegratePositions(deltaTime);
+        CorrectPositions();
+        UpdateIslands(deltaTime);
+
+        for (std::size_t i = 0; i < m_awakeCount; ++i) {
+            auto* velocity = m_entityManager->GetComponent<VelocityComponent>(m_bodies[i].entity);
+            velocity->vx = m_bodies[i].vx;
+            velocity->vy = m_bodies[i].vy;
+        }
+    } else {
+        m_contacts.clear();
+        m_islandCount = 0;
+    }
+
+    m_updating = false;
+
+    // Tag changes update system membership, so apply them after the step
+    WakeQueuedIslands();
+    for (Entity entity : m_toSleep) {
+        Park(entity);
+        m_entityManager->AddTag<SleepingTag>(entity);
+    }
+    m_toSleep.clear();
+}
+
+void PhysicsSystem::OnEntityAdded(Entity entity) {
+    auto* rigid = m_entityManager->GetComponent<RigidBodyComponent>(entity);
+    if (rigid->IsStatic()) {
+        m_pendingStatic.push_back(entity);
+    } else {
+        // Woken (or new) body: its resting-grid entries, if any, are stale now
+        Unpark(entity);
+        rigid->restTime = 0.0f;
+    }
+}
+
+void PhysicsSystem::SetSleepingEnabled(bool enabled) {
+    m_sleepingEnabled = enabled;
+    if (!enabled) {
+        for (const auto& island : m_sleepingIslands) {
+            m_islandsToWake.push_back(island.first);
+        }
+        if (!m_updating) {
+            WakeQueuedIslands();
+        }
+    }
+}
+
+void PhysicsSystem::Wake(Entity entity) {
+    auto* rigid = m_entityManager->GetComponent<RigidBodyComponent>(entity);
+    if (!rigid || rigid->IsStatic() || !IsSleeping(entity)) {
+        return;
+    }
+    m_islandsToWake.push_back(rigid->island);
+    if (!m_updating) {
+        WakeQueuedIslands();
+    }
+}
+
+void PhysicsSystem::ApplyImpulse(Entity entity, float impulseX, float impulseY) {
+    auto* rigid = m_entityManager->GetComponent<RigidBodyComponent>(entity);
+    auto* velocity = m_entityManager->GetComponent<VelocityComponent>(entity);
+    if (!rigid || !velocity || rigid->IsStatic()) {
+        return;
+    }
+    Wake(entity);
+    velocity->vx += impulseX * rigid->inverseMass;
+    velocity->vy += impulseY * rigid->inverseMass;
+}
+
+void PhysicsSystem::GatherBodies() {
+    m_bodies.clear();
+    m_restingIndex.clear();
+    for (Entity entity : GetEntities()) {
+        const auto* box = m_entityManager->GetComponent<CollisionComponent>(entity);
+        auto* rigid = m_entityManager->GetComponent<RigidBodyComponent>(entity);
+        if (box->isTrigger || rigid->IsStatic()) {
+            continue; // Triggers never push; static bodies are parked next step
+        }
+        const auto* velocity = m_entityManager->GetComponent<VelocityComponent>(entity);
+        m_bodies.push_back({entity, m_entityManager->GetComponent<TransformComponent>(entity), box, rigid,
+                            velocity->vx, velocity->vy, rigid->inverseMass});
+    }
+    m_awakeCount = m_bodies.size();
+}
+
+void PhysicsSystem::FindContacts() {
+    m_contacts.clear();
+    for (auto& cell : m_awakeGrid) {
+        cell.second.clear();
+    }
+
+    for (std::uint32_t i = 0; i < m_awakeCount; ++i) {
+        const Body& body = m_bodies[i];
+        ForEachCell(body.transform->x, body.transform->y, body.box->width, body.box->height,
+                    [&](CellKey key) { m_awakeGrid[key].push_back(i); });
+    }
+
+    for (std::uint32_t i = 0; i < m_awakeCount; ++i) {
+        const TransformComponent* transform = m_bodies[i].transform;
+        const CollisionComponent* box = m_bodies[i].box;
+        ForEachCell(transform->x, transform->y, box->width, box->height, [&](CellKey key) {
+            for (std::uint32_t j : m_awakeGrid[key]) {
+                if (j > i) {
+                    AddContact(i, j, key);
+                }
+            }
+
+            auto resting = m_restingGrid.find(key);
+            if (resting == m_restingGrid.end()) {
+                return;
+            }
+            std::vector<Entity>& entities = resting->second;
+            for (std::size_t k = 0; k < entities.size();) {
+                // Destroyed bodies are dropped lazily
+                if (!m_entityManager->IsEntityValid(entities[k]) || !IsSleeping(entities[k])) {
+                    entities[k] = entities.back();
+                    entities.pop_back();
+                    continue;
+                }
+                AddContact(i, RestingBodyIndex(entities[k]), key);
+                ++k;
+            }
+        });
+    }
+
+    // Drop cells that emptied so the map tracks the occupied area
+    for (auto it = m_awakeGrid.begin(); it != m_awakeGrid.end();) {
+        it = it->second.empty() ? m_awakeGrid.erase(it) : std::next(it);
+    }
+}
+
+void PhysicsSystem::AddContact(std::uint32_t a, std::uint32_t b, CellKey cell) {
+    const Body& bodyA = m_bodies[a];
+    const Body& bodyB = m_bodies[b];
+    if (bodyB.box->isTrigger) {
+        return;
+    }
+
+    float ax = bodyA.transform->x;
+    float ay = bodyA.transform->y;
+    float bx = bodyB.transform->x;
+    float by = bodyB.transform->y;
+    float overlapX = std::min(ax + bodyA.box->width, bx + bodyB.box->width) - std::max(ax, bx);
+    float overlapY = std::min(ay + bodyA.box->height, by + bodyB.box->height) - std::max(ay, by);
+    if (overlapX <= 0.0f || overlapY <= 0.0f) {
+        return;
+    }
+
+    // Pairs sharing several cells are handled once, in the cell holding the overlap's corner
+    if (KeyOf(std::max(ax, bx), std::max(ay, by)) != cell) {
+        return;
+    }
+
+    Contact contact;
+    contact.a = a;
+    contact.b = b;
+    if (overlapX < overlapY) {
+        float centerDelta = (bx + bodyB.box->width * 0.5f) - (ax + bodyA.box->width * 0.5f);
+        contact.nx = centerDelta < 0.0f ? -1.0f : 1.0f;
+        contact.ny = 0.0f;
+        contact.penetration = overlapX;
+    } else {
+        float centerDelta = (by + bodyB.box->height * 0.5f) - (ay + bodyA.box->height * 0.5f);
+        contact.nx = 0.0f;
+        contact.ny = centerDelta < 0.0f ? -1.0f : 1.0f;
+        contact.penetration = overlapY;
+    }
+    contact.restitution = std::min(bodyA.rigid->restitution, bodyB.rigid->restitution);
+    contact.friction = std::sqrt(bodyA.rigid->friction * bodyB.rigid->friction);
+
+    // Hitting a sleeping body hard enough wakes its island for the next step
+    if (b >= m_awakeCount && !bodyB.rigid->IsStatic()) {
+        float approach = bodyA.vx * contact.nx + bodyA.vy * contact.ny;
+        if (approach > WAKE_SPEED) {
+            m_islandsToWake.push_back(bodyB.rigid->island);
+        }
+    }
+
+    m_contacts.push_back(contact);
+}
+
+std::uint32_t PhysicsSystem::RestingBodyIndex(Entity entity) {
+    auto it = m_restingIndex.find(entity.GetID());
+    if (it != m_restingIndex.end()) {
+        return it->second;
+    }
+
+    // Resting bodies take part in this step as immovable
+    auto index = static_cast<std::uint32_t>(m_bodies.size());
+    m_bodies.push_back({entity, m_entityManager->GetComponent<TransformComponent>(entity),
+                        m_entityManager->GetComponent<CollisionComponent>(entity),
+                        m_entityManager->GetComponent<RigidBodyComponent>(entity), 0.0f, 0.0f, 0.0f});
+    m_restingIndex.emplace(entity.GetID(), index);
+    return index;
+}
+
+void PhysicsSystem::SolveVelocities() {
+    for (int iteration = 0; iteration < SOLVER_ITERATIONS; ++iteration) {
+        for (const Contact& contact : m_contacts) {
+            Body& a = m_bodies[contact.a];
+            Body& b = m_bodies[contact.b];
+            float inverseMassSum = a.inverseMass + b.inverseMass;
+            if (inverseMassSum == 0.0f) {
+                continue;
+            }
+
+            float normalSpeed = (b.vx - a.vx) * contact.nx + (b.vy - a.vy) * contact.ny;
+            if (normalSpeed > 0.0f) {
+                continue; // Already separating
+            }
+
+            float restitution = normalSpeed < -RESTITUTION_SPEED ? contact.restitution : 0.0f;
+            float impulse = -(1.0f + restitution) * normalSpeed / inverseMassSum;
+            a.vx -= impulse * a.inverseMass * contact.nx;
+            a.vy -= impulse * a.inverseMass * contact.ny;
+            b.vx += impulse * b.inverseMass * contact.nx;
+            b.vy += impulse * b.inverseMass * contact.ny;
+
+            // Coulomb friction along the contact tangent
+            float tx = -contact.ny;
+            float ty = contact.nx;
+            float tangentSpeed = (b.vx - a.vx) * tx + (b.vy - a.vy) * ty;
+            float frictionImpulse = std::clamp(-tangentSpeed / inverseMassSum,
+                                               -contact.friction * impulse, contact.friction * impulse);
+            a.vx -= frictionImpulse * a.inverseMass * tx;
+            a.vy -= frictionImpulse * a.inverseMass * ty;
+            b.vx += frictionImpulse * b.inverseMass * tx;
+            b.vy += frictionImpulse * b.inverseMass * ty;
+        }
+    }
+}
+
+void PhysicsSystem::IntegratePositions(float deltaTime) {
+    for (std::size_t i = 0; i < m_awakeCount; ++i) {
+        m_bodies[i].transform->x += m_bodies[i].vx * deltaTime;
+        m_bodies[i].transform->y += m_bodies[i].vy * deltaTime;
+    }
+}
+
+void PhysicsSystem::CorrectPositions() {
+    for (const Contact& contact : m_contacts) {
+        Body& a = m_bodies[contact.a];
+        Body& b = m_bodies[contact.b];
+        float inverseMassSum = a.inverseMass + b.inverseMass;
+        if (inverseMassSum == 0.0f) {
+            continue;
+        }
+
+        float correction = std::max(contact.penetration - PENETRATION_SLOP, 0.0f) / inverseMassSum * CORRECTION_PERCENT;
+        a.transform->x -= correction * a.inverseMass * contact.nx;
+        a.transform->y -= correction * a.inverseMass * contact.ny;
+        b.transform->x += correction * b.inverseMass * contact.nx;
+        b.transform->y += correction * b.inverseMass * contact.ny;
+    }
+}
+
+std::uint32_t PhysicsSystem::FindRoot(std::uint32_t index) {
+    while (m_parent[index] != index) {
+        m_parent[index] = m_parent[m_parent[index]];
+        index = m_parent[index];
+    }
+    return index;
+}
+
+void PhysicsSystem::UpdateIslands(float deltaTime) {
+    const float sleepSpeedSquared = SLEEP_SPEED * SLEEP_SPEED;
+    for (std::size_t i = 0; i < m_awakeCount; ++i) {
+        Body& body = m_bodies[i];
+        bool resting = body.vx * body.vx + body.vy * body.vy < sleepSpeedSquared;
+        body.rigid->restTime = resting ? body.rigid->restTime + deltaTime : 0.0f;
+    }
+
+    // Awake bodies in contact form an island; static and sleeping bodies don't link islands
+    m_parent.resize(m_awakeCount);
+    for (std::uint32_t i = 0; i < m_awakeCount; ++i) {
+        m_parent[i] = i;
+    }
+    for (const Contact& contact : m_contacts) {
+        if (contact.b < m_awakeCount) {
+            m_parent[FindRoot(contact.a)] = FindRoot(contact.b);
+        }
+    }
+
+    // An island sleeps only if every member has rested long enough
+    std::unordered_map<std::uint32_t, float> islandRest; // Root -> shortest rest time
+    for (std::uint32_t i = 0; i < m_awakeCount; ++i) {
+        auto inserted = islandRest.emplace(FindRoot(i), m_bodies[i].rigid->restTime);
+        if (!inserted.second) {
+            inserted.first->second = std::min(inserted.first->second, m_bodies[i].rigid->restTime);
+        }
+    }
+    m_islandCount = islandRest.size();
+    if (!m_sleepingEnabled) {
+        return;
+    }
+
+    std::unordered_map<std::uint32_t, int> sleepingIslands; // Root -> new island id
+    for (const auto& island : islandRest) {
+        if (island.second >= SLEEP_TIME) {
+            sleepingIslands.emplace(island.first, m_nextIsland++);
+        }
+    }
+    if (sleepingIslands.empty()) {
+        return;
+    }
+
+    for (std::uint32_t i = 0; i < m_awakeCount; ++i) {
+        auto it = sleepingIslands.find(FindRoot(i));
+        if (it == sleepingIslands.end()) {
+            continue;
+        }
+        Body& body = m_bodies[i];
+        body.vx = 0.0f;
+        body.vy = 0.0f;
+        body.rigid->island = it->second;
+        m_sleepingIslands[it->second].push_back(body.entity);
+        m_toSleep.push_back(body.entity);
+    }
+
+    // A sleeping island resting on another sleeping island joins it, so
+    // waking the lower one also wakes what sits on top
+    for (const Contact& contact : m_contacts) {
+        const Body& resting = m_bodies[contact.b];
+        if (contact.b < m_awakeCount || resting.rigid->IsStatic()) {
+            continue;
+        }
+        auto it = sleepingIslands.find(FindRoot(contact.a));
+        int target = resting.rigid->island;
+        if (it == sleepingIslands.end() || it->second == target) {
+            continue;
+        }
+        auto source = m_sleepingIslands.find(it->second);
+        if (source == m_sleepingIslands.end()) {
+            continue; // Already merged through another contact
+        }
+        for (Entity member : source->second) {
+            m_entityManager->GetComponent<RigidBodyComponent>(member)->island = target;
+        }
+        std::vector<Entity>& members = m_sleepingIslands[target];
+        members.insert(members.end(), source->second.begin(), source->second.end());
+        m_sleepingIslands.erase(source);
+        it->second = target;
+    }
+}
+
+void PhysicsSystem::WakeQueuedIslands() {
+    // Swap out first: waking calls OnEntityAdded, which never queues, but stay safe
+    std::vector<int> islands;
+    islands.swap(m_islandsToWake);
+    for (int island : islands) {
+        auto it = m_sleepingIslands.find(island);
+        if (it == m_sleepingIslands.end()) {
+            continue;
+        }
+        std::vector<Entity> members = std::move(it->second);
+        m_sleepingIslands.erase(it);
+        for (Entity member : members) {
+            if (m_entityManager->IsEntityValid(member) && IsSleeping(member)) {
+                m_entityManager->RemoveTag<SleepingTag>(member);
+            }
+        }
+    }
+}
+
+void PhysicsSystem::Park(Entity entity) {
+    const auto* transform = m_entityManager->GetComponent<TransformComponent>(entity);
+    const auto* box = m_entityManager->GetComponent<CollisionComponent>(entity);
+    ForEachCell(transform->x, transform->y, box->width, box->height,
+                [&](CellKey key) { m_restingGrid[key].push_back(entity); });
+}
+
+void PhysicsSystem::Unpark(Entity entity) {
+    const auto* transform = m_entityManager->GetComponent<TransformComponent>(entity);
+    const auto* box = m_entityManager->GetComponent<CollisionComponent>(entity);
+    ForEachCell(transform->x, transform->y, box->width, box->height, [&](CellKey key) {
+        auto it = m_restingGrid.find(key);
+        if (it == m_restingGrid.end()) {
+            return;
+        }
+        std::vector<Entity>& entities = it->second;
+        entities.erase(std::remove(entities.begin(), entities.end(), entity), entities.end());
+        if (entities.empty()) {
+            m_restingGrid.erase(it);
+        }
+    });
+}
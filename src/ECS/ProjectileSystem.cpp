@@ -0,0 +1,248 @@
+/**
+ * @file ProjectileSystem.cpp
+ * @brief Implementation of the pooled projectile system
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "ECS/ProjectileSystem.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+/**
+ * @brief Clip the segment p + t * d (t in [tMin, tMax]) to one slab
+ * @return false if the segment misses the slab
+ */
+bool ClipToSlab(float p, float d, float low, float high, float& tMin, float& tMax) {
+    if (std::abs(d) < 1e-6f) {
+        return p >= low && p <= high;
+    }
+    float inverse = 1.0f / d;
+    float t0 = (low - p) * inverse;
+    float t1 = (high - p) * inverse;
+    if (t0 > t1) {
+        std::swap(t0, t1);
+    }
+    tMin = std::max(tMin, t0);
+    tMax = std::min(tMax, t1);
+    return tMin <= tMax;
+}
+
+} // namespace
+
+ProjectileSystem::ProjectileSystem(std::size_t capacity, EventManager* events)
+    : m_events(events),
+      m_x(capacity), m_y(capacity), m_vx(capacity), m_vy(capacity),
+      m_life(capacity), m_damage(capacity), m_radius(capacity),
+      m_owner(capacity), m_targets(capacity) {
+    Require(Required{});
+    Exclude(Excluded{});
+}
+
+void ProjectileSystem::Update(float deltaTime) {
+    m_hits.clear();
+
+    if (m_count > 0 && !GetEntities().Empty()) {
+        BuildGrid();
+        SweepProjectiles(deltaTime);
+    }
+    Integrate(deltaTime);
+
+    // Handlers may fire new projectiles; they start moving next step
+    if (m_events) {
+        for (const ProjectileHitEvent& hit : m_hits) {
+            m_events->FireEvent(hit);
+        }
+    }
+}
+
+bool ProjectileSystem::Spawn(float x, float y, float vx, float vy, float lifetime, float damage,
+                             Entity owner, std::uint8_t targets, float radius) {
+    if (m_count == m_x.size()) {
+        return false;
+    }
+
+    std::size_t slot = m_count++;
+    m_x[slot] = x;
+    m_y[slot] = y;
+    m_vx[slot] = vx;
+    m_vy[slot] = vy;
+    m_life[slot] = lifetime;
+    m_damage[slot] = damage;
+    m_radius[slot] = radius;
+    m_owner[slot] = owner;
+    m_targets[slot] = targets;
+    return true;
+}
+
+bool ProjectileSystem::SpawnToward(float x, float y, float targetX, float targetY, float speed, float range,
+                                   float damage, Entity owner, std::uint8_t targets) {
+    float dx = targetX - x;
+    float dy = targetY - y;
+    float length = std::sqrt(dx * dx + dy * dy);
+    if (length <= 0.0f || speed <= 0.0f) {
+        return false;
+    }
+    return Spawn(x, y, dx / length * speed, dy / length * speed, range / speed, damage, owner, targets);
+}
+
+int ProjectileSystem::SpawnRing(float x, float y, int count, float speed, float lifetime, float damage,
+                                Entity owner, std::uint8_t targets, float angleOffset) {
+    constexpr float TWO_PI = 6.28318530718f;
+    int spawned = 0;
+    for (int i = 0; i < count; ++i) {
+        float angle = angleOffset + TWO_PI * i / count;
+        if (!Spawn(x, y, std::cos(angle) * speed, std::sin(angle) * speed, lifetime, damage, owner, targets)) {
+            break;
+        }
+        ++spawned;
+    }
+    return spawned;
+}
+
+/**
+ * @brief Copy colliders into m_targetList and hash them into the grid
+ */
+void ProjectileSystem::BuildGrid() {
+    m_targetList.clear();
+    // Drop stale cells now and then instead of letting the map grow forever
+    if (m_grid.size() > 4 * GetEntities().Size() + 64) {
+        m_grid.clear();
+    }
+    for (auto& [key, cell] : m_grid) {
+        cell.clear();
+    }
+
+    for (Entity entity : GetEntities()) {
+        const auto* transform = m_entityManager->ReadComponent<TransformComponent>(entity);
+        const auto* box = m_entityManager->ReadComponent<CollisionComponent>(entity);
+
+        Target target;
+        target.entity = entity;
+        target.left = transform->x;
+        target.top = transform->y;
+        target.right = transform->x + box->width;
+        target.bottom = transform->y + box->height;
+        target.kind = m_entityManager->HasComponent<PlayerTag>(entity) ? TARGET_PLAYER
+                    : m_entityManager->HasComponent<EnemyTag>(entity) ? TARGET_ENEMY
+                    : TARGET_OTHER;
+
+        auto index = static_cast<std::uint32_t>(m_targetList.size());
+        m_targetList.push_back(target);
+
+        auto cell = [this](float v) { return static_cast<std::int64_t>(std::floor(v / m_cellSize)); };
+        for (std::int64_t cy = cell(target.top); cy <= cell(target.bottom); ++cy) {
+            for (std::int64_t cx = cell(target.left); cx <= cell(target.right); ++cx) {
+                m_grid[KeyOf(cx, cy)].push_back(index);
+            }
+        }
+    }
+    m_visited.assign(m_targetList.size(), 0);
+}
+
+/**
+ * @brief Sweep each projectile's step against the targets in the cells it crosses
+ *
+ * The step is the segment p + t * v * dt, t in [0, 1]; targets are grown by
+ * the projectile radius so the test is a segment-vs-box slab clip. The
+ * earliest hit wins, and the projectile is removed.
+ */
+void ProjectileSystem::SweepProjectiles(float deltaTime) {
+    std::uint32_t stamp = 0;
+    auto cell = [this](float v) { return static_cast<std::int64_t>(std::floor(v / m_cellSize)); };
+
+    for (std::size_t i = 0; i < m_count;) {
+        float x = m_x[i];
+        float y = m_y[i];
+        float dx = m_vx[i] * deltaTime;
+        float dy = m_vy[i] * deltaTime;
+        float radius = m_radius[i];
+        ++stamp;
+
+        float best = 2.0f;
+        std::uint32_t bestTarget = 0;
+        std::int64_t left = cell(std::min(x, x + dx) - radius);
+        std::int64_t right = cell(std::max(x, x + dx) + radius);
+        std::int64_t top = cell(std::min(y, y + dy) - radius);
+        std::int64_t bottom = cell(std::max(y, y + dy) + radius);
+
+        for (std::int64_t cy = top; cy <= bottom; ++cy) {
+            for (std::int64_t cx = left; cx <= right; ++cx) {
+                auto it = m_grid.find(KeyOf(cx, cy));
+                if (it == m_grid.end()) {
+                    continue;
+                }
+                for (std::uint32_t index : it->second) {
+                    // Targets spanning several cells are tested once
+                    if (m_visited[index] == stamp) {
+                        continue;
+                    }
+                    m_visited[index] = stamp;
+
+                    const Target& target = m_targetList[index];
+                    if (!(target.kind & m_targets[i]) || target.entity == m_owner[i]) {
+                        continue;
+                    }
+                    float tMin = 0.0f;
+                    float tMax = 1.0f;
+                    if (ClipToSlab(x, dx, target.left - radius, target.right + radius, tMin, tMax) &&
+                        ClipToSlab(y, dy, target.top - radius, target.bottom + radius, tMin, tMax) &&
+                        tMin < best) {
+                        best = tMin;
+                        bestTarget = index;
+                    }
+                }
+            }
+        }
+
+        if (best <= 1.0f) {
+            m_hits.emplace_back(m_owner[i], m_targetList[bestTarget].entity, m_damage[i],
+                                x + dx * best, y + dy * best);
+            RemoveSlot(i);  // The last projectile moves into slot i; test it next
+        } else {
+            ++i;
+        }
+    }
+}
+
+/**
+ * @brief Move every live projectile and drop the expired ones
+ */
+void ProjectileSystem::Integrate(float deltaTime) {
+    float* x = m_x.data();
+    float* y = m_y.data();
+    float* life = m_life.data();
+    const float* vx = m_vx.data();
+    const float* vy = m_vy.data();
+    for (std::size_t i = 0; i < m_count; ++i) {
+        x[i] += vx[i] * deltaTime;
+        y[i] += vy[i] * deltaTime;
+        life[i] -= deltaTime;
+    }
+
+    for (std::size_t i = 0; i < m_count;) {
+        if (life[i] <= 0.0f) {
+            RemoveSlot(i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+void ProjectileSystem::RemoveSlot(std::size_t slot) {
+    std::size_t last = --m_count;
+    if (slot == last) {
+        return;
+    }
+    m_x[slot] = m_x[last];
+    m_y[slot] = m_y[last];
+    m_vx[slot] = m_vx[last];
+    m_vy[slot] = m_vy[last];
+    m_life[slot] = m_life[last];
+    m_damage[slot] = m_damage[last];
+    m_radius[slot] = m_radius[last];
+    m_owner[slot] = m_owner[last];
+    m_targets[slot] = m_targets[last];
+}
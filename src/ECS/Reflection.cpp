@@ -0,0 +1,335 @@
+/**
+ * @file Reflection.cpp
+ * @brief Generic serialization, delta encoding and formatting built on TypeInfo
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "ECS/Reflection.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+
+namespace {
+
+/// Maximum fields a delta mask can describe
+constexpr std::size_t MAX_DELTA_FIELDS = 64;
+
+const unsigned char* Bytes(const void* object) {
+    return static_cast<const unsigned char*>(object);
+}
+
+unsigned char* Bytes(void* object) {
+    return static_cast<unsigned char*>(object);
+}
+
+void WriteRaw(std::vector<std::uint8_t>& out, const void* data, std::size_t size) {
+    const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+    out.insert(out.end(), bytes, bytes + size);
+}
+
+bool ReadRaw(const std::uint8_t*& cursor, const std::uint8_t* end, void* data, std::size_t size) {
+    if (static_cast<std::size_t>(end - cursor) < size) {
+        return false;
+    }
+    std::memcpy(data, cursor, size);
+    cursor += size;
+    return true;
+}
+
+void WriteField(const FieldInfo& field, const void* object, std::vector<std::uint8_t>& out);
+bool ReadField(const FieldInfo& field, void* object, const std::uint8_t*& cursor, const std::uint8_t* end);
+
+void WriteField(const FieldInfo& field, const void* object, std::vector<std::uint8_t>& out) {
+    const void* address = Bytes(object) + field.offset;
+
+    switch (field.type) {
+        case FieldType::STRING: {
+            const std::string& text = *static_cast<const std::string*>(address);
+            std::uint32_t length = static_cast<std::uint32_t>(text.size());
+            WriteRaw(out, &length, sizeof(length));
+            WriteRaw(out, text.data(), text.size());
+            break;
+        }
+        case FieldType::VECTOR: {
+            const TypeInfo* element = field.vector.element();
+            std::uint32_t count = static_cast<std::uint32_t>(field.vector.size(address));
+            WriteRaw(out, &count, sizeof(count));
+            void* vector = const_cast<void*>(address);
+            for (std::uint32_t i = 0; i < count; ++i) {
+                Reflection::Serialize(*element, field.vector.at(vector, i), out);
+            }
+            break;
+        }
+        default:
+            WriteRaw(out, address, field.size);
+            break;
+    }
+}
+
+bool ReadField(const FieldInfo& field, void* object, const std::uint8_t*& cursor, const std::uint8_t* end) {
+    void* address = Bytes(object) + field.offset;
+
+    switch (field.type) {
+        case FieldType::STRING: {
+            std::uint32_t length = 0;
+            if (!ReadRaw(cursor, end, &length, sizeof(length)) ||
+                static_cast<std::size_t>(end - cursor) < length) {
+                return false;
+            }
+            static_cast<std::string*>(address)->assign(reinterpret_cast<const char*>(cursor), length);
+            cursor += length;
+            return true;
+        }
+        case FieldType::VECTOR: {
+            const TypeInfo* element = field.vector.element();
+            std::uint32_t count = 0;
+            if (!ReadRaw(cursor, end, &count, sizeof(count))) {
+                return false;
+            }
+            field.vector.resize(address, count);
+            for (std::uint32_t i = 0; i < count; ++i) {
+                if (!Reflection::Deserialize(*element, field.vector.at(address, i), cursor, end)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default:
+            return ReadRaw(cursor, end, address, field.size);
+    }
+}
+
+bool ObjectsEqual(const TypeInfo& type, const void* a, const void* b) {
+    for (const FieldInfo& field : type.fields) {
+        if (!(field.flags & FIELD_TRANSIENT) && !Reflection::FieldEquals(field, a, b)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+const FieldInfo* TypeInfo::FindField(const std::string& fieldName) const {
+    for (const FieldInfo& field : fields) {
+        if (fieldName == field.name) {
+            return &field;
+        }
+    }
+    return nullptr;
+}
+
+namespace detail {
+
+std::array<const TypeInfo*, MAX_COMPONENT_TYPES>& ComponentTypeInfos() {
+    static std::array<const TypeInfo*, MAX_COMPONENT_TYPES> infos{};
+    return infos;
+}
+
+/**
+ * @brief Precompute memcpy ranges and dynamic field indices
+ *
+ * Plain-data fields are sorted by offset and merged only when they are
+ * exactly adjacent, so padding bytes never reach the output (keeps encodings
+ * deterministic, which delta comparison relies on).
+ */
+void FinalizeTypeInfo(TypeInfo& info) {
+    if (info.fields.size() > MAX_DELTA_FIELDS) {
+        std::cerr << "⚠️  Reflection: " << info.name << " has more than " << MAX_DELTA_FIELDS
+                  << " fields; delta encoding ignores the rest" << std::endl;
+    }
+
+    std::vector<const FieldInfo*> plain;
+    for (std::size_t i = 0; i < info.fields.size(); ++i) {
+        const FieldInfo& field = info.fields[i];
+        if (field.flags & FIELD_TRANSIENT) {
+            continue;
+        }
+        if (field.IsPlainData()) {
+            plain.push_back(&field);
+        } else {
+            info.dynamicFields.push_back(i);
+        }
+    }
+
+    std::sort(plain.begin(), plain.end(),
+        [](const FieldInfo* a, const FieldInfo* b) { return a->offset < b->offset; });
+
+    for (const FieldInfo* field : plain) {
+        if (!info.podRuns.empty()) {
+            TypeInfo::PodRun& last = info.podRuns.back();
+            if (last.offset + last.size == field->offset) {
+                last.size += field->size;
+                continue;
+            }
+        }
+        info.podRuns.push_back({field->offset, field->size});
+    }
+}
+
+} // namespace detail
+
+namespace Reflection {
+
+const TypeInfo* FindComponentType(ComponentTypeID typeID) {
+    if (typeID >= MAX_COMPONENT_TYPES) {
+        return nullptr;
+    }
+    return detail::ComponentTypeInfos()[typeID];
+}
+
+void Serialize(const TypeInfo& type, const void* object, std::vector<std::uint8_t>& out) {
+    for (const TypeInfo::PodRun& run : type.podRuns) {
+        WriteRaw(out, Bytes(object) + run.offset, run.size);
+    }
+    for (std::size_t index : type.dynamicFields) {
+        WriteField(type.fields[index], object, out);
+    }
+}
+
+bool Deserialize(const TypeInfo& type, void* object, const std::uint8_t*& cursor, const std::uint8_t* end) {
+    for (const TypeInfo::PodRun& run : type.podRuns) {
+        if (!ReadRaw(cursor, end, Bytes(object) + run.offset, run.size)) {
+            return false;
+        }
+    }
+    for (std::size_t index : type.dynamicFields) {
+        if (!ReadField(type.fields[index], object, cursor, end)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SerializeDelta(const TypeInfo& type, const void* baseline, const void* object, std::vector<std::uint8_t>& out) {
+    const std::size_t fieldCount = std::min(type.fields.size(), MAX_DELTA_FIELDS);
+
+    std::uint64_t mask = 0;
+    for (std::size_t i = 0; i < fieldCount; ++i) {
+        const FieldInfo& field = type.fields[i];
+        if (!(field.flags & FIELD_TRANSIENT) && !FieldEquals(field, baseline, object)) {
+            mask |= std::uint64_t(1) << i;
+        }
+    }
+
+    WriteRaw(out, &mask, sizeof(mask));
+    for (std::size_t i = 0; i < fieldCount; ++i) {
+        if (mask & (std::uint64_t(1) << i)) {
+            WriteField(type.fields[i], object, out);
+        }
+    }
+    return mask != 0;
+}
+
+bool ApplyDelta(const TypeInfo& type, void* object, const std::uint8_t*& cursor, const std::uint8_t* end) {
+    std::uint64_t mask = 0;
+    if (!ReadRaw(cursor, end, &mask, sizeof(mask))) {
+        return false;
+    }
+
+    const std::size_t fieldCount = std::min(type.fields.size(), MAX_DELTA_FIELDS);
+    for (std::size_t i = 0; i < fieldCount; ++i) {
+        if ((mask & (std::uint64_t(1) << i)) && !ReadField(type.fields[i], object, cursor, end)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FieldEquals(const FieldInfo& field, const void* a, const void* b) {
+    const void* addressA = Bytes(a) + field.offset;
+    const void* addressB = Bytes(b) + field.offset;
+
+    switch (field.type) {
+        case FieldType::STRING:
+            return *static_cast<const std::string*>(addressA) == *static_cast<const std::string*>(addressB);
+        case FieldType::VECTOR: {
+            std::size_t count = field.vector.size(addressA);
+            if (count != field.vector.size(addressB)) {
+                return false;
+            }
+            const TypeInfo* element = field.vector.element();
+            for (std::size_t i = 0; i < count; ++i) {
+                if (!ObjectsEqual(*element,
+                                  field.vector.at(const_cast<void*>(addressA), i),
+                                  field.vector.at(const_cast<void*>(addressB), i))) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default:
+            return std::memcmp(addressA, addressB, field.size) == 0;
+    }
+}
+
+std::string FormatField(const FieldInfo& field, const void* object) {
+    const void* address = Bytes(object) + field.offset;
+    std::ostringstream text;
+
+    switch (field.type) {
+        case FieldType::BOOL:
+            text << (*static_cast<const bool*>(address) ? "true" : "false");
+            break;
+        case FieldType::UINT8:
+            text << static_cast<int>(*static_cast<const unsigned char*>(address));
+            break;
+        case FieldType::INT32:
+            text << *static_cast<const int*>(address);
+            break;
+        case FieldType::FLOAT:
+            text << std::fixed << std::setprecision(2) << *static_cast<const float*>(address);
+            break;
+        case FieldType::ENUM: {
+            long long value = 0;
+            switch (field.size) {
+                case 1: value = *static_cast<const std::int8_t*>(address); break;
+                case 2: value = *static_cast<const std::int16_t*>(address); break;
+                case 8: value = *static_cast<const std::int64_t*>(address); break;
+                default: value = *static_cast<const std::int32_t*>(address); break;
+            }
+            text << value;
+            break;
+        }
+        case FieldType::ENTITY:
+            text << "#" << static_cast<const Entity*>(address)->GetID();
+            break;
+        case FieldType::STRING:
+            text << '"' << *static_cast<const std::string*>(address) << '"';
+            break;
+        case FieldType::VECTOR:
+            text << "[" << field.vector.size(address) << " items]";
+            break;
+    }
+    return text.str();
+}
+
+std::size_t HeapBytes(const TypeInfo& type, const void* object) {
+    std::size_t bytes = 0;
+    for (const FieldInfo& field : type.fields) {
+        const void* address = Bytes(object) + field.offset;
+
+        if (field.type == FieldType::STRING) {
+            const std::string& text = *static_cast<const std::string*>(address);
+            // Anything that fits the inline buffer of an empty string is not heap allocated
+            if (text.capacity() > std::string().capacity()) {
+                bytes += text.capacity() + 1;
+            }
+        } else if (field.type == FieldType::VECTOR) {
+            const TypeInfo* element = field.vector.element();
+            bytes += field.vector.capacity(address) * element->size;
+
+            std::size_t count = field.vector.size(address);
+            void* vector = const_cast<void*>(address);
+            for (std::size_t i = 0; i < count; ++i) {
+                bytes += HeapBytes(*element, field.vector.at(vector, i));
+            }
+        }
+    }
+    return bytes;
+}
+
+} // namespace Reflection
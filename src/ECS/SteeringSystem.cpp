@@ -0,0 +1,272 @@
+/**
+ * @file SteeringSystem.cpp
+ * @brief Implementation of grid-accelerated flocking and steering
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "ECS/SteeringSystem.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+/// Neighbour sums for one agent
+struct NeighborSums {
+    float count = 0.0f;
+    float offsetX = 0.0f;     ///< Sum of offsets to flockmates (cohesion)
+    float offsetY = 0.0f;
+    float velocityX = 0.0f;   ///< Sum of flockmate velocities (alignment)
+    float velocityY = 0.0f;
+    float separateX = 0.0f;  ///< Sum of -offset / distance^2 for close flockmates
+    float separateY = 0.0f;
+};
+
+/**
+ * @brief Accumulate one contiguous span of the sorted agents
+ *
+ * No branches on the per-neighbour path: each term is multiplied by a 0/1
+ * mask so the loop vectorizes. The agent itself is at distance 0 and drops
+ * out through the distance > 0 test.
+ */
+void AccumulateSpan(const float* x, const float* y, const float* vx, const float* vy, const int* flock,
+                    std::uint32_t begin, std::uint32_t end, float selfX, float selfY, int selfFlock,
+                    float neighborRadiusSq, float separationRadiusSq, NeighborSums& sums) {
+    float count = 0.0f, offsetX = 0.0f, offsetY = 0.0f, velocityX = 0.0f, velocityY = 0.0f;
+    float separateX = 0.0f, separateY = 0.0f;
+    for (std::uint32_t j = begin; j < end; ++j) {
+        float dx = x[j] - selfX;
+        float dy = y[j] - selfY;
+        float distanceSq = dx * dx + dy * dy;
+        float mate = (flock[j] == selfFlock && distanceSq > 0.0f) ? 1.0f : 0.0f;
+        float near = distanceSq < neighborRadiusSq ? mate : 0.0f;
+        float close = distanceSq < separationRadiusSq ? mate : 0.0f;
+
+        count += near;
+        offsetX += near * dx;
+        offsetY += near * dy;
+        velocityX += near * vx[j];
+        velocityY += near * vy[j];
+
+        float push = close / (distanceSq + 1e-4f);
+        separateX -= dx * push;
+        separateY -= dy * push;
+    }
+    sums.count += count;
+    sums.offsetX += offsetX;
+    sums.offsetY += offsetY;
+    sums.velocityX += velocityX;
+    sums.velocityY += velocityY;
+    sums.separateX += separateX;
+    sums.separateY += separateY;
+}
+
+/**
+ * @brief Add weight * (desired - velocity), where desired points along (dirX, dirY) at full speed
+ */
+void AddSteer(float dirX, float dirY, float weight, float maxSpeed, float vx, float vy,
+              float& forceX, float& forceY) {
+    float length = std::sqrt(dirX * dirX + dirY * dirY);
+    if (weight == 0.0f || length <= 1e-6f) {
+        return;
+    }
+    float scale = maxSpeed / length;
+    forceX += weight * (dirX * scale - vx);
+    forceY += weight * (dirY * scale - vy);
+}
+
+/// Scale (x, y) down to at most limit
+void Truncate(float& x, float& y, float limit) {
+    float lengthSq = x * x + y * y;
+    if (lengthSq > limit * limit) {
+        float scale = limit / std::sqrt(lengthSq);
+        x *= scale;
+        y *= scale;
+    }
+}
+
+} // namespace
+
+void SteeringSystem::Update(float deltaTime) {
+    m_neighborCount = 0;
+    if (GetEntities().Empty()) {
+        return;
+    }
+    BuildGrid();
+    SteerAgents(deltaTime);
+}
+
+void SteeringSystem::AddObstacle(float x, float y, float radius) {
+    m_obstacleX.push_back(x);
+    m_obstacleY.push_back(y);
+    m_obstacleRadius.push_back(radius);
+}
+
+void SteeringSystem::ClearObstacles() {
+    m_obstacleX.clear();
+    m_obstacleY.clear();
+    m_obstacleRadius.clear();
+}
+
+/**
+ * @brief Gather agents and counting-sort them into grid cell order
+ *
+ * The grid covers only the agents' bounding box, with cells at least as
+ * large as the largest neighbour radius so a 3x3 block holds every
+ * neighbour. A very spread-out swarm gets larger cells rather than a grid
+ * with far more cells than agents.
+ */
+void SteeringSystem::BuildGrid() {
+    const std::size_t count = GetEntities().Size();
+    m_unsorted.clear();
+    m_unsorted.reserve(count);
+
+    float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+    float radius = 1.0f;
+    for (Entity entity : GetEntities()) {
+        const auto* transform = m_entityManager->ReadComponent<TransformComponent>(entity);
+        const auto* steering = m_entityManager->ReadComponent<SteeringComponent>(entity);
+        if (m_unsorted.empty()) {
+            minX = maxX = transform->x;
+            minY = maxY = transform->y;
+        }
+        minX = std::min(minX, transform->x);
+        minY = std::min(minY, transform->y);
+        maxX = std::max(maxX, transform->x);
+        maxY = std::max(maxY, transform->y);
+        radius = std::max({radius, steering->neighborRadius, steering->separationRadius});
+        m_unsorted.push_back(entity);
+    }
+
+    const double maxCells = static_cast<double>(std::max<std::size_t>(4 * count, 1024));
+    double spanX = static_cast<double>(maxX - minX);
+    double spanY = static_cast<double>(maxY - minY);
+    double cells = (spanX / radius + 1.0) * (spanY / radius + 1.0);
+    if (cells > maxCells) {
+        radius = static_cast<float>(radius * std::sqrt(cells / maxCells));
+    }
+    m_cellSize = radius;
+    m_originX = minX;
+    m_originY = minY;
+    m_columns = static_cast<int>(spanX / m_cellSize) + 1;
+    m_rows = static_cast<int>(spanY / m_cellSize) + 1;
+
+    // Count agents per cell, prefix-sum into cell starts, then scatter
+    m_cellStart.assign(static_cast<std::size_t>(m_columns) * m_rows + 1, 0);
+    m_cellOf.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto* transform = m_entityManager->ReadComponent<TransformComponent>(m_unsorted[i]);
+        int cx = std::min(static_cast<int>((transform->x - m_originX) / m_cellSize), m_columns - 1);
+        int cy = std::min(static_cast<int>((transform->y - m_originY) / m_cellSize), m_rows - 1);
+        m_cellOf[i] = static_cast<std::uint32_t>(cy * m_columns + cx);
+        ++m_cellStart[m_cellOf[i] + 1];
+    }
+    for (std::size_t c = 1; c < m_cellStart.size(); ++c) {
+        m_cellStart[c] += m_cellStart[c - 1];
+    }
+
+    m_agents.resize(count);
+    m_x.resize(count);
+    m_y.resize(count);
+    m_vx.resize(count);
+    m_vy.resize(count);
+    m_flock.resize(count);
+    m_cellNext.assign(m_cellStart.begin(), m_cellStart.end() - 1);
+    for (std::size_t i = 0; i < count; ++i) {
+        Entity entity = m_unsorted[i];
+        std::uint32_t slot = m_cellNext[m_cellOf[i]]++;
+        const auto* transform = m_entityManager->ReadComponent<TransformComponent>(entity);
+        const auto* velocity = m_entityManager->ReadComponent<VelocityComponent>(entity);
+        m_agents[slot] = entity;
+        m_x[slot] = transform->x;
+        m_y[slot] = transform->y;
+        m_vx[slot] = velocity->vx;
+        m_vy[slot] = velocity->vy;
+        m_flock[slot] = m_entityManager->ReadComponent<SteeringComponent>(entity)->flock;
+    }
+}
+
+/**
+ * @brief Combine the behaviours for every agent and write the new velocities
+ *
+ * All neighbour reads come from the snapshot taken in BuildGrid(), so the
+ * result doesn't depend on the order agents are processed in.
+ */
+void SteeringSystem::SteerAgents(float deltaTime) {
+    const std::size_t count = m_agents.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto* steering = m_entityManager->ReadComponent<SteeringComponent>(m_agents[i]);
+        const float x = m_x[i];
+        const float y = m_y[i];
+        const float vx = m_vx[i];
+        const float vy = m_vy[i];
+
+        NeighborSums sums;
+        if (steering->separationWeight != 0.0f || steering->alignmentWeight != 0.0f ||
+            steering->cohesionWeight != 0.0f) {
+            int cx = std::min(static_cast<int>((x - m_originX) / m_cellSize), m_columns - 1);
+            int cy = std::min(static_cast<int>((y - m_originY) / m_cellSize), m_rows - 1);
+            int left = std::max(cx - 1, 0);
+            int right = std::min(cx + 1, m_columns - 1);
+            float neighborSq = steering->neighborRadius * steering->neighborRadius;
+            float separationSq = steering->separationRadius * steering->separationRadius;
+            // Cells in one row are adjacent in sorted order: one span per row
+            for (int row = std::max(cy - 1, 0); row <= std::min(cy + 1, m_rows - 1); ++row) {
+                std::uint32_t begin = m_cellStart[row * m_columns + left];
+                std::uint32_t end = m_cellStart[row * m_columns + right + 1];
+                AccumulateSpan(m_x.data(), m_y.data(), m_vx.data(), m_vy.data(), m_flock.data(),
+                               begin, end, x, y, m_flock[i], neighborSq, separationSq, sums);
+            }
+            m_neighborCount += static_cast<std::size_t>(sums.count);
+        }
+
+        float forceX = 0.0f;
+        float forceY = 0.0f;
+        const float speed = steering->maxSpeed;
+        AddSteer(sums.separateX, sums.separateY, steering->separationWeight, speed, vx, vy, forceX, forceY);
+        if (sums.count > 0.0f) {
+            // Cohesion steers toward the flockmates' centre: the mean offset
+            AddSteer(sums.offsetX, sums.offsetY, steering->cohesionWeight, speed, vx, vy, forceX, forceY);
+            AddSteer(sums.velocityX, sums.velocityY, steering->alignmentWeight, speed, vx, vy, forceX, forceY);
+        }
+
+        if (steering->seekWeight != 0.0f) {
+            float targetX = steering->seekX;
+            float targetY = steering->seekY;
+            if (steering->seekTarget.IsValid()) {
+                if (const auto* target = m_entityManager->ReadComponent<TransformComponent>(steering->seekTarget)) {
+                    targetX = target->x;
+                    targetY = target->y;
+                }
+            }
+            AddSteer(targetX - x, targetY - y, steering->seekWeight, speed, vx, vy, forceX, forceY);
+        }
+
+        if (steering->avoidWeight != 0.0f && !m_obstacleX.empty()) {
+            // Push away from each obstacle, harder the closer its edge is
+            float awayX = 0.0f;
+            float awayY = 0.0f;
+            for (std::size_t o = 0; o < m_obstacleX.size(); ++o) {
+                float dx = x - m_obstacleX[o];
+                float dy = y - m_obstacleY[o];
+                float distance = std::sqrt(dx * dx + dy * dy);
+                float gap = distance - m_obstacleRadius[o];
+                if (gap < steering->neighborRadius && distance > 1e-6f) {
+                    float strength = 1.0f - std::max(gap, 0.0f) / steering->neighborRadius;
+                    awayX += dx / distance * strength;
+                    awayY += dy / distance * strength;
+                }
+            }
+            AddSteer(awayX, awayY, steering->avoidWeight, speed, vx, vy, forceX, forceY);
+        }
+
+        Truncate(forceX, forceY, steering->maxForce);
+        float newVx = vx + forceX * deltaTime;
+        float newVy = vy + forceY * deltaTime;
+        Truncate(newVx, newVy, speed);
+
+        auto* velocity = m_entityManager->GetComponent<VelocityComponent>(m_agents[i]);
+        velocity->vx = newVx;
+        velocity->vy = newVy;
+    }
+}
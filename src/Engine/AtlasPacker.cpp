@@ -0,0 +1,53 @@
+/**
+ * @file AtlasPacker.cpp
+ * @brief Implementation of the shelf rectangle packer
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "Engine/AtlasPacker.h"
+
+void AtlasPacker::Reset(int width, int height) {
+    m_shelves.clear();
+    m_width = width;
+    m_height = height;
+    m_nextY = 0;
+    m_area = 0;
+}
+
+bool AtlasPacker::Insert(int width, int height, int& x, int& y) {
+    const int paddedW = width + PADDING;
+    const int paddedH = height + PADDING;
+    if (width <= 0 || height <= 0 || paddedW > m_width) {
+        return false;
+    }
+
+    // Shortest shelf that is tall enough and has room left
+    Shelf* best = nullptr;
+    for (Shelf& shelf : m_shelves) {
+        if (shelf.height >= paddedH && shelf.used + paddedW <= m_width &&
+            (!best || shelf.height < best->height)) {
+            best = &shelf;
+        }
+    }
+
+    if (!best) {
+        if (m_nextY + paddedH > m_height) {
+            return false;
+        }
+        m_shelves.push_back(Shelf{m_nextY, paddedH, 0});
+        m_nextY += paddedH;
+        best = &m_shelves.back();
+    }
+
+    x = best->used;
+    y = best->y;
+    best->used += paddedW;
+    m_area += static_cast<long>(paddedW) * paddedH;
+    return true;
+}
+
+float AtlasPacker::GetUsage() const {
+    long pageArea = static_cast<long>(m_width) * m_height;
+    return pageArea > 0 ? static_cast<float>(m_area) / pageArea : 0.0f;
+}
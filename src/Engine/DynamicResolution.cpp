@@ -0,0 +1,48 @@
+/**
+ * @file DynamicResolution.cpp
+ * @brief Implementation of the dynamic resolution controller
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "Engine/DynamicResolution.h"
+#include <algorithm>
+
+void DynamicResolution::Configure(const Settings& settings) {
+    m_settings = settings;
+    m_settings.maxScale = std::clamp(m_settings.maxScale, 0.1f, 1.0f);
+    m_settings.minScale = std::clamp(m_settings.minScale, 0.1f, m_settings.maxScale);
+    m_settings.step = std::max(m_settings.step, 0.01f);
+    m_settings.raiseThreshold = std::min(m_settings.raiseThreshold, m_settings.dropThreshold);
+    Reset();
+}
+
+void DynamicResolution::Reset() {
+    m_scale = m_settings.enabled ? m_settings.maxScale : 1.0f;
+    m_frameCount = 0;
+    m_frameSum = 0.0f;
+}
+
+float DynamicResolution::Update(float busyMs) {
+    if (!m_settings.enabled) {
+        return m_scale;
+    }
+
+    // Windows are consecutive, not sliding: one decision per WINDOW frames
+    ++m_frameCount;
+    m_frameSum += busyMs;
+    if (m_frameCount < WINDOW) {
+        return m_scale;
+    }
+
+    const float average = m_frameSum / WINDOW;
+    m_frameCount = 0;
+    m_frameSum = 0.0f;
+
+    if (average > m_settings.targetFrameMs * m_settings.dropThreshold) {
+        m_scale = std::max(m_settings.minScale, m_scale - m_settings.step);
+    } else if (average < m_settings.targetFrameMs * m_settings.raiseThreshold) {
+        m_scale = std::min(m_settings.maxScale, m_scale + m_settings.step);
+    }
+    return m_scale;
+}
@@ -0,0 +1,368 @@
+/**
+ * @file ECSInspector.cpp
+ * @brief Implementation of the live ECS inspector overlay
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "Engine/ECSInspector.h"
+#include "Engine/BitmapFont.h"
+#include "Engine/InputManager.h"
+#include "ECS/EntityManager.h"
+#include "ECS/Reflection.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+
+constexpr int MAX_LINES = 60;       ///< Overlay is truncated beyond this many lines
+constexpr int NAME_COLUMN = 20;
+constexpr int COUNT_COLUMN = 9;
+constexpr int GLYPH_ADVANCE = 6;    ///< BitmapFont: 5 pixel glyph + 1 pixel gap
+constexpr int LINE_ADVANCE = 9;     ///< BitmapFont: 7 pixel glyph + 2 pixel gap
+constexpr int PANEL_PADDING = 4;
+constexpr int PANEL_MARGIN = 8;
+
+/// Pixel size BitmapFont::DrawText will use at scale 1
+int GlyphScale() {
+    return std::max(1, static_cast<int>(BitmapFont::GetGlobalScale()));
+}
+
+/// Drop a trailing "Component"/"System" so names fit the column
+std::string ShortName(std::string name, const std::string& suffix) {
+    if (name.size() > suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0) {
+        name.erase(name.size() - suffix.size());
+    }
+    return name;
+}
+
+std::string Column(const std::string& text, int width) {
+    std::string padded = text.substr(0, static_cast<std::size_t>(width - 1));
+    padded.resize(static_cast<std::size_t>(width), ' ');
+    return padded;
+}
+
+std::string FormatBytes(std::size_t bytes) {
+    std::ostringstream text;
+    if (bytes >= 10 * 1024) {
+        text << bytes / 1024 << "K";
+    } else {
+        text << bytes;
+    }
+    return text.str();
+}
+
+} // namespace
+
+void ECSInspector::Toggle() {
+    m_visible = !m_visible;
+    m_refreshTimer = 0.0f; // Refresh on the next Update()
+}
+
+void ECSInspector::HandleInput(const InputManager& input, const Renderer& renderer, const EntityManager& manager,
+                               float cameraX) {
+    if (!m_visible || !input.IsMouseButtonJustPressed(MouseButton::LEFT)) {
+        return;
+    }
+
+    float logicalX = 0.0f, logicalY = 0.0f;
+    renderer.WindowToLogical(input.GetMouseX(), input.GetMouseY(), logicalX, logicalY);
+    const float worldX = logicalX + cameraX;
+    const float worldY = logicalY;
+
+    Entity picked;
+    manager.ForEachComponent(GetComponentTypeID<TransformComponent>(), [&](const Component& component) {
+        if (picked.IsValid()) {
+            return;
+        }
+
+        const auto& transform = static_cast<const TransformComponent&>(component);
+        float width = 32.0f;
+        float height = 32.0f;
+        if (const auto* collision = manager.GetComponent<CollisionComponent>(component.owner)) {
+            width = collision->width;
+            height = collision->height;
+        } else if (const auto* render = manager.ReadComponent<RenderComponent>(component.owner)) {
+            width = static_cast<float>(render->width);
+            height = static_cast<float>(render->height);
+        }
+
+        if (worldX >= transform.x && worldX < transform.x + width &&
+            worldY >= transform.y && worldY < transform.y + height) {
+            picked = component.owner;
+        }
+    });
+
+    m_selected = picked;
+    m_refreshTimer = 0.0f;
+}
+
+void ECSInspector::Update(float deltaTime, const EntityManager& manager) {
+    if (!m_visible) {
+        return;
+    }
+
+    m_refreshTimer -= deltaTime;
+    if (m_refreshTimer > 0.0f) {
+        return;
+    }
+    m_refreshTimer = REFRESH_INTERVAL;
+
+    auto start = std::chrono::steady_clock::now();
+    RebuildText(manager);
+    std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    m_lastRebuildMs = elapsed.count();
+}
+
+void ECSInspector::Render(Renderer* renderer) {
+    if (!m_visible || !renderer || m_lines.empty()) {
+        return;
+    }
+
+    if (m_layerDirty) {
+        if (!RedrawLayer(renderer)) {
+            // No render-target support: draw the text directly (slow path)
+            const int s = GlyphScale();
+            renderer->DrawRectangle(Rectangle(PANEL_MARGIN, PANEL_MARGIN, m_contentWidth, m_contentHeight),
+                                    Color(0, 0, 0, 190), true);
+            DrawLines(renderer, PANEL_MARGIN + PANEL_PADDING * s, PANEL_MARGIN + PANEL_PADDING * s);
+            return;
+        }
+        m_layerDirty = false;
+    }
+
+    SDL_Rect source = {0, 0, m_contentWidth, m_contentHeight};
+    SDL_Rect destination = {PANEL_MARGIN, PANEL_MARGIN, m_contentWidth, m_contentHeight};
+    SDL_RenderCopy(renderer->GetSDLRenderer(), m_layer, &source, &destination);
+}
+
+void ECSInspector::Reset() {
+    m_selected = Entity();
+    m_lines.clear();
+    m_layerDirty = true;
+    m_refreshTimer = 0.0f;
+}
+
+void ECSInspector::ReleaseResources() {
+    if (m_layer) {
+        SDL_DestroyTexture(m_layer);
+    }
+    m_layer = nullptr;
+    m_layerOwner = nullptr;
+    m_layerWidth = 0;
+    m_layerHeight = 0;
+    m_layerDirty = true;
+}
+
+void ECSInspector::RebuildText(const EntityManager& manager) {
+    m_lines.clear();
+
+    std::ostringstream header;
+    header << "ECS INSPECTOR   ENTITIES " << manager.GetEntityCount()
+           << "   REFRESH " << std::fixed << std::setprecision(2) << m_lastRebuildMs << " MS";
+    m_lines.push_back(header.str());
+    m_lines.push_back("RENDER   DRAWS " + std::to_string(m_renderStats.drawCalls) +
+                      "   STATE CALLS " + std::to_string(m_renderStats.stateCalls) +
+                      "   SKIPPED " + std::to_string(m_renderStats.stateCallsSkipped));
+    m_lines.emplace_back();
+
+    AppendComponentStats(manager);
+    m_lines.emplace_back();
+    AppendSystemStats(manager);
+    m_lines.emplace_back();
+    AppendSelection(manager);
+
+    if (m_lines.size() > static_cast<std::size_t>(MAX_LINES)) {
+        m_lines.resize(MAX_LINES - 1);
+        m_lines.push_back("...");
+    }
+
+    std::size_t longest = 0;
+    for (const std::string& line : m_lines) {
+        longest = std::max(longest, line.size());
+    }
+
+    const int s = GlyphScale();
+    m_contentWidth = (static_cast<int>(longest) * GLYPH_ADVANCE + PANEL_PADDING * 2) * s;
+    m_contentHeight = (static_cast<int>(m_lines.size()) * LINE_ADVANCE + PANEL_PADDING * 2) * s;
+    m_layerDirty = true;
+}
+
+void ECSInspector::AppendComponentStats(const EntityManager& manager) {
+    m_lines.push_back(Column("COMPONENT", NAME_COLUMN) + Column("COUNT", COUNT_COLUMN) + "BYTES");
+
+    std::size_t totalBytes = 0;
+    for (ComponentTypeID typeID = 0; typeID < MAX_COMPONENT_TYPES; ++typeID) {
+        std::size_t count = manager.GetComponentCount(typeID);
+        if (count == 0) {
+            continue;
+        }
+
+        const TypeInfo* info = Reflection::FindComponentType(typeID);
+        const SharedComponentPoolBase* shared = manager.GetSharedPool(typeID);
+        std::string name;
+        std::string bytesText = "-";
+        if (shared) {
+            // Count is references; bytes are the distinct values actually stored
+            name = "SHARED " + ShortName(shared->GetValueType().name, "Component");
+            std::size_t bytes = shared->GetBytes();
+            totalBytes += bytes;
+            bytesText = FormatBytes(bytes) + " (" + std::to_string(shared->GetValueCount()) + " VALUES)";
+        } else if (info && info->isTag) {
+            name = ShortName(info->name, "Tag") + " TAG";
+            bytesText = "0";
+        } else if (info) {
+            name = ShortName(info->name, "Component");
+
+            // Object size plus whatever its strings and vectors own on the heap
+            std::size_t bytes = count * info->size;
+            manager.ForEachComponent(typeID, [&](const Component& component) {
+                bytes += Reflection::HeapBytes(*info, info->fromBase(&component));
+            });
+            totalBytes += bytes;
+            bytesText = FormatBytes(bytes);
+        } else {
+            name = "TYPE " + std::to_string(typeID);
+        }
+
+        m_lines.push_back(Column(name, NAME_COLUMN) + Column(std::to_string(count), COUNT_COLUMN) + bytesText);
+    }
+
+    m_lines.push_back(Column("TOTAL", NAME_COLUMN + COUNT_COLUMN) + FormatBytes(totalBytes));
+
+    // Pool capacity kept from peaks; CompactStorage() releases it
+    StorageStats storage = manager.GetStorageStats();
+    m_lines.push_back(Column("POOLS RESERVED", NAME_COLUMN + COUNT_COLUMN) + FormatBytes(storage.reservedBytes) +
+                      "  UNUSED " + FormatBytes(storage.reservedBytes - storage.usedBytes));
+}
+
+void ECSInspector::AppendSystemStats(const EntityManager& manager) {
+    m_lines.push_back(Column("SYSTEM", NAME_COLUMN) + Column("ENTITIES", COUNT_COLUMN) + "MS");
+
+    for (const System* system : manager.GetSystems()) {
+        std::ostringstream time;
+        time << std::fixed << std::setprecision(3) << system->GetLastUpdateMs();
+        m_lines.push_back(Column(ShortName(system->GetName(), "System"), NAME_COLUMN) +
+                          Column(std::to_string(system->GetEntities().Size()), COUNT_COLUMN) + time.str());
+    }
+}
+
+void ECSInspector::AppendSelection(const EntityManager& manager) {
+    if (!m_selected.IsValid()) {
+        m_lines.push_back("CLICK AN ENTITY TO INSPECT IT");
+        return;
+    }
+    if (!manager.IsEntityValid(m_selected)) {
+        m_lines.push_back("ENTITY " + std::to_string(m_selected.GetID()) + " DESTROYED");
+        return;
+    }
+
+    m_lines.push_back("ENTITY " + std::to_string(m_selected.GetID()));
+
+    Signature signature = manager.GetSignature(m_selected);
+    for (ComponentTypeID typeID = 0; typeID < MAX_COMPONENT_TYPES; ++typeID) {
+        if (!signature.test(typeID)) {
+            continue;
+        }
+
+        const TypeInfo* info = Reflection::FindComponentType(typeID);
+        const Component* component = manager.GetComponent(m_selected, typeID);
+        std::string prefix;
+        if (const SharedComponentPoolBase* shared = manager.GetSharedPool(typeID)) {
+            info = &shared->GetValueType();
+            component = shared->GetValue(m_selected.GetID());
+            prefix = "SHARED ";
+        } else if (info && info->isTag) {
+            m_lines.push_back(" " + ShortName(info->name, "Tag") + " TAG");
+            continue;
+        }
+        if (!info || !component) {
+            m_lines.push_back(" TYPE " + std::to_string(typeID));
+            continue;
+        }
+
+        m_lines.push_back(" " + prefix + ShortName(info->name, "Component"));
+        const void* object = info->fromBase(component);
+        for (const FieldInfo& field : info->fields) {
+            if (!(field.flags & FIELD_HIDDEN)) {
+                m_lines.push_back("  " + std::string(field.name) + ": " + Reflection::FormatField(field, object));
+            }
+        }
+    }
+
+    // Outgoing and incoming wording per Relation (the font has no arrows)
+    static const char* const LINK_NAMES[RELATION_COUNT] = {"TARGETS", "CHILD OF", "OWNED BY"};
+    static const char* const REVERSE_NAMES[RELATION_COUNT] = {"TARGETED BY", "PARENT OF", "OWNS"};
+    for (std::size_t i = 0; i < RELATION_COUNT; ++i) {
+        Relation relation = static_cast<Relation>(i);
+        Entity target = manager.GetRelation(m_selected, relation);
+        std::size_t sources = manager.GetRelationSources(relation, m_selected).size();
+        if (target.IsValid()) {
+            m_lines.push_back(" " + std::string(LINK_NAMES[i]) + " ENTITY " + std::to_string(target.GetID()));
+        }
+        if (sources > 0) {
+            m_lines.push_back(" " + std::string(REVERSE_NAMES[i]) + " " + std::to_string(sources) + " ENTITIES");
+        }
+    }
+}
+
+bool ECSInspector::RedrawLayer(Renderer* renderer) {
+    SDL_Renderer* sdlRenderer = renderer->GetSDLRenderer();
+    if (m_layerOwner != sdlRenderer) {
+        // The previous renderer (if any) released its textures when it was destroyed
+        m_layer = nullptr;
+        m_layerWidth = 0;
+        m_layerHeight = 0;
+        m_layerOwner = sdlRenderer;
+    }
+
+    if (!SDL_RenderTargetSupported(sdlRenderer)) {
+        return false;
+    }
+
+    if (!m_layer || m_contentWidth > m_layerWidth || m_contentHeight > m_layerHeight) {
+        if (m_layer) {
+            SDL_DestroyTexture(m_layer);
+        }
+        m_layerWidth = std::max(m_contentWidth, m_layerWidth);
+        m_layerHeight = std::max(m_contentHeight, m_layerHeight);
+        m_layer = SDL_CreateTexture(sdlRenderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                    m_layerWidth, m_layerHeight);
+        if (!m_layer) {
+            m_layerWidth = 0;
+            m_layerHeight = 0;
+            return false;
+        }
+        SDL_SetTextureBlendMode(m_layer, SDL_BLENDMODE_BLEND);
+    }
+
+    SDL_Texture* previousTarget = renderer->GetRenderTarget();
+    if (!renderer->SetRenderTarget(m_layer)) {
+        return false;
+    }
+
+    renderer->SetDrawColor(Color(0, 0, 0, 0));
+    SDL_RenderClear(sdlRenderer);
+
+    const int s = GlyphScale();
+    renderer->DrawRectangle(Rectangle(0, 0, m_contentWidth, m_contentHeight), Color(0, 0, 0, 190), true);
+    DrawLines(renderer, PANEL_PADDING * s, PANEL_PADDING * s);
+
+    renderer->SetRenderTarget(previousTarget);
+    return true;
+}
+
+void ECSInspector::DrawLines(Renderer* renderer, int x, int y) const {
+    const int lineHeight = LINE_ADVANCE * GlyphScale();
+    const Color headerColor(255, 220, 120, 255);
+    const Color textColor(230, 230, 230, 255);
+
+    for (std::size_t i = 0; i < m_lines.size(); ++i) {
+        // The first line of each blank-separated section is its header
+        bool isHeader = i == 0 || m_lines[i - 1].empty();
+        BitmapFont::DrawText(renderer, m_lines[i], x, y + static_cast<int>(i) * lineHeight, 1,
+                             isHeader ? headerColor : textColor);
+    }
+}
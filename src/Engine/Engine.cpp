@@ -138,6 +138,7 @@ bool Engine::Initialize(const char* title, int width, int height) {
 
     // Optionally update logical size to match output to reduce black bars
     if (m_renderer) m_renderer->UpdateLogicalToOutput();
+    ConfigureDynamicResolution();
 
     // Step 4: Create input manager for user interaction
     // Input manager handles keyboard, mouse, and gamepad input
@@ -226,6 +227,16 @@ void Engine::Run() {
         // This is where game-specific rendering happens (sprites, UI, etc.)
         Render();
 
+        // Adjust the world resolution for the next frame from this frame's
+        // busy time (before Present, which may block on VSync). SDL batches
+        // draws until something forces them out, so flush first or their
+        // cost would land in Present and never be counted.
+        if (m_dynamicResolution.IsEnabled()) {
+            m_renderer->Flush();
+            std::chrono::duration<float, std::milli> busy = std::chrono::high_resolution_clock::now() - m_frameStartTime;
+            m_renderer->SetRenderScale(m_dynamicResolution.Update(busy.count()));
+        }
+
         // Present the completed frame to the screen (swap buffers)
         m_renderer->Present();
 
@@ -267,10 +278,39 @@ void Engine::RecreateRendererFromConfig() {
             int fpsLimit = cfg.Get("visual", "fps_limit", 60).AsInt();
             SetTargetFPS(fpsLimit <= 0 ? 0 : fpsLimit);
         }
+        ConfigureDynamicResolution();
         std::cout << "✅ Renderer reinitialized from config" << std::endl;
     }
 }
 
+void Engine::ConfigureDynamicResolution() {
+    DynamicResolution::Settings settings;
+    ConfigManager cfg;
+    if (cfg.LoadFromFile("assets/config/gameplay.ini")) {
+        settings.enabled = cfg.Get("visual", "dynamic_resolution", settings.enabled).AsBool();
+        settings.minScale = cfg.Get("visual", "dynamic_resolution_min_scale", settings.minScale).AsFloat();
+        settings.maxScale = cfg.Get("visual", "dynamic_resolution_max_scale", settings.maxScale).AsFloat();
+        settings.step = cfg.Get("visual", "dynamic_resolution_step", settings.step).AsFloat();
+        int targetFPS = cfg.Get("visual", "dynamic_resolution_target_fps", 60).AsInt();
+        settings.targetFrameMs = 1000.0f / std::max(1, targetFPS);
+        settings.dropThreshold = cfg.Get("visual", "dynamic_resolution_drop_threshold", settings.dropThreshold).AsFloat();
+        settings.raiseThreshold = cfg.Get("visual", "dynamic_resolution_raise_threshold", settings.raiseThreshold).AsFloat();
+    }
+    if (settings.enabled && !(m_renderer && m_renderer->IsUsingFrameTarget())) {
+        std::cout << "⚠️  dynamic_resolution needs render_to_target=true; disabled" << std::endl;
+        settings.enabled = false;
+    }
+
+    m_dynamicResolution.Configure(settings);
+    if (m_renderer) {
+        m_renderer->SetRenderScale(m_dynamicResolution.GetScale());
+    }
+    if (settings.enabled) {
+        std::cout << "✅ Dynamic resolution: scale " << m_dynamicResolution.GetSettings().minScale << "-"
+                  << m_dynamicResolution.GetSettings().maxScale << ", target " << settings.targetFrameMs << " ms" << std::endl;
+    }
+}
+
 /**
  * @brief Clean shutdown of all engine systems
  *
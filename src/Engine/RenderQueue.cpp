@@ -0,0 +1,248 @@
+/**
+ * @file RenderQueue.cpp
+ * @brief Implementation of the coherent radix-sorted render queue
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "Engine/RenderQueue.h"
+#include <utility>
+
+namespace {
+
+constexpr std::uint32_t NO_ITEM = 0xFFFFFFFFu;
+
+std::uint64_t Pack(std::uint32_t key, std::uint32_t index) {
+    return (static_cast<std::uint64_t>(key) << 32) | index;
+}
+
+/// Bits needed to store value (0 for 0)
+int BitWidth(std::uint32_t value) {
+    int bits = 0;
+    while (value != 0) {
+        ++bits;
+        value >>= 1;
+    }
+    return bits;
+}
+
+} // namespace
+
+const std::vector<std::uint32_t>& RenderQueue::Sort() {
+    const std::size_t count = m_ids.size();
+    m_packed.resize(count);
+    LayOutByLastRank();
+
+    // After a full-budget fix-up failed, motion is likely still heavy: the
+    // next frame gives up sooner so a hopeless fix-up wastes little, and the
+    // one after tries the full budget again
+    const std::size_t divisor = m_shortFixUp ? FIX_UP_BUDGET_DIVISOR * 8 : FIX_UP_BUDGET_DIVISOR;
+    const bool fixedUp = InsertionFixUp(count / divisor + 1);
+    m_shortFixUp = !fixedUp && !m_shortFixUp;
+
+    m_lastPasses = 0;
+    m_order.resize(count);
+    bool orderWritten = false;  // RadixSortNarrow() fills m_order itself
+    if (!fixedUp) {
+        orderWritten = RadixSortNarrow();
+        if (!orderWritten) {
+            RadixSort();
+        }
+    }
+    m_alreadySorted = m_lastMoves == 0;
+
+    // Publish the order and stamp each id's rank for next frame. Stamping
+    // with the frame number means last frame's ranks never need clearing.
+    if (++m_frame == 0) {
+        m_ranks.assign(m_ranks.size(), Rank());
+        m_frame = 1;
+    }
+    for (std::size_t rank = 0; rank < count; ++rank) {
+        std::uint32_t index = orderWritten ? m_order[rank] : static_cast<std::uint32_t>(m_packed[rank]);
+        std::uint32_t id = m_ids[index];
+        m_order[rank] = index;
+        if (id >= m_ranks.size()) {
+            m_ranks.resize(static_cast<std::size_t>(id) + 1);
+        }
+        if (m_ranks[id].frame != m_frame) {
+            m_ranks[id] = Rank{m_frame, static_cast<std::uint32_t>(rank)};
+        }
+    }
+    m_lastCount = count;
+    return m_order;
+}
+
+/**
+ * @brief Fill m_packed with the items in last frame's order
+ *
+ * Items whose id was drawn last frame go to their old rank (a counting
+ * scatter over last frame's item count); new ids follow in push order.
+ */
+void RenderQueue::LayOutByLastRank() {
+    m_rankSlot.assign(m_lastCount, NO_ITEM);
+    m_scratch.clear();
+
+    const std::uint32_t lastFrame = m_frame;
+    const std::size_t known = m_ranks.size();
+    for (std::size_t i = 0; i < m_ids.size(); ++i) {
+        std::uint32_t id = m_ids[i];
+        if (lastFrame != 0 && id < known && m_ranks[id].frame == lastFrame &&
+            m_rankSlot[m_ranks[id].rank] == NO_ITEM) {
+            m_rankSlot[m_ranks[id].rank] = static_cast<std::uint32_t>(i);
+        } else {
+            m_scratch.push_back(Pack(m_keys[i], static_cast<std::uint32_t>(i)));
+        }
+    }
+
+    std::size_t out = 0;
+    for (std::uint32_t index : m_rankSlot) {
+        if (index != NO_ITEM) {
+            m_packed[out++] = Pack(m_keys[index], index);
+        }
+    }
+    for (std::uint64_t newcomer : m_scratch) {
+        m_packed[out++] = newcomer;
+    }
+}
+
+/**
+ * @brief Insertion sort m_packed on its high 32 bits, giving up after maxMoves shifts
+ *
+ * After the coherent layout the work is the number of inversions, usually
+ * a handful of sprites that crossed a neighbour. Strict comparisons keep
+ * equal keys in order, and giving up part-way leaves a permutation whose
+ * ties are still in order, so RadixSort() can finish the job stably.
+ *
+ * @return true if m_packed is sorted
+ */
+bool RenderQueue::InsertionFixUp(std::size_t maxMoves) {
+    m_lastMoves = 0;
+    std::uint64_t* packed = m_packed.data();
+    const std::size_t count = m_packed.size();
+    for (std::size_t i = 1; i < count; ++i) {
+        const std::uint64_t item = packed[i];
+        const std::uint64_t key = item >> 32;
+        if (key >= (packed[i - 1] >> 32)) {
+            continue;
+        }
+
+        std::size_t j = i;
+        do {
+            packed[j] = packed[j - 1];
+            --j;
+            if (++m_lastMoves > maxMoves) {
+                packed[j] = item;
+                return false;
+            }
+        } while (j > 0 && (packed[j - 1] >> 32) > key);
+        packed[j] = item;
+    }
+    return true;
+}
+
+/**
+ * @brief Stable radix sort of 32-bit (key - min key, index) words into m_order
+ *
+ * A frame's keys usually span far fewer than 24 bits (one or two layers, a
+ * screen's height of depth), so key offset and push index often fit one
+ * 32-bit word. Sorting those halves the memory traffic of the 64-bit
+ * passes, and NARROW_DIGIT_BITS-wide digits cover a typical span in two
+ * passes instead of three.
+ *
+ * @return false (nothing changed) if the words would not fit in 32 bits
+ */
+bool RenderQueue::RadixSortNarrow() {
+    const std::size_t count = m_packed.size();
+    std::uint32_t minKey = 0xFFFFFFFFu;
+    std::uint32_t maxKey = 0;
+    for (std::uint64_t packed : m_packed) {
+        auto key = static_cast<std::uint32_t>(packed >> 32);
+        minKey = key < minKey ? key : minKey;
+        maxKey = key > maxKey ? key : maxKey;
+    }
+    const int indexBits = BitWidth(static_cast<std::uint32_t>(count - 1));
+    const int keyBits = BitWidth(maxKey - minKey);
+    if (indexBits + keyBits > 32) {
+        return false;
+    }
+
+    constexpr int RADIX = 1 << NARROW_DIGIT_BITS;
+    constexpr std::uint32_t DIGIT_MASK = RADIX - 1;
+    const int passes = (keyBits + NARROW_DIGIT_BITS - 1) / NARROW_DIGIT_BITS;
+    std::uint32_t histograms[NARROW_MAX_PASSES][RADIX] = {};
+
+    m_narrow.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto key = static_cast<std::uint32_t>(m_packed[i] >> 32) - minKey;
+        m_narrow[i] = (key << indexBits) | static_cast<std::uint32_t>(m_packed[i]);
+        for (int pass = 0; pass < passes; ++pass) {
+            ++histograms[pass][(key >> (pass * NARROW_DIGIT_BITS)) & DIGIT_MASK];
+        }
+    }
+
+    m_narrowScratch.resize(count);
+    for (int pass = 0; pass < passes; ++pass) {
+        std::uint32_t* histogram = histograms[pass];
+        const int shift = indexBits + pass * NARROW_DIGIT_BITS;
+
+        // Every item shares this digit: the pass would not move anything
+        if (histogram[(m_narrow[0] >> shift) & DIGIT_MASK] == count) {
+            continue;
+        }
+
+        std::uint32_t offset = 0;
+        for (int digit = 0; digit < RADIX; ++digit) {
+            std::uint32_t bucket = histogram[digit];
+            histogram[digit] = offset;
+            offset += bucket;
+        }
+        for (std::uint32_t word : m_narrow) {
+            m_narrowScratch[histogram[(word >> shift) & DIGIT_MASK]++] = word;
+        }
+        std::swap(m_narrow, m_narrowScratch);
+        ++m_lastPasses;
+    }
+
+    const std::uint32_t indexMask = indexBits == 32 ? 0xFFFFFFFFu : (1u << indexBits) - 1;
+    for (std::size_t rank = 0; rank < count; ++rank) {
+        m_order[rank] = m_narrow[rank] & indexMask;
+    }
+    return true;
+}
+
+/**
+ * @brief Stable LSD radix sort of m_packed on its 24-bit key
+ */
+void RenderQueue::RadixSort() {
+    const std::size_t count = m_packed.size();
+    std::uint32_t histograms[3][256] = {};
+    for (std::uint64_t packed : m_packed) {
+        auto key = static_cast<std::uint32_t>(packed >> 32);
+        ++histograms[0][key & 0xFF];
+        ++histograms[1][(key >> 8) & 0xFF];
+        ++histograms[2][key >> 16];
+    }
+
+    m_scratch.resize(count);
+    for (int pass = 0; pass < 3; ++pass) {
+        std::uint32_t* histogram = histograms[pass];
+        const int shift = 32 + pass * 8;
+
+        // Every item shares this digit: the pass would not move anything
+        if (histogram[(m_packed[0] >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        std::uint32_t offset = 0;
+        for (int digit = 0; digit < 256; ++digit) {
+            std::uint32_t bucket = histogram[digit];
+            histogram[digit] = offset;
+            offset += bucket;
+        }
+        for (std::uint64_t packed : m_packed) {
+            m_scratch[histogram[(packed >> shift) & 0xFF]++] = packed;
+        }
+        std::swap(m_packed, m_scratch);
+        ++m_lastPasses;
+    }
+}
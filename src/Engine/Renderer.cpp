@@ -7,6 +7,9 @@
 
 #include "Engine/Renderer.h"
 #include "Engine/ConfigSystem.h"
+#include "Engine/TrueTypeFont.h"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 // ========== TEXTURE CLASS IMPLEMENTATION ==========
@@ -19,7 +22,8 @@
  *
  * @note Follows RAII principles - lightweight construction
  */
-Texture::Texture() : m_texture(nullptr), m_width(0), m_height(0) {}
+Texture::Texture()
+    : m_texture(nullptr), m_width(0), m_height(0), m_blendMode(SDL_BLENDMODE_NONE), m_blendModeKnown(false) {}
 
 /**
  * @brief Destructor - ensures proper cleanup of SDL texture
@@ -109,6 +113,8 @@ void Texture::Free() {
         m_texture = nullptr;            // Prevent double-free
         m_width = 0;                    // Reset dimensions
         m_height = 0;
+        m_colorMod = Color();           // A new texture starts unmodulated
+        m_blendModeKnown = false;
     }
 }
 
@@ -245,7 +251,8 @@ bool Renderer::Initialize(SDL_Window* window) {
     }
 
     // Enable alpha blending for transparency support
-    SDL_SetRenderDrawBlendMode(m_renderer, SDL_BLENDMODE_BLEND);
+    InvalidateStateCache();
+    SetBlendMode(SDL_BLENDMODE_BLEND);
 
     // Configure logical (virtual) resolution and integer scaling
     // Read from gameplay.ini [visual] section with sensible defaults
@@ -255,21 +262,264 @@ bool Renderer::Initialize(SDL_Window* window) {
         logicalW = cfg.Get("visual", "logical_width", logicalW).AsInt();
         logicalH = cfg.Get("visual", "logical_height", logicalH).AsInt();
         integerScale = cfg.Get("visual", "integer_scale", integerScale).AsBool();
+        m_renderToTarget = cfg.Get("visual", "render_to_target", m_renderToTarget).AsBool();
     }
-    SDL_RenderSetLogicalSize(m_renderer, logicalW, logicalH);
-    SDL_RenderSetIntegerScale(m_renderer, integerScale ? SDL_TRUE : SDL_FALSE);
+    if (m_renderToTarget && !SDL_RenderTargetSupported(m_renderer)) {
+        std::cerr << "⚠️  Render targets unsupported; using per-draw logical scaling" << std::endl;
+        m_renderToTarget = false;
+    }
+    ApplyLogicalSize(logicalW, logicalH, integerScale);
 
     std::cout << "✅ Hardware-accelerated renderer initialized with VSync" << std::endl;
     std::cout << "✅ Image loading support: PNG, JPG, BMP" << std::endl;
-    std::cout << "✅ Logical size: " << logicalW << "x" << logicalH << ", integerScale=" << (integerScale?"true":"false") << std::endl;
+    std::cout << "✅ Logical size: " << logicalW << "x" << logicalH << ", integerScale=" << (integerScale?"true":"false")
+              << (IsUsingFrameTarget() ? ", drawn to frame target" : "") << std::endl;
     return true;
 }
 
 void Renderer::GetLogicalSize(int& w, int& h) const {
     if (!m_renderer) { w = 0; h = 0; return; }
+    if (m_frameTarget) { w = m_logicalWidth; h = m_logicalHeight; return; }
     SDL_RenderGetLogicalSize(m_renderer, &w, &h);
 }
 
+/**
+ * @brief Set the logical resolution, either as SDL logical size or as the frame target size
+ *
+ * The frame target uses nearest-neighbour filtering so pixel art stays
+ * crisp when upscaled. If it cannot be created, falls back to SDL's
+ * logical size scaling.
+ */
+void Renderer::ApplyLogicalSize(int logicalW, int logicalH, bool integerScale) {
+    m_integerScale = integerScale;
+    if (m_renderToTarget) {
+        if (!m_frameTarget || m_logicalWidth != logicalW || m_logicalHeight != logicalH) {
+            DestroyFrameTarget();
+            SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "nearest");
+            m_frameTarget = SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                              logicalW, logicalH);
+            if (!m_frameTarget) {
+                std::cerr << "⚠️  Frame target creation failed: " << SDL_GetError() << std::endl;
+            }
+        }
+        if (m_frameTarget) {
+            m_logicalWidth = logicalW;
+            m_logicalHeight = logicalH;
+            // Draw calls must not be scaled a second time by SDL
+            SDL_RenderSetLogicalSize(m_renderer, 0, 0);
+            SDL_RenderSetIntegerScale(m_renderer, SDL_FALSE);
+            return;
+        }
+    }
+    SDL_RenderSetLogicalSize(m_renderer, logicalW, logicalH);
+    SDL_RenderSetIntegerScale(m_renderer, integerScale ? SDL_TRUE : SDL_FALSE);
+}
+
+/**
+ * @brief Where Present() copies the frame target to in an outW x outH output
+ *
+ * Largest rectangle with the logical aspect ratio, centred; whole multiples
+ * of the logical size when integer scaling is on and the output is big enough.
+ */
+SDL_Rect Renderer::GetFrameDestination(int outW, int outH) const {
+    float scale = std::min(outW / static_cast<float>(m_logicalWidth), outH / static_cast<float>(m_logicalHeight));
+    if (m_integerScale && scale >= 1.0f) {
+        scale = static_cast<float>(static_cast<int>(scale));
+    }
+    int dstW = static_cast<int>(m_logicalWidth * scale);
+    int dstH = static_cast<int>(m_logicalHeight * scale);
+    return SDL_Rect{(outW - dstW) / 2, (outH - dstH) / 2, dstW, dstH};
+}
+
+void Renderer::WindowToLogical(int windowX, int windowY, float& logicalX, float& logicalY) const {
+    logicalX = static_cast<float>(windowX);
+    logicalY = static_cast<float>(windowY);
+    if (!m_renderer) {
+        return;
+    }
+
+    // Window coordinates are in points; output pixels differ on high-DPI displays
+    int outW = 0, outH = 0;
+    SDL_GetRendererOutputSize(m_renderer, &outW, &outH);
+    float pixelX = logicalX;
+    float pixelY = logicalY;
+    if (SDL_Window* window = SDL_RenderGetWindow(m_renderer)) {
+        int winW = 0, winH = 0;
+        SDL_GetWindowSize(window, &winW, &winH);
+        if (winW > 0 && winH > 0) {
+            pixelX *= outW / static_cast<float>(winW);
+            pixelY *= outH / static_cast<float>(winH);
+        }
+    }
+
+    if (m_frameTarget) {
+        SDL_Rect dst = GetFrameDestination(outW, outH);
+        if (dst.w > 0 && dst.h > 0) {
+            logicalX = (pixelX - dst.x) * m_logicalWidth / dst.w;
+            logicalY = (pixelY - dst.y) * m_logicalHeight / dst.h;
+        }
+        return;
+    }
+
+    // SDL logical size: the viewport is in logical units, offset by the bars
+    SDL_Rect viewport;
+    float scaleX = 1.0f, scaleY = 1.0f;
+    SDL_RenderGetViewport(m_renderer, &viewport);
+    SDL_RenderGetScale(m_renderer, &scaleX, &scaleY);
+    logicalX = pixelX / scaleX - viewport.x;
+    logicalY = pixelY / scaleY - viewport.y;
+}
+
+void Renderer::DestroyFrameTarget() {
+    if (m_frameTarget) {
+        if (m_target == m_frameTarget) {
+            SetRenderTarget(nullptr);
+        }
+        SDL_DestroyTexture(m_frameTarget);
+        m_frameTarget = nullptr;
+    }
+    if (m_uiTarget) {
+        if (m_target == m_uiTarget) {
+            SetRenderTarget(nullptr);
+        }
+        SDL_DestroyTexture(m_uiTarget);
+        m_uiTarget = nullptr;
+    }
+    m_uiLayerActive = false;
+}
+
+void Renderer::Flush() {
+    SDL_RenderFlush(m_renderer);
+}
+
+void Renderer::SetRenderScale(float scale) {
+    m_renderScale = std::min(1.0f, std::max(0.1f, scale));
+}
+
+void Renderer::BeginWorldLayer() {
+    if (!m_frameTarget || m_target != m_frameTarget || m_uiLayerActive || m_renderScale >= 1.0f) return;
+
+    m_frameScale = m_renderScale;
+    SDL_RenderSetScale(m_renderer, m_frameScale, m_frameScale);
+    ++m_frameStats.stateCalls;
+}
+
+void Renderer::BeginUILayer() {
+    if (!m_frameTarget || m_frameScale >= 1.0f || m_uiLayerActive) return;
+
+    if (!m_uiTarget) {
+        m_uiTarget = SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                       m_logicalWidth, m_logicalHeight);
+        if (!m_uiTarget) {
+            // Draw the UI into the scaled world instead
+            return;
+        }
+        // Blending into a transparent target leaves premultiplied color;
+        // compositing with plain BLEND would multiply by alpha a second time
+        SDL_BlendMode premultiplied = SDL_ComposeCustomBlendMode(
+            SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+            SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD);
+        if (SDL_SetTextureBlendMode(m_uiTarget, premultiplied) != 0) {
+            SDL_SetTextureBlendMode(m_uiTarget, SDL_BLENDMODE_BLEND);
+        }
+    }
+    if (!SetRenderTarget(m_uiTarget)) return;
+
+    SetDrawColor(Color(0, 0, 0, 0));
+    SDL_RenderClear(m_renderer);
+    m_uiLayerActive = true;
+}
+
+/**
+ * @brief Set the draw color used by primitives and Clear()
+ *
+ * Runs of primitives in the same color (HUD text, tiled ground) then cost
+ * one SDL_SetRenderDrawColor instead of one per primitive.
+ */
+void Renderer::SetDrawColor(const Color& color) {
+    if (m_drawColorKnown && m_drawColor.r == color.r && m_drawColor.g == color.g &&
+        m_drawColor.b == color.b && m_drawColor.a == color.a) {
+        ++m_frameStats.stateCallsSkipped;
+        return;
+    }
+    SDL_SetRenderDrawColor(m_renderer, color.r, color.g, color.b, color.a);
+    m_drawColor = color;
+    m_drawColorKnown = true;
+    ++m_frameStats.stateCalls;
+}
+
+void Renderer::SetBlendMode(SDL_BlendMode mode) {
+    if (m_drawBlendModeKnown && m_drawBlendMode == mode) {
+        ++m_frameStats.stateCallsSkipped;
+        return;
+    }
+    SDL_SetRenderDrawBlendMode(m_renderer, mode);
+    m_drawBlendMode = mode;
+    m_drawBlendModeKnown = true;
+    ++m_frameStats.stateCalls;
+}
+
+bool Renderer::SetRenderTarget(SDL_Texture* target) {
+    if (m_target == target) {
+        ++m_frameStats.stateCallsSkipped;
+        return true;
+    }
+    ++m_frameStats.stateCalls;
+    if (SDL_SetRenderTarget(m_renderer, target) != 0) {
+        return false;
+    }
+    m_target = target;
+    // SDL resets the scale when the target changes; the world keeps its own
+    if (target && target == m_frameTarget && m_frameScale < 1.0f) {
+        SDL_RenderSetScale(m_renderer, m_frameScale, m_frameScale);
+    }
+    return true;
+}
+
+/**
+ * @brief Set a texture's color and alpha modulation (white = unmodulated)
+ *
+ * The last value is kept on the Texture itself, since SDL stores
+ * modulation per texture rather than per renderer.
+ */
+void Renderer::SetTextureModulation(const std::shared_ptr<Texture>& texture, const Color& color) {
+    if (!texture || !texture->m_texture) return;
+
+    Color& current = texture->m_colorMod;
+    if (current.r != color.r || current.g != color.g || current.b != color.b) {
+        SDL_SetTextureColorMod(texture->m_texture, color.r, color.g, color.b);
+        ++m_frameStats.stateCalls;
+    } else {
+        ++m_frameStats.stateCallsSkipped;
+    }
+    if (current.a != color.a) {
+        SDL_SetTextureAlphaMod(texture->m_texture, color.a);
+        ++m_frameStats.stateCalls;
+    } else {
+        ++m_frameStats.stateCallsSkipped;
+    }
+    current = color;
+}
+
+void Renderer::SetTextureBlendMode(const std::shared_ptr<Texture>& texture, SDL_BlendMode mode) {
+    if (!texture || !texture->m_texture) return;
+
+    if (texture->m_blendModeKnown && texture->m_blendMode == mode) {
+        ++m_frameStats.stateCallsSkipped;
+        return;
+    }
+    SDL_SetTextureBlendMode(texture->m_texture, mode);
+    texture->m_blendMode = mode;
+    texture->m_blendModeKnown = true;
+    ++m_frameStats.stateCalls;
+}
+
+void Renderer::InvalidateStateCache() {
+    m_drawColorKnown = false;
+    m_drawBlendModeKnown = false;
+    m_target = m_renderer ? SDL_GetRenderTarget(m_renderer) : nullptr;
+}
+
 
 
 void Renderer::UpdateLogicalToOutput() {
@@ -287,14 +537,12 @@ void Renderer::UpdateLogicalToOutput() {
     if (match) {
         int outW=0, outH=0; SDL_GetRendererOutputSize(m_renderer, &outW, &outH);
         if (outW > 0 && outH > 0) {
-            SDL_RenderSetLogicalSize(m_renderer, outW, outH);
-            SDL_RenderSetIntegerScale(m_renderer, integerScale ? SDL_TRUE : SDL_FALSE);
+            ApplyLogicalSize(outW, outH, integerScale);
             std::cout << "✅ Logical size matched to output: " << outW << "x" << outH << std::endl;
             return;
         }
     }
-    SDL_RenderSetLogicalSize(m_renderer, defaultLW, defaultLH);
-    SDL_RenderSetIntegerScale(m_renderer, integerScale ? SDL_TRUE : SDL_FALSE);
+    ApplyLogicalSize(defaultLW, defaultLH, integerScale);
 }
 
 /**
@@ -319,8 +567,12 @@ void Renderer::UpdateLogicalToOutput() {
 void Renderer::Shutdown() {
     // Clear texture cache first (releases all loaded textures)
     m_textureCache.clear();
+    m_glyphAtlas.reset();
     std::cout << "✅ Texture cache cleared" << std::endl;
 
+    // The frame target belongs to the SDL renderer and must go first
+    DestroyFrameTarget();
+
     // Destroy SDL renderer (releases graphics context and resources)
     if (m_renderer) {
         SDL_DestroyRenderer(m_renderer);
@@ -347,6 +599,9 @@ void Renderer::Shutdown() {
  * Should be called after Clear() and before Present(), if desired.
  */
 void Renderer::DrawLetterboxBars(int logicalW, int logicalH) {
+    // Present() already leaves bars around the upscaled frame
+    if (m_frameTarget) return;
+
     // Compute current output size
     int outW = 0, outH = 0;
     SDL_GetRendererOutputSize(m_renderer, &outW, &outH);
@@ -362,25 +617,29 @@ void Renderer::DrawLetterboxBars(int logicalW, int logicalH) {
     // Top bar
     if (vpY > 0) {
         SDL_Rect top{0, 0, outW, vpY};
-        SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 255);
+        SetDrawColor(Color(0, 0, 0, 255));
+        ++m_frameStats.drawCalls;
         SDL_RenderFillRect(m_renderer, &top);
     }
     // Bottom bar
     if (vpY + vpH < outH) {
         SDL_Rect bottom{0, vpY + vpH, outW, outH - (vpY + vpH)};
-        SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 255);
+        SetDrawColor(Color(0, 0, 0, 255));
+        ++m_frameStats.drawCalls;
         SDL_RenderFillRect(m_renderer, &bottom);
     }
     // Left bar
     if (vpX > 0) {
         SDL_Rect left{0, vpY, vpX, vpH};
-        SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 255);
+        SetDrawColor(Color(0, 0, 0, 255));
+        ++m_frameStats.drawCalls;
         SDL_RenderFillRect(m_renderer, &left);
     }
     // Right bar
     if (vpX + vpW < outW) {
         SDL_Rect right{vpX + vpW, vpY, outW - (vpX + vpW), vpH};
-        SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 255);
+        SetDrawColor(Color(0, 0, 0, 255));
+        ++m_frameStats.drawCalls;
         SDL_RenderFillRect(m_renderer, &right);
     }
 }
@@ -394,8 +653,16 @@ void Renderer::DrawLetterboxBars(int logicalW, int logicalH) {
  */
 
 void Renderer::Clear(const Color& color) {
+    // Start the frame on the logical-size target at full scale; states with
+    // a world layer drop to the dynamic scale with BeginWorldLayer()
+    if (m_frameTarget) {
+        m_frameScale = 1.0f;
+        m_uiLayerActive = false;
+        SetRenderTarget(m_frameTarget);
+    }
+
     // Set the clear color for this frame
-    SDL_SetRenderDrawColor(m_renderer, color.r, color.g, color.b, color.a);
+    SetDrawColor(color);
 
     // Clear the entire screen buffer with the specified color
     SDL_RenderClear(m_renderer);
@@ -413,8 +680,34 @@ void Renderer::Clear(const Color& color) {
  * @note Double buffering prevents flickering and tearing
  */
 void Renderer::Present() {
+    if (m_frameTarget) {
+        // One scaled copy of the whole frame; clearing the window first
+        // leaves black letterbox/pillarbox bars around it
+        SetRenderTarget(nullptr);
+        SetDrawColor(Color(0, 0, 0, 255));
+        SDL_RenderClear(m_renderer);
+
+        int outW = 0, outH = 0;
+        SDL_GetRendererOutputSize(m_renderer, &outW, &outH);
+        SDL_Rect dst = GetFrameDestination(outW, outH);
+
+        // At reduced scale only the top-left part of the target holds the world
+        SDL_Rect src{0, 0, static_cast<int>(std::ceil(m_logicalWidth * m_frameScale)),
+                     static_cast<int>(std::ceil(m_logicalHeight * m_frameScale))};
+        SDL_RenderCopy(m_renderer, m_frameTarget, &src, &dst);
+        ++m_frameStats.drawCalls;
+        if (m_uiLayerActive) {
+            SDL_RenderCopy(m_renderer, m_uiTarget, nullptr, &dst);
+            ++m_frameStats.drawCalls;
+            m_uiLayerActive = false;
+        }
+    }
+
     // Swap buffers and display the completed frame
     SDL_RenderPresent(m_renderer);
+
+    m_lastFrameStats = m_frameStats;
+    m_frameStats = RenderStats();
 }
 
 /**
@@ -433,7 +726,8 @@ void Renderer::Present() {
  */
 void Renderer::DrawRectangle(const Rectangle& rect, const Color& color, bool filled) {
     // Set drawing color (including alpha for transparency)
-    SDL_SetRenderDrawColor(m_renderer, color.r, color.g, color.b, color.a);
+    SetDrawColor(color);
+    ++m_frameStats.drawCalls;
 
     // Convert our Rectangle to SDL_Rect format
     SDL_Rect sdlRect = { rect.x, rect.y, rect.width, rect.height };
@@ -465,7 +759,8 @@ void Renderer::DrawRectangle(const Rectangle& rect, const Color& color, bool fil
  */
 void Renderer::DrawLine(int x1, int y1, int x2, int y2, const Color& color) {
     // Set drawing color
-    SDL_SetRenderDrawColor(m_renderer, color.r, color.g, color.b, color.a);
+    SetDrawColor(color);
+    ++m_frameStats.drawCalls;
 
     // Draw line from start to end point
     SDL_RenderDrawLine(m_renderer, x1, y1, x2, y2);
@@ -486,7 +781,8 @@ void Renderer::DrawLine(int x1, int y1, int x2, int y2, const Color& color) {
  */
 void Renderer::DrawPoint(int x, int y, const Color& color) {
     // Set drawing color
-    SDL_SetRenderDrawColor(m_renderer, color.r, color.g, color.b, color.a);
+    SetDrawColor(color);
+    ++m_frameStats.drawCalls;
 
     // Draw single pixel point
     SDL_RenderDrawPoint(m_renderer, x, y);
@@ -559,6 +855,7 @@ std::shared_ptr<Texture> Renderer::LoadTexture(const std::string& path) {
 void Renderer::DrawTexture(std::shared_ptr<Texture> texture, int x, int y) {
     if (texture) {
         texture->Render(m_renderer, x, y);
+        ++m_frameStats.drawCalls;
     }
 }
 
@@ -593,6 +890,7 @@ void Renderer::DrawTexture(std::shared_ptr<Texture> texture, const Rectangle& sr
 
         // Render with scaling (source rect -> destination size)
         texture->Render(m_renderer, destRect.x, destRect.y, destRect.width, destRect.height, &src);
+        ++m_frameStats.drawCalls;
     }
 }
 
@@ -636,4 +934,19 @@ void Renderer::DrawTexture(std::shared_ptr<Texture> texture, const Rectangle& sr
 
     // Use SDL_RenderCopyEx for advanced rendering with flipping support
     SDL_RenderCopyEx(m_renderer, texture->GetSDLTexture(), &src, &dest, 0.0, nullptr, flip);
+    ++m_frameStats.drawCalls;
+}
+
+void Renderer::DrawGeometry(SDL_Texture* texture, const SDL_Vertex* vertices, int vertexCount,
+                            const int* indices, int indexCount) {
+    if (!m_renderer || vertexCount == 0) return;
+    SDL_RenderGeometry(m_renderer, texture, vertices, vertexCount, indices, indexCount);
+    ++m_frameStats.drawCalls;
+}
+
+GlyphAtlas& Renderer::GetGlyphAtlas() {
+    if (!m_glyphAtlas) {
+        m_glyphAtlas = std::make_unique<GlyphAtlas>(m_renderer);
+    }
+    return *m_glyphAtlas;
 }
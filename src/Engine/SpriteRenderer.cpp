@@ -6,6 +6,7 @@
  */
 
 #include "Engine/SpriteRenderer.h"
+#include <algorithm>
 #include <iostream>
 
 void SpriteRenderer::RenderSprite(Renderer* renderer, const std::string& texturePath, 
@@ -47,3 +48,41 @@ SpriteFrame SpriteRenderer::CreateFrame(int frameIndex, int frameWidth, int fram
     
     return SpriteFrame(col * frameWidth, row * frameHeight, frameWidth, frameHeight);
 }
+
+std::shared_ptr<const std::vector<CollisionMask>> SpriteRenderer::LoadCollisionMasks(
+    const std::string& texturePath, const std::vector<SpriteFrame>& frames, float scale, Uint8 alphaThreshold) {
+    SDL_Surface* loaded = IMG_Load(texturePath.c_str());
+    if (!loaded) {
+        std::cerr << "❌ Failed to load collision mask source: " << texturePath << std::endl;
+        return nullptr;
+    }
+
+    // RGBA32 stores bytes as R, G, B, A regardless of endianness
+    SDL_Surface* surface = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(loaded);
+    if (!surface) {
+        std::cerr << "❌ Failed to convert collision mask source: " << texturePath << std::endl;
+        return nullptr;
+    }
+
+    auto masks = std::make_shared<std::vector<CollisionMask>>();
+    masks->reserve(frames.size());
+    SDL_LockSurface(surface);
+    const auto* pixels = static_cast<const Uint8*>(surface->pixels);
+    for (const SpriteFrame& frame : frames) {
+        // Clip the frame to the sheet so a bad frame rectangle can't read past it
+        int left = std::clamp(frame.x, 0, surface->w);
+        int top = std::clamp(frame.y, 0, surface->h);
+        int width = std::min(frame.x + frame.width, surface->w) - left;
+        int height = std::min(frame.y + frame.height, surface->h) - top;
+        if (width <= 0 || height <= 0) {
+            masks->emplace_back();
+            continue;
+        }
+        const Uint8* alpha = pixels + top * surface->pitch + left * 4 + 3;
+        masks->push_back(CollisionMask::FromAlpha(alpha, width, height, surface->pitch, 4, alphaThreshold, scale));
+    }
+    SDL_UnlockSurface(surface);
+    SDL_FreeSurface(surface);
+    return masks;
+}
@@ -0,0 +1,322 @@
+/**
+ * @file TrueTypeFont.cpp
+ * @brief Implementation of the glyph atlas and SDL_ttf text rendering
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "Engine/TrueTypeFont.h"
+#include <algorithm>
+#include <iostream>
+
+#ifdef HAVE_SDL2_TTF
+#include <SDL2/SDL_ttf.h>
+#endif
+
+namespace {
+
+std::uint32_t g_nextAtlasGeneration = 1;
+
+constexpr std::uint32_t REPLACEMENT_CHARACTER = 0xFFFD;
+
+/**
+ * @brief Decode one UTF-8 code point and advance the index past it
+ *
+ * Malformed bytes decode as U+FFFD and consume one byte.
+ */
+std::uint32_t DecodeUtf8(const std::string& text, std::size_t& index) {
+    auto byte = [&](std::size_t i) { return static_cast<unsigned char>(text[i]); };
+    const unsigned char lead = byte(index);
+    if (lead < 0x80) {
+        ++index;
+        return lead;
+    }
+
+    int length = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 0;
+    if (length == 0 || lead > 0xF4 || index + length > text.size()) {
+        ++index;
+        return REPLACEMENT_CHARACTER;
+    }
+    std::uint32_t codepoint = lead & (0x7F >> length);
+    for (int i = 1; i < length; ++i) {
+        unsigned char next = byte(index + i);
+        if ((next & 0xC0) != 0x80) {
+            ++index;
+            return REPLACEMENT_CHARACTER;
+        }
+        codepoint = (codepoint << 6) | (next & 0x3F);
+    }
+    index += length;
+    return codepoint;
+}
+
+} // namespace
+
+// ========== GlyphAtlas ==========
+
+GlyphAtlas::GlyphAtlas(SDL_Renderer* renderer)
+    : m_renderer(renderer), m_generation(g_nextAtlasGeneration++) {}
+
+GlyphAtlas::~GlyphAtlas() {
+    for (Page& page : m_pages) {
+        SDL_DestroyTexture(page.texture);
+    }
+}
+
+bool GlyphAtlas::AddPage() {
+    SDL_Texture* texture = SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC,
+                                             PAGE_SIZE, PAGE_SIZE);
+    if (!texture) {
+        std::cerr << "❌ Glyph atlas page creation failed: " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    // Static textures start undefined; padding between glyphs must be transparent
+    std::vector<Uint32> clear(static_cast<std::size_t>(PAGE_SIZE) * PAGE_SIZE, 0);
+    SDL_UpdateTexture(texture, nullptr, clear.data(), PAGE_SIZE * static_cast<int>(sizeof(Uint32)));
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+    m_pages.push_back(Page{texture, AtlasPacker(PAGE_SIZE, PAGE_SIZE)});
+    return true;
+}
+
+bool GlyphAtlas::Add(SDL_Surface* glyph, Slot& slot) {
+    SDL_Surface* pixels = glyph;
+    if (glyph->format->format != SDL_PIXELFORMAT_ARGB8888) {
+        pixels = SDL_ConvertSurfaceFormat(glyph, SDL_PIXELFORMAT_ARGB8888, 0);
+        if (!pixels) {
+            return false;
+        }
+    }
+
+    int x = 0, y = 0;
+    int page = -1;
+    for (int i = static_cast<int>(m_pages.size()) - 1; i >= 0 && page < 0; --i) {
+        if (m_pages[i].packer.Insert(pixels->w, pixels->h, x, y)) {
+            page = i;
+        }
+    }
+    if (page < 0 && AddPage() && m_pages.back().packer.Insert(pixels->w, pixels->h, x, y)) {
+        page = static_cast<int>(m_pages.size()) - 1;
+    }
+
+    if (page >= 0) {
+        slot.page = page;
+        slot.rect = SDL_Rect{x, y, pixels->w, pixels->h};
+        SDL_UpdateTexture(m_pages[page].texture, &slot.rect, pixels->pixels, pixels->pitch);
+    }
+    if (pixels != glyph) {
+        SDL_FreeSurface(pixels);
+    }
+    return page >= 0;
+}
+
+// ========== TrueTypeFont ==========
+
+TrueTypeFont::~TrueTypeFont() {
+    Free();
+}
+
+bool TrueTypeFont::Load(const std::string& path, int pointSize) {
+    Free();
+#ifdef HAVE_SDL2_TTF
+    if (!TTF_WasInit() && TTF_Init() != 0) {
+        std::cerr << "❌ SDL_ttf initialization failed: " << TTF_GetError() << std::endl;
+        return false;
+    }
+    m_font = TTF_OpenFont(path.c_str(), pointSize);
+    if (!m_font) {
+        std::cerr << "❌ Failed to load font: " << path << " (" << TTF_GetError() << ")" << std::endl;
+        return false;
+    }
+    m_lineSkip = TTF_FontLineSkip(m_font);
+    m_asciiKerning.assign(128 * 128, KERNING_UNKNOWN);
+    return true;
+#else
+    std::cerr << "❌ Cannot load " << path << " at " << pointSize << "pt: built without SDL2_ttf" << std::endl;
+    return false;
+#endif
+}
+
+void TrueTypeFont::Free() {
+#ifdef HAVE_SDL2_TTF
+    if (m_font) {
+        TTF_CloseFont(m_font);
+    }
+#endif
+    m_font = nullptr;
+    m_ascii.fill(Glyph());
+    m_glyphs.clear();
+    m_asciiKerning.clear();
+    m_kerning.clear();
+    m_atlasGeneration = 0;
+}
+
+void TrueTypeFont::ForgetRasterizedGlyphs() {
+    for (Glyph& glyph : m_ascii) {
+        glyph.rasterized = false;
+        glyph.slot = GlyphAtlas::Slot();
+    }
+    for (auto& entry : m_glyphs) {
+        entry.second.rasterized = false;
+        entry.second.slot = GlyphAtlas::Slot();
+    }
+}
+
+TrueTypeFont::Glyph& TrueTypeFont::GetGlyph(std::uint32_t codepoint) {
+    Glyph& glyph = codepoint < m_ascii.size() ? m_ascii[codepoint] : m_glyphs[codepoint];
+    if (!glyph.measured) {
+        glyph.measured = true;
+#ifdef HAVE_SDL2_TTF
+        int minX, maxX, minY, maxY, advance;
+        if (TTF_GlyphMetrics32(m_font, codepoint, &minX, &maxX, &minY, &maxY, &advance) == 0) {
+            glyph.advance = advance;
+        }
+#endif
+    }
+    return glyph;
+}
+
+bool TrueTypeFont::Rasterize(GlyphAtlas& atlas, std::uint32_t codepoint, Glyph& glyph) {
+    glyph.rasterized = true;
+    glyph.slot = GlyphAtlas::Slot();
+    if (codepoint <= ' ' || glyph.advance == 0) {
+        return false;  // Whitespace, control characters and missing glyphs have no pixels
+    }
+#ifdef HAVE_SDL2_TTF
+    // White, so vertex colors tint it to any text color
+    SDL_Surface* surface = TTF_RenderGlyph32_Blended(m_font, codepoint, SDL_Color{255, 255, 255, 255});
+    if (!surface) {
+        return false;
+    }
+    bool added = atlas.Add(surface, glyph.slot);
+    SDL_FreeSurface(surface);
+    return added;
+#else
+    (void)atlas;
+    return false;
+#endif
+}
+
+int TrueTypeFont::Kerning(std::uint32_t previous, std::uint32_t codepoint) {
+    if (previous == 0 || previous > 0xFFFF || codepoint > 0xFFFF) {
+        return 0;
+    }
+
+    auto lookUp = [&]() {
+#ifdef HAVE_SDL2_TTF
+        return TTF_GetFontKerningSizeGlyphs(m_font, static_cast<Uint16>(previous), static_cast<Uint16>(codepoint));
+#else
+        return 0;
+#endif
+    };
+
+    if (previous < 128 && codepoint < 128) {
+        std::int16_t& cached = m_asciiKerning[previous * 128 + codepoint];
+        if (cached == KERNING_UNKNOWN) {
+            cached = static_cast<std::int16_t>(lookUp());
+        }
+        return cached;
+    }
+    auto it = m_kerning.find((previous << 16) | codepoint);
+    if (it == m_kerning.end()) {
+        it = m_kerning.emplace((previous << 16) | codepoint, lookUp()).first;
+    }
+    return it->second;
+}
+
+void TrueTypeFont::DrawText(Renderer* renderer, const std::string& text, int x, int y, const Color& color) {
+    if (!m_font || !renderer || text.empty()) {
+        return;
+    }
+
+    GlyphAtlas& atlas = renderer->GetGlyphAtlas();
+    if (atlas.GetGeneration() != m_atlasGeneration) {
+        // New renderer since the last draw: its atlas holds none of our glyphs
+        ForgetRasterizedGlyphs();
+        m_atlasGeneration = atlas.GetGeneration();
+    }
+
+    const SDL_Color vertexColor{color.r, color.g, color.b, color.a};
+    const float texel = 1.0f / GlyphAtlas::PAGE_SIZE;
+    m_vertices.clear();
+    m_indices.clear();
+    int batchPage = -1;
+
+    auto flush = [&]() {
+        if (!m_vertices.empty()) {
+            renderer->DrawGeometry(atlas.GetPage(batchPage), m_vertices.data(), static_cast<int>(m_vertices.size()),
+                                   m_indices.data(), static_cast<int>(m_indices.size()));
+            m_vertices.clear();
+            m_indices.clear();
+        }
+    };
+
+    int penX = x;
+    int lineTop = y;
+    std::uint32_t previous = 0;
+    for (std::size_t index = 0; index < text.size();) {
+        std::uint32_t codepoint = DecodeUtf8(text, index);
+        if (codepoint == '\n') {
+            penX = x;
+            lineTop += m_lineSkip;
+            previous = 0;
+            continue;
+        }
+
+        Glyph& glyph = GetGlyph(codepoint);
+        penX += Kerning(previous, codepoint);
+        previous = codepoint;
+        if (!glyph.rasterized) {
+            Rasterize(atlas, codepoint, glyph);
+        }
+
+        if (glyph.slot.page >= 0) {
+            if (glyph.slot.page != batchPage) {
+                flush();
+                batchPage = glyph.slot.page;
+            }
+
+            const SDL_Rect& src = glyph.slot.rect;
+            const float left = static_cast<float>(penX);
+            const float top = static_cast<float>(lineTop);
+            const float right = left + src.w;
+            const float bottom = top + src.h;
+            const float u0 = src.x * texel, v0 = src.y * texel;
+            const float u1 = (src.x + src.w) * texel, v1 = (src.y + src.h) * texel;
+
+            const int base = static_cast<int>(m_vertices.size());
+            m_vertices.push_back(SDL_Vertex{{left, top}, vertexColor, {u0, v0}});
+            m_vertices.push_back(SDL_Vertex{{right, top}, vertexColor, {u1, v0}});
+            m_vertices.push_back(SDL_Vertex{{right, bottom}, vertexColor, {u1, v1}});
+            m_vertices.push_back(SDL_Vertex{{left, bottom}, vertexColor, {u0, v1}});
+            for (int corner : {0, 1, 2, 0, 2, 3}) {
+                m_indices.push_back(base + corner);
+            }
+        }
+        penX += glyph.advance;
+    }
+    flush();
+}
+
+int TrueTypeFont::MeasureText(const std::string& text) {
+    if (!m_font) {
+        return 0;
+    }
+
+    int widest = 0;
+    int width = 0;
+    std::uint32_t previous = 0;
+    for (std::size_t index = 0; index < text.size();) {
+        std::uint32_t codepoint = DecodeUtf8(text, index);
+        if (codepoint == '\n') {
+            widest = std::max(widest, width);
+            width = 0;
+            previous = 0;
+            continue;
+        }
+        width += Kerning(previous, codepoint) + GetGlyph(codepoint).advance;
+        previous = codepoint;
+    }
+    return std::max(widest, width);
+}
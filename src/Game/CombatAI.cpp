@@ -0,0 +1,211 @@
+/**
+ * @file CombatAI.cpp
+ * @brief Implementation of the battle model and enemy move search
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "Game/CombatAI.h"
+#include <chrono>
+#include <cmath>
+
+namespace {
+
+/// UCB1 exploration constant (rewards are in [0, 1])
+constexpr double EXPLORATION = 0.7;
+
+/// Share of playout moves that follow the greedy policy instead of a random legal move
+constexpr std::uint32_t GREEDY_PERCENT = 75;
+
+int Roll(std::mt19937& rng, int minimum, int rolls) {
+    return minimum + static_cast<int>(rng() % static_cast<std::uint32_t>(rolls));
+}
+
+} // namespace
+
+int BattleState::LegalMoves(BattleMove* out) const {
+    if (IsOver() || turn < 0 || turn >= count || !units[turn].isAlive) {
+        return 0;
+    }
+
+    const BattleUnit& actor = units[turn];
+    int moves = 0;
+    for (int i = 0; i < count; ++i) {
+        if (!units[i].isAlive || units[i].isPlayer == actor.isPlayer) {
+            continue;
+        }
+        out[moves++] = BattleMove{BattleMove::ATTACK, static_cast<std::int8_t>(i)};
+        if (!actor.isPlayer && actor.mana >= BattleRules::MAGIC_COST) {
+            out[moves++] = BattleMove{BattleMove::MAGIC, static_cast<std::int8_t>(i)};
+        }
+    }
+    // The player's magic and defend have no effect in battle yet: only attacks are modelled
+    if (!actor.isPlayer) {
+        out[moves++] = BattleMove{BattleMove::DEFEND, -1};
+    }
+    return moves;
+}
+
+void BattleState::Apply(const BattleMove& move, std::mt19937& rng) {
+    BattleUnit& actor = units[turn];
+    if (move.type == BattleMove::DEFEND) {
+        actor.defending = true;
+    } else if (move.target >= 0 && move.target < count) {
+        BattleUnit& target = units[move.target];
+        if (move.type == BattleMove::ATTACK) {
+            int roll = Roll(rng, BattleRules::ATTACK_MIN, BattleRules::ATTACK_ROLLS);
+            target.health -= BattleRules::PhysicalDamage(roll, actor.attackBonus, target.defense, target.defending);
+        } else {
+            actor.mana -= BattleRules::MAGIC_COST;
+            int roll = Roll(rng, BattleRules::MAGIC_MIN, BattleRules::MAGIC_ROLLS);
+            target.health -= BattleRules::MagicDamage(roll, target.defending);
+        }
+        if (target.health <= 0.0f) {
+            target.health = 0.0f;
+            target.isAlive = false;
+        }
+    }
+    AdvanceTurn();
+}
+
+void BattleState::AdvanceTurn() {
+    for (int step = 1; step <= count; ++step) {
+        int next = (turn + step) % count;
+        if (units[next].isAlive) {
+            turn = next;
+            units[next].defending = false;
+            return;
+        }
+    }
+}
+
+bool BattleState::IsOver() const {
+    bool playersAlive = false;
+    bool enemiesAlive = false;
+    for (int i = 0; i < count; ++i) {
+        if (units[i].isAlive) {
+            (units[i].isPlayer ? playersAlive : enemiesAlive) = true;
+        }
+    }
+    return !playersAlive || !enemiesAlive;
+}
+
+float BattleState::Score() const {
+    float playerHealth = 0.0f, playerMax = 0.0f, enemyHealth = 0.0f, enemyMax = 0.0f;
+    for (int i = 0; i < count; ++i) {
+        const BattleUnit& unit = units[i];
+        (unit.isPlayer ? playerHealth : enemyHealth) += unit.health;
+        (unit.isPlayer ? playerMax : enemyMax) += unit.maxHealth;
+    }
+    if (playerHealth <= 0.0f) {
+        return 1.0f;
+    }
+    if (enemyHealth <= 0.0f) {
+        return 0.0f;
+    }
+    return 0.5f + 0.5f * (enemyHealth / enemyMax - playerHealth / playerMax);
+}
+
+void CombatAI::Begin(const BattleState& state, std::uint32_t seed) {
+    m_root = state;
+    m_rng.seed(seed);
+    m_iterations = 0;
+
+    BattleMove moves[BattleState::MAX_MOVES];
+    int count = m_root.LegalMoves(moves);
+    m_arms.assign(count, Arm());
+    for (int i = 0; i < count; ++i) {
+        m_arms[i].move = moves[i];
+    }
+}
+
+bool CombatAI::Think(double budgetMs) {
+    using Clock = std::chrono::steady_clock;
+    const auto deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                                             std::chrono::duration<double, std::milli>(budgetMs));
+    while (!IsDone()) {
+        Iterate();
+        // Reading the clock costs about as much as a short playout; check every few iterations
+        if ((m_iterations & 7) == 0 && Clock::now() >= deadline) {
+            break;
+        }
+    }
+    return IsDone();
+}
+
+BattleMove CombatAI::GetBestMove() const {
+    if (m_arms.empty()) {
+        return BattleMove{BattleMove::DEFEND, -1};
+    }
+
+    const Arm* best = &m_arms[0];
+    for (const Arm& arm : m_arms) {
+        if (arm.visits > best->visits ||
+            (arm.visits == best->visits && arm.visits > 0 &&
+             arm.reward / arm.visits > best->reward / best->visits)) {
+            best = &arm;
+        }
+    }
+    return best->move;
+}
+
+/**
+ * @brief One UCB1 selection, playout and backup
+ */
+void CombatAI::Iterate() {
+    Arm* chosen = nullptr;
+    double bestBound = -1.0;
+    const double logTotal = std::log(static_cast<double>(m_iterations) + 1.0);
+    for (Arm& arm : m_arms) {
+        if (arm.visits == 0) {
+            chosen = &arm;
+            break;
+        }
+        double bound = arm.reward / arm.visits + EXPLORATION * std::sqrt(logTotal / arm.visits);
+        if (bound > bestBound) {
+            bestBound = bound;
+            chosen = &arm;
+        }
+    }
+
+    BattleState state = m_root;
+    state.Apply(chosen->move, m_rng);
+    for (int depth = 0; depth < m_playoutDepth && !state.IsOver(); ++depth) {
+        state.Apply(PlayoutMove(state), m_rng);
+    }
+
+    float score = state.Score();
+    chosen->visits++;
+    chosen->reward += m_root.units[m_root.turn].isPlayer ? 1.0f - score : score;
+    ++m_iterations;
+}
+
+/**
+ * @brief Playout policy: mostly focus the weakest opponent with the strongest attack, sometimes random
+ */
+BattleMove CombatAI::PlayoutMove(const BattleState& state) {
+    BattleMove moves[BattleState::MAX_MOVES];
+    int count = state.LegalMoves(moves);
+    if (count == 0) {
+        return BattleMove{BattleMove::DEFEND, -1};
+    }
+    if (m_rng() % 100 >= GREEDY_PERCENT) {
+        return moves[m_rng() % static_cast<std::uint32_t>(count)];
+    }
+
+    BattleMove best = moves[count - 1];
+    float weakest = 0.0f;
+    for (int i = 0; i < count; ++i) {
+        if (moves[i].type == BattleMove::DEFEND) {
+            continue;
+        }
+        float health = state.units[moves[i].target].health;
+        bool weaker = best.type == BattleMove::DEFEND || health < weakest;
+        bool strongerOnSame = health == weakest && moves[i].type == BattleMove::MAGIC;
+        if (weaker || strongerOnSame) {
+            best = moves[i];
+            weakest = health;
+        }
+    }
+    return best;
+}
@@ -273,13 +273,18 @@ void CombatState::UpdateBattleStart([[maybe_unused]] float deltaTime) {
 void CombatState::UpdateTurnStart([[maybe_unused]] float deltaTime) {
     if (m_phaseTimer >= 1.0f) {
         if (static_cast<size_t>(m_currentTurnIndex) < m_participants.size()) {
-            const auto& participant = m_participants[m_currentTurnIndex];
+            auto& participant = m_participants[m_currentTurnIndex];
+            // A defend stance lasts until the defender's next turn
+            participant.defending = false;
             if (participant.isPlayer) {
                 m_currentPhase = CombatPhase::ACTION_SELECT;
                 m_showActionMenu = true;
                 UpdateAvailableActions();
             } else {
                 m_currentPhase = CombatPhase::ACTION_EXECUTE;
+                // The enemy "thinks" during the action delay, a slice per frame
+                m_enemyAI.SetMaxIterations(m_gameConfig->GetEnemyAIIterations());
+                m_enemyAI.Begin(BuildBattleState(), static_cast<std::uint32_t>(rand()));
             }
         }
         m_phaseTimer = 0.0f;
@@ -291,6 +296,10 @@ void CombatState::UpdateActionSelect([[maybe_unused]] float deltaTime) {
 }
 
 void CombatState::UpdateActionExecute([[maybe_unused]] float deltaTime) {
+    if (!m_participants[m_currentTurnIndex].isPlayer && !m_enemyAI.IsDone()) {
+        m_enemyAI.Think(m_gameConfig->GetEnemyAIFrameBudgetMs());
+    }
+
     if (m_phaseTimer >= 1.0f) {
         const auto& participant = m_participants[m_currentTurnIndex];
 
@@ -551,26 +560,49 @@ void CombatState::ProcessPlayerAction() {
 }
 
 void CombatState::ProcessEnemyAction(const CombatParticipant& participant) {
-    // Simple AI: always attack player
-    for (const auto& player : m_participants) {
-        if (player.isPlayer && player.isAlive) {
-            ExecuteAttack(participant.entity, player.entity);
-            break;
+    // Battles larger than the search model (and fallen enemies, which the
+    // model never moves) fall back to attacking the player
+    if (!participant.isAlive || m_currentTurnIndex >= BattleState::MAX_UNITS) {
+        for (const auto& player : m_participants) {
+            if (player.isPlayer && player.isAlive) {
+                ExecuteAttack(participant.entity, player.entity);
+                break;
+            }
         }
+        return;
+    }
+
+    // Best move found by the search that ran during the action delay
+    BattleMove move = m_enemyAI.GetBestMove();
+    Entity target;
+    if (move.target >= 0 && static_cast<size_t>(move.target) < m_participants.size()) {
+        target = m_participants[move.target].entity;
+    }
+    switch (move.type) {
+        case BattleMove::ATTACK:
+            ExecuteAttack(participant.entity, target);
+            break;
+        case BattleMove::MAGIC:
+            ExecuteMagic(participant.entity, target);
+            break;
+        case BattleMove::DEFEND:
+            ExecuteDefend(participant.entity);
+            break;
     }
 }
 
 void CombatState::ExecuteAttack([[maybe_unused]] Entity attacker, Entity target) {
-    // Basic attack calculation with simple equipment bonus for player
-    int damage = 15 + (rand() % 10); // 15-25 base damage
+    // Basic attack roll with simple equipment bonus for player
+    int roll = BattleRules::ATTACK_MIN + (rand() % BattleRules::ATTACK_ROLLS);
 
     // If attacker is the player, add weapon atkBonus
     // We only support a single player for now, index 0 in PartyManager
+    float attackBonus = 0.0f;
     if (attacker.IsValid()) {
         // Find if attacker is player participant
         for (const auto& p : m_participants) {
             if (p.entity.GetID() == attacker.GetID() && p.isPlayer) {
-                damage += PartyManager::Get().GetAttackWithEquipment(0);
+                attackBonus = static_cast<float>(PartyManager::Get().GetAttackWithEquipment(0));
                 break;
             }
         }
@@ -580,33 +612,93 @@ void CombatState::ExecuteAttack([[maybe_unused]] Entity attacker, Entity target)
     for (auto& participant : m_participants) {
         if (participant.entity.GetID() == target.GetID()) {
             // Simple defense mitigation using equipment
-            int mitigation = participant.isPlayer ? PartyManager::Get().GetDefenseWithEquipment(0) : 0;
-            int finalDamage = std::max(1, damage - mitigation);
+            float mitigation = participant.isPlayer ? static_cast<float>(PartyManager::Get().GetDefenseWithEquipment(0)) : 0.0f;
+            float damage = BattleRules::PhysicalDamage(roll, attackBonus, mitigation, participant.defending);
+            ApplyDamage(participant, static_cast<int>(damage));
+            break;
+        }
+    }
+}
 
-            participant.currentHealth -= finalDamage;
-            if (participant.currentHealth <= 0) {
-                participant.currentHealth = 0;
-                participant.isAlive = false;
-            }
+void CombatState::ApplyDamage(CombatParticipant& participant, int damage) {
+    participant.currentHealth -= damage;
+    if (participant.currentHealth <= 0) {
+        participant.currentHealth = 0;
+        participant.isAlive = false;
+    }
 
-            std::string targetName = participant.isPlayer ? "Player" : "Enemy";
-            ShowMessage(targetName + " takes " + std::to_string(finalDamage) + " damage!", 1.5f);
+    std::string targetName = participant.isPlayer ? "Player" : "Enemy";
+    ShowMessage(targetName + " takes " + std::to_string(damage) + " damage!", 1.5f);
 
-            if (!participant.isAlive) {
-                ShowMessage(targetName + " is defeated!", 2.0f);
+    if (!participant.isAlive) {
+        ShowMessage(targetName + " is defeated!", 2.0f);
+    }
+}
+
+void CombatState::ExecuteDefend(Entity defender) {
+    for (auto& participant : m_participants) {
+        if (participant.entity.GetID() == defender.GetID()) {
+            if (participant.isPlayer) {
+                ShowMessage("Defending! Damage reduced next turn.", 1.5f);
+                // TODO: Apply defense buff
+            } else {
+                participant.defending = true;
+                ShowMessage("Enemy braces for the next blow!", 1.5f);
             }
             break;
         }
     }
 }
 
-void CombatState::ExecuteDefend([[maybe_unused]] Entity defender) {
-    ShowMessage("Defending! Damage reduced next turn.", 1.5f);
-    // TODO: Apply defense buff
+void CombatState::ExecuteMagic(Entity caster, Entity target) {
+    for (auto& participant : m_participants) {
+        if (participant.entity.GetID() != caster.GetID()) {
+            continue;
+        }
+        if (participant.currentMana < BattleRules::MAGIC_COST) {
+            ExecuteAttack(caster, target);
+            return;
+        }
+        participant.currentMana -= BattleRules::MAGIC_COST;
+        break;
+    }
+
+    // Spells ignore equipment defense
+    int roll = BattleRules::MAGIC_MIN + (rand() % BattleRules::MAGIC_ROLLS);
+    for (auto& participant : m_participants) {
+        if (participant.entity.GetID() == target.GetID()) {
+            ApplyDamage(participant, static_cast<int>(BattleRules::MagicDamage(roll, participant.defending)));
+            break;
+        }
+    }
 }
 
-void CombatState::ExecuteMagic([[maybe_unused]] Entity caster, [[maybe_unused]] Entity target) {
-    // TODO: Implement magic system
+/**
+ * @brief Snapshot the battle for the enemy search
+ *
+ * Units keep their m_participants index, so a BattleMove target maps
+ * straight back to a participant. Only the first BattleState::MAX_UNITS
+ * participants are modelled.
+ */
+BattleState CombatState::BuildBattleState() const {
+    BattleState state;
+    state.count = static_cast<int>(std::min<size_t>(m_participants.size(), BattleState::MAX_UNITS));
+    state.turn = m_currentTurnIndex;
+    for (int i = 0; i < state.count; ++i) {
+        const CombatParticipant& participant = m_participants[i];
+        BattleUnit& unit = state.units[i];
+        unit.health = participant.currentHealth;
+        unit.maxHealth = participant.maxHealth;
+        unit.mana = participant.currentMana;
+        unit.isPlayer = participant.isPlayer;
+        unit.isAlive = participant.isAlive;
+        unit.defending = participant.defending;
+        if (participant.isPlayer) {
+            unit.attackBonus = static_cast<float>(PartyManager::Get().GetAttackWithEquipment(0));
+            unit.defense = static_cast<float>(PartyManager::Get().GetDefenseWithEquipment(0));
+        }
+    }
+    return state;
 }
 
 bool CombatState::AttemptFlee() {
@@ -182,6 +182,13 @@ int GameConfig::GetEnemyHeight() const {
     return GetConfigValueInt("enemies", "enemy_height", 44);
 }
 
+std::string GameConfig::GetEnemyCollisionShape() const {
+    if (!m_currentLevel.empty() && m_levelConfig->Has("enemies", "collision_shape")) {
+        return m_levelConfig->Get("enemies", "collision_shape", "box").AsString();
+    }
+    return m_gameplayConfig->Get("enemies", "collision_shape", "box").AsString();
+}
+
 // Animation settings
 float GameConfig::GetAnimationFrameDuration() const {
     return m_gameplayConfig->Get("animation", "frame_duration", 0.15f).AsFloat();
@@ -307,6 +314,14 @@ float GameConfig::GetFleeSuccessRate() const {
     return GetConfigValueFloat("combat", "flee_success_rate", 75.0f);
 }
 
+int GameConfig::GetEnemyAIIterations() const {
+    return GetConfigValueInt("combat", "enemy_ai_iterations", 2000);
+}
+
+float GameConfig::GetEnemyAIFrameBudgetMs() const {
+    return GetConfigValueFloat("combat", "enemy_ai_frame_budget_ms", 2.0f);
+}
+
 // Combat timing
 float GameConfig::GetTurnStartDelay() const {
     return GetConfigValueFloat("combat", "turn_start_delay", 1.0f);
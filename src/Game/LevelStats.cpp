@@ -0,0 +1,86 @@
+/**
+ * @file LevelStats.cpp
+ * @brief Implementation of incrementally maintained level aggregates
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "Game/LevelStats.h"
+
+void LevelStats::Attach(EntityManager& manager) {
+    Reset();
+    m_manager = &manager;
+
+    // Tags decide which totals an entity counts toward; health decides
+    // whether it is alive and how much HP it adds
+    manager.OnAdd<PlayerTag>([this](Entity e) { Refresh(e); });
+    manager.OnAdd<EnemyTag>([this](Entity e) { Refresh(e); });
+    manager.OnAdd<BossTag>([this](Entity e) { Refresh(e); });
+    manager.OnAdd<HealthComponent>([this](Entity e) { Refresh(e); });
+    manager.OnChange<HealthComponent>([this](Entity e) { Refresh(e); });
+
+    manager.OnRemove<PlayerTag>([this](Entity e) { Refresh(e, GetComponentTypeID<PlayerTag>()); });
+    manager.OnRemove<EnemyTag>([this](Entity e) { Refresh(e, GetComponentTypeID<EnemyTag>()); });
+    manager.OnRemove<BossTag>([this](Entity e) { Refresh(e, GetComponentTypeID<BossTag>()); });
+    manager.OnRemove<HealthComponent>([this](Entity e) { Refresh(e, GetComponentTypeID<HealthComponent>()); });
+
+    for (Entity entity : manager.GetEntitiesWith<PlayerTag>()) {
+        Refresh(entity);
+    }
+    for (Entity entity : manager.GetEntitiesWith<EnemyTag>()) {
+        Refresh(entity);
+    }
+}
+
+void LevelStats::Reset() {
+    m_manager = nullptr;
+    m_contributions.clear();
+    m_alivePlayers = 0;
+    m_aliveEnemies = 0;
+    m_aliveBosses = 0;
+    m_enemyHealth = 0.0f;
+    m_enemyMaxHealth = 0.0f;
+}
+
+void LevelStats::Refresh(Entity entity, ComponentTypeID removing) {
+    auto has = [&](ComponentTypeID typeID) {
+        return typeID != removing && m_manager->GetSignature(entity).test(typeID);
+    };
+
+    Contribution next;
+    const HealthComponent* health = has(GetComponentTypeID<HealthComponent>())
+        ? m_manager->GetComponent<HealthComponent>(entity) : nullptr;
+    if (!health || !health->isDead) {
+        next.player = has(GetComponentTypeID<PlayerTag>());
+        next.enemy = has(GetComponentTypeID<EnemyTag>());
+        next.boss = has(GetComponentTypeID<BossTag>());
+        if (next.enemy && health) {
+            next.health = health->currentHealth;
+            next.maxHealth = health->maxHealth;
+        }
+    }
+
+    auto it = m_contributions.find(entity.GetID());
+    if (it != m_contributions.end()) {
+        Apply(it->second, -1);
+        m_contributions.erase(it);
+    }
+    if (next.player || next.enemy || next.boss) {
+        Apply(next, +1);
+        m_contributions.emplace(entity.GetID(), next);
+    }
+}
+
+void LevelStats::Apply(const Contribution& contribution, int sign) {
+    m_alivePlayers += contribution.player ? sign : 0;
+    m_aliveEnemies += contribution.enemy ? sign : 0;
+    m_aliveBosses += contribution.boss ? sign : 0;
+    m_enemyHealth += contribution.health * static_cast<float>(sign);
+    m_enemyMaxHealth += contribution.maxHealth * static_cast<float>(sign);
+
+    // Drop accumulated float error once the level is clear
+    if (m_aliveEnemies == 0) {
+        m_enemyHealth = 0.0f;
+        m_enemyMaxHealth = 0.0f;
+    }
+}
@@ -30,7 +30,8 @@ PlayingState::PlayingState()
     , m_playerX(0.0f)  // Will be set from config in OnEnter
     , m_playerY(0.0f)  // Will be set from config in OnEnter
     , m_playerVelX(0.0f)
-    , m_playerVelY(0.0f) {
+    , m_playerVelY(0.0f)
+    , m_keybindings(std::make_unique<KeybindingManager>()) {
 
     // Load configuration
     if (!m_gameConfig->LoadConfigs()) {
@@ -47,6 +48,11 @@ PlayingState::PlayingState()
 
     // Initialize collision cooldown
     m_collisionCooldown = 0.0f;
+
+    // Debug toggle follows the player's configured bindings
+    if (!m_keybindings->LoadFromConfig("assets/config/keybindings.ini")) {
+        std::cout << "Using default keybindings" << std::endl;
+    }
 }
 
 PlayingState::~PlayingState() = default;
@@ -78,15 +84,8 @@ void PlayingState::OnEnter() {
 
     // Initialize ECS
     m_entityManager = std::make_unique<EntityManager>();
-
-    // Add core systems for arcade gameplay
-    m_entityManager->AddSystem<MovementSystem>();
-    auto* collisionSystem = m_entityManager->AddSystem<CollisionSystem>();
-
-    // Set up collision callback for combat triggering
-    collisionSystem->SetCollisionCallback([this](const CollisionInfo& info) {
-        OnCollision(info);
-    });
+    m_levelStats.Attach(*m_entityManager);
+    CreateSystems();
 
     // Initialize CharacterFactory now that EntityManager is ready
     m_characterFactory = std::make_unique<CharacterFactory>(m_entityManager.get());
@@ -96,10 +95,8 @@ void PlayingState::OnEnter() {
         std::cerr << "Warning: Failed to load character configs, using defaults" << std::endl;
     }
 
-    // Add audio system if audio manager is available
+    // Load audio if audio manager is available
     if (GetEngine()->GetAudioManager()) {
-        m_entityManager->AddSystem<AudioSystem>(*GetEngine()->GetAudioManager());
-
         // Load game sounds
         GetEngine()->GetAudioManager()->LoadSound("jump", "assets/sounds/jump.wav", SoundType::SOUND_EFFECT);
         GetEngine()->GetAudioManager()->LoadSound("collision", "assets/sounds/collision.wav", SoundType::SOUND_EFFECT);
@@ -142,9 +139,26 @@ void PlayingState::OnEnter() {
 
 void PlayingState::OnExit() {
     std::cout << "Exiting Playing State" << std::endl;
+    m_inspector.ReleaseResources();
+    m_systemPipeline.reset();
     m_entityManager.reset();
 }
 
+void PlayingState::CreateSystems() {
+    // Core systems for arcade gameplay
+    m_systemPipeline = std::make_unique<GameplayPipeline>(*m_entityManager);
+
+    // Set up collision callback for combat triggering
+    m_systemPipeline->Get<CollisionSystem>().SetCollisionCallback([this](const CollisionInfo& info) {
+        OnCollision(info);
+    });
+
+    // Add audio system if audio manager is available
+    if (GetEngine()->GetAudioManager()) {
+        m_entityManager->AddSystem<AudioSystem>(*GetEngine()->GetAudioManager());
+    }
+}
+
 void PlayingState::Update(float deltaTime) {
     m_gameTime += deltaTime;
 
@@ -157,8 +171,49 @@ void PlayingState::Update(float deltaTime) {
     if (m_entityManager) {
         m_entityManager->Update(deltaTime);
 
+        // Keep spatial neighbours adjacent in memory before the systems walk them
+        m_spatialSortTimer -= deltaTime;
+        if (m_spatialSortTimer <= 0.0f) {
+            m_entityManager->SortByPosition<TransformComponent, CollisionComponent, AIComponent>();
+            m_spatialSortTimer = SPATIAL_SORT_INTERVAL;
+
+            // Kills leave pools sized for the peak; start releasing it
+            StorageStats storage = m_entityManager->GetStorageStats();
+            if (!m_compactingStorage &&
+                storage.GetFragmentation() > m_compactedFragmentation + STORAGE_COMPACT_THRESHOLD) {
+                m_compactingStorage = true;
+                m_storageBeforeCompaction = storage;
+            }
+        }
+
+        if (m_compactingStorage && m_entityManager->CompactStorage(STORAGE_COMPACT_BUDGET_MS)) {
+            m_compactingStorage = false;
+            StorageStats storage = m_entityManager->GetStorageStats();
+            m_compactedFragmentation = storage.GetFragmentation();
+            std::cout << "🧹 Component storage compacted: " << m_storageBeforeCompaction.reservedBytes
+                      << " -> " << storage.reservedBytes << " bytes, fragmentation "
+                      << m_storageBeforeCompaction.GetFragmentation() << " -> "
+                      << storage.GetFragmentation() << std::endl;
+        }
+
+        if (m_systemPipeline) {
+            // Ballistic enemies outside the view go dormant. The left edge is the
+            // respawn line, so enemies still wrap around before they stop updating
+            m_systemPipeline->Get<BallisticSystem>().SetActiveRegion(
+                m_cameraX + m_gameConfig->GetEnemyRespawnDistance(),
+                -ACTIVE_REGION_MARGIN,
+                m_cameraX + m_gameConfig->GetScreenWidth() + ACTIVE_REGION_MARGIN,
+                m_gameConfig->GetScreenHeight() + ACTIVE_REGION_MARGIN);
+            m_systemPipeline->Update(deltaTime);
+        }
+
         // Update player animation based on movement
         UpdatePlayerAnimation();
+
+        if (auto* renderer = GetRenderer()) {
+            m_inspector.SetRenderStats(renderer->GetLastFrameStats());
+        }
+        m_inspector.Update(deltaTime, *m_entityManager);
     }
 
     // Update player position (simple movement system)
@@ -216,6 +271,9 @@ void PlayingState::Render() {
     auto* renderer = GetRenderer();
     if (!renderer) return;
 
+    // Everything up to the HUD is world and may be drawn at reduced scale
+    renderer->BeginWorldLayer();
+
     // Get screen dimensions once for the entire render method
     int screenWidth = m_gameConfig->GetScreenWidth();
 
@@ -269,77 +327,16 @@ void PlayingState::Render() {
         }
     }
 
-    // Render player sprite with animation
-    int spriteWidth = m_gameConfig->GetAnimationSpriteWidth();
-    if (playerScreenX > -spriteWidth && playerScreenX < screenWidth + spriteWidth) {
-        // Animation logic
-        static float animationTimer = 0.0f;
-        static int currentFrame = 0;
-        static bool facingLeft = false;
-
-        float frameTime = m_gameConfig->GetApproximateFrameTime();
-        animationTimer += frameTime;
-
-        // Determine animation state and frame
-        float movementThreshold = m_gameConfig->GetPlayerMovementThreshold();
-        bool isMoving = (std::abs(m_playerVelX) > movementThreshold || std::abs(m_playerVelY) > movementThreshold);
-
-        if (isMoving) {
-            // Walking animation - cycle through frames
-            float frameDuration = m_gameConfig->GetAnimationFrameDuration();
-            if (animationTimer >= frameDuration) {
-                int totalFrames = m_gameConfig->GetAnimationTotalFrames();
-                currentFrame = (currentFrame + 1) % totalFrames;
-                animationTimer = 0.0f;
-            }
-
-            // Update facing direction based on horizontal movement
-            if (std::abs(m_playerVelX) > movementThreshold) {
-                facingLeft = (m_playerVelX < 0);
-            }
-        } else {
-            // Idle animation - stay on frame 0
-            currentFrame = 0;
-            animationTimer = 0.0f;
-        }
-
-        // Try to render sprite texture first
-        int spriteHeight = m_gameConfig->GetAnimationSpriteHeight();
-        int totalFrames = m_gameConfig->GetAnimationTotalFrames();
-        float spriteScale = m_gameConfig->GetAnimationSpriteScale();
-        SpriteFrame frame = SpriteRenderer::CreateFrame(currentFrame, spriteWidth, spriteHeight, totalFrames);
-        const std::string playerSpritePath = m_gameConfig->GetPlayerSpritePath();
-        SpriteRenderer::RenderSprite(renderer, playerSpritePath,
-                                   playerScreenX, playerScreenY, frame, facingLeft, spriteScale);
-
-        // If texture fails, the SpriteRenderer will show a magenta placeholder
-        // For a more detailed fallback, we can add simple shapes here
-        static bool textureExists = true;
-        auto texture = renderer->LoadTexture(playerSpritePath);
-        if (!texture && textureExists) {
-            textureExists = false;
-            std::cout << "Using simple shape rendering for player" << std::endl;
-        }
+    // Queue the player and visible enemies; they are drawn back to front below
+    m_renderQueue.Clear();
+    m_drawList.clear();
 
-        if (!texture) {
-            // Simple shape-based player character using config colors and dimensions
-            Color bodyColor = m_gameConfig->GetPlayerBodyColor();
-            int bodyWidth = m_gameConfig->GetPlayerBodyWidth();
-            int bodyHeight = m_gameConfig->GetPlayerBodyHeight();
-            int bodyOffsetX = m_gameConfig->GetPlayerBodyOffsetX();
-            int bodyOffsetY = m_gameConfig->GetPlayerBodyOffsetY();
-            Rectangle bodyRect(playerScreenX + bodyOffsetX, playerScreenY + bodyOffsetY, bodyWidth, bodyHeight);
-            renderer->DrawRectangle(bodyRect, bodyColor, true);
-
-            // Head
-            Color headColor = m_gameConfig->GetPlayerHeadColor();
-            int headWidth = m_gameConfig->GetPlayerHeadWidth();
-            int headHeight = m_gameConfig->GetPlayerHeadHeight();
-            int headOffsetX = m_gameConfig->GetPlayerHeadOffsetX();
-            int headOffsetY = m_gameConfig->GetPlayerHeadOffsetY();
-            Rectangle headRect(playerScreenX + headOffsetX, playerScreenY + headOffsetY, headWidth, headHeight);
-            renderer->DrawRectangle(headRect, headColor, true);
-        }
+    int spriteWidth = m_gameConfig->GetAnimationSpriteWidth();
+    bool drawPlayer = playerScreenX > -spriteWidth && playerScreenX < screenWidth + spriteWidth;
+    if (drawPlayer) {
+        float playerFeetY = playerScreenY + m_gameConfig->GetAnimationSpriteHeight() * m_gameConfig->GetAnimationSpriteScale();
+        m_renderQueue.Push(m_player.GetID(), 1, playerFeetY);
+        m_drawList.push_back(m_player);
     }
 
     // Manual sprite rendering for better control in arcade games
@@ -383,43 +380,40 @@ void PlayingState::Render() {
     // Try to render actual ECS enemies if present
     bool drewAny = false;
     if (m_entityManager) {
-        auto entities = m_entityManager->GetEntitiesWith<TransformComponent, CharacterTypeComponent>();
+        auto entities = m_entityManager->GetEntitiesWith<TransformComponent, EnemyTag>();
         for (auto e : entities) {
-            auto* type = m_entityManager->GetComponent<CharacterTypeComponent>(e);
-            if (!type) continue;
-            if (type->type != CharacterTypeComponent::CharacterType::ENEMY &&
-                type->type != CharacterTypeComponent::CharacterType::BOSS) continue;
             auto* transform = m_entityManager->GetComponent<TransformComponent>(e);
             if (!transform) continue;
 
             int enemyScreenX = static_cast<int>(transform->x - m_cameraX);
             if (enemyScreenX <= -enemyWidth || enemyScreenX >= screenWidth) continue;
 
-            bool drewSprite = false;
-            if (auto* sprite = m_entityManager->GetComponent<SpriteComponent>(e)) {
-                // Draw using sprite texture path and dimensions
-                SpriteFrame f(0, 0, sprite->width, sprite->height);
-                SpriteRenderer::RenderSprite(renderer, sprite->texturePath, enemyScreenX, static_cast<int>(transform->y), f, true, 1.0f);
-                drewSprite = true;
-            }
-
-            if (!drewSprite) {
-                // Fallback: use RenderComponent color/size or default rectangle
-                Color enemyColor = m_gameConfig->GetEnemyRedColor();
-                int w = enemyWidth, h = enemyHeight;
-                if (auto* rc = m_entityManager->GetComponent<RenderComponent>(e)) {
-                    enemyColor = Color(rc->r, rc->g, rc->b, 255);
-                    w = rc->width; h = rc->height;
-                }
-                Rectangle enemyRect(enemyScreenX, static_cast<int>(transform->y), w, h);
-                renderer->DrawRectangle(enemyRect, enemyColor, true);
+            int h = enemyHeight;
+            if (const auto* sprite = m_entityManager->ReadComponent<SpriteComponent>(e)) {
+                h = sprite->height;
+            } else if (const auto* rc = m_entityManager->ReadComponent<RenderComponent>(e)) {
+                h = rc->height;
             }
+            m_renderQueue.Push(e.GetID(), 1, transform->y + h);
+            m_drawList.push_back(e);
             drewAny = true;
         }
     }
+
+    for (std::uint32_t index : m_renderQueue.Sort()) {
+        Entity e = m_drawList[index];
+        if (e == m_player) {
+            DrawPlayer(renderer, playerScreenX, playerScreenY);
+        } else if (const auto* transform = m_entityManager->ReadComponent<TransformComponent>(e)) {
+            DrawEnemy(renderer, e, static_cast<int>(transform->x - m_cameraX), static_cast<int>(transform->y));
+        }
+    }
+
     // If we rendered any ECS enemies, we can skip preview rectangles
     if (drewAny) {
+        renderer->BeginUILayer();
         DrawHUD();
+        m_inspector.Render(renderer);
         return;
     }
 
@@ -462,7 +456,109 @@ void PlayingState::Render() {
         }
     }
 
+    renderer->BeginUILayer();
     DrawHUD();
+    m_inspector.Render(renderer);
+}
+
+void PlayingState::DrawPlayer(Renderer* renderer, int screenX, int screenY) {
+    int spriteWidth = m_gameConfig->GetAnimationSpriteWidth();
+    // Animation logic
+    static float animationTimer = 0.0f;
+    static int currentFrame = 0;
+    static bool facingLeft = false;
+
+    float frameTime = m_gameConfig->GetApproximateFrameTime();
+    animationTimer += frameTime;
+
+    // Determine animation state and frame
+    float movementThreshold = m_gameConfig->GetPlayerMovementThreshold();
+    bool isMoving = (std::abs(m_playerVelX) > movementThreshold || std::abs(m_playerVelY) > movementThreshold);
+
+    if (isMoving) {
+        // Walking animation - cycle through frames
+        float frameDuration = m_gameConfig->GetAnimationFrameDuration();
+        if (animationTimer >= frameDuration) {
+            int totalFrames = m_gameConfig->GetAnimationTotalFrames();
+            currentFrame = (currentFrame + 1) % totalFrames;
+            animationTimer = 0.0f;
+        }
+
+        // Update facing direction based on horizontal movement
+        if (std::abs(m_playerVelX) > movementThreshold) {
+            facingLeft = (m_playerVelX < 0);
+        }
+    } else {
+        // Idle animation - stay on frame 0
+        currentFrame = 0;
+        animationTimer = 0.0f;
+    }
+
+    // Try to render sprite texture first
+    int spriteHeight = m_gameConfig->GetAnimationSpriteHeight();
+    int totalFrames = m_gameConfig->GetAnimationTotalFrames();
+    float spriteScale = m_gameConfig->GetAnimationSpriteScale();
+    SpriteFrame frame = SpriteRenderer::CreateFrame(currentFrame, spriteWidth, spriteHeight, totalFrames);
+    const std::string playerSpritePath = m_gameConfig->GetPlayerSpritePath();
+    SpriteRenderer::RenderSprite(renderer, playerSpritePath,
+                               screenX, screenY, frame, facingLeft, spriteScale);
+
+    // Collide with the silhouette that is actually on screen
+    if (auto* mask = m_entityManager ? m_entityManager->GetComponent<CollisionMaskComponent>(m_player) : nullptr) {
+        mask->frame = currentFrame;
+        mask->flipHorizontal = facingLeft;
+    }
+
+    // If texture fails, the SpriteRenderer will show a magenta placeholder
+    // For a more detailed fallback, we can add simple shapes here
+    static bool textureExists = true;
+    auto texture = renderer->LoadTexture(playerSpritePath);
+    if (!texture && textureExists) {
+        textureExists = false;
+        std::cout << "Using simple shape rendering for player" << std::endl;
+    }
+
+    if (!texture) {
+        // Simple shape-based player character using config colors and dimensions
+        Color bodyColor = m_gameConfig->GetPlayerBodyColor();
+        int bodyWidth = m_gameConfig->GetPlayerBodyWidth();
+        int bodyHeight = m_gameConfig->GetPlayerBodyHeight();
+        int bodyOffsetX = m_gameConfig->GetPlayerBodyOffsetX();
+        int bodyOffsetY = m_gameConfig->GetPlayerBodyOffsetY();
+        Rectangle bodyRect(screenX + bodyOffsetX, screenY + bodyOffsetY, bodyWidth, bodyHeight);
+        renderer->DrawRectangle(bodyRect, bodyColor, true);
+
+        // Head
+        Color headColor = m_gameConfig->GetPlayerHeadColor();
+        int headWidth = m_gameConfig->GetPlayerHeadWidth();
+        int headHeight = m_gameConfig->GetPlayerHeadHeight();
+        int headOffsetX = m_gameConfig->GetPlayerHeadOffsetX();
+        int headOffsetY = m_gameConfig->GetPlayerHeadOffsetY();
+        Rectangle headRect(screenX + headOffsetX, screenY + headOffsetY, headWidth, headHeight);
+        renderer->DrawRectangle(headRect, headColor, true);
+    }
+}
+
+void PlayingState::DrawEnemy(Renderer* renderer, Entity enemy, int screenX, int screenY) {
+    bool drewSprite = false;
+    if (const auto* sprite = m_entityManager->ReadComponent<SpriteComponent>(enemy)) {
+        // Draw using sprite texture path and dimensions
+        SpriteFrame f(0, 0, sprite->width, sprite->height);
+        SpriteRenderer::RenderSprite(renderer, sprite->texturePath, screenX, screenY, f, true, 1.0f);
+        drewSprite = true;
+    }
+
+    if (!drewSprite) {
+        // Fallback: use RenderComponent color/size or default rectangle
+        Color enemyColor = m_gameConfig->GetEnemyRedColor();
+        int w = m_gameConfig->GetEnemyWidth(), h = m_gameConfig->GetEnemyHeight();
+        if (const auto* rc = m_entityManager->ReadComponent<RenderComponent>(enemy)) {
+            enemyColor = Color(rc->r, rc->g, rc->b, 255);
+            w = rc->width; h = rc->height;
+        }
+        Rectangle enemyRect(screenX, screenY, w, h);
+        renderer->DrawRectangle(enemyRect, enemyColor, true);
+    }
 }
 
 void PlayingState::HandleInput() {
@@ -483,6 +579,14 @@ void PlayingState::HandleInput() {
         }
     }
 
+    // ECS inspector overlay (F1 by default)
+    if (m_keybindings->IsActionJustPressed(GameAction::DEBUG_TOGGLE, input)) {
+        m_inspector.Toggle();
+    }
+    if (m_entityManager && GetRenderer()) {
+        m_inspector.HandleInput(*input, *GetRenderer(), *m_entityManager, m_cameraX);
+    }
+
     // Manual config reload (R key)
     if (input->IsKeyJustPressed(SDL_SCANCODE_R)) {
         std::cout << "🔄 Manual config reload requested..." << std::endl;
@@ -575,6 +679,7 @@ void PlayingState::HandleInput() {
     auto allEntities = m_entityManager->GetEntitiesWith<TransformComponent, VelocityComponent>();
     for (Entity entity : allEntities) {
         if (entity == m_player) continue; // Skip player, already handled above
+        if (m_entityManager->HasComponent<DormantTag>(entity)) continue; // Parked off-screen, not moving
 
         auto* transform = m_entityManager->GetComponent<TransformComponent>(entity);
         auto* velocity = m_entityManager->GetComponent<VelocityComponent>(entity);
@@ -644,7 +749,23 @@ void PlayingState::CreatePlayer() {
     [[maybe_unused]] auto* audio = m_entityManager->AddComponent<AudioComponent>(m_player, "jump", m_gameConfig->GetJumpSoundVolume(), false, false, false);
 
     // Add collision component for combat triggering
-    [[maybe_unused]] auto* collision = m_entityManager->AddComponent<CollisionComponent>(m_player, 32.0f, 48.0f);
+    auto* collision = m_entityManager->AddComponent<CollisionComponent>(m_player, 32.0f, 48.0f);
+
+    // Pixel masks per animation frame, so transparent sprite corners never start a fight
+    int totalFrames = m_gameConfig->GetAnimationTotalFrames();
+    std::vector<SpriteFrame> playerFrames;
+    for (int i = 0; i < totalFrames; ++i) {
+        playerFrames.push_back(SpriteRenderer::CreateFrame(i, m_gameConfig->GetAnimationSpriteWidth(),
+                                                           m_gameConfig->GetAnimationSpriteHeight(), totalFrames));
+    }
+    auto playerMasks = SpriteRenderer::LoadCollisionMasks(m_gameConfig->GetPlayerSpritePath(), playerFrames,
+                                                          m_gameConfig->GetAnimationSpriteScale());
+    if (playerMasks && !playerMasks->empty()) {
+        // The box becomes the broad phase, so it has to cover the drawn sprite
+        collision->width = static_cast<float>(playerMasks->front().GetWidth());
+        collision->height = static_cast<float>(playerMasks->front().GetHeight());
+        m_entityManager->AddComponent<CollisionMaskComponent>(m_player, playerMasks);
+    }
 
     // Add character type component to identify as player
     auto* charType = m_entityManager->AddComponent<CharacterTypeComponent>(m_player,
@@ -653,6 +774,7 @@ void PlayingState::CreatePlayer() {
         "Player");
 
     std::cout << "DEBUG: Added CharacterTypeComponent to player - type: " << static_cast<int>(charType->type) << std::endl;
+    m_entityManager->AddTag<PlayerTag>(m_player);
 
     // Add health component
     [[maybe_unused]] auto* health = m_entityManager->AddComponent<HealthComponent>(m_player, 100.0f);
@@ -691,11 +813,17 @@ void PlayingState::CreateEnemies() {
                 } else {
                     m_entityManager->AddComponent<VelocityComponent>(enemy, p.vx, p.vy);
                 }
+                // Unsteered level movers can go dormant off-screen
+                if (m_entityManager->GetComponent<VelocityComponent>(enemy)->vy == 0.0f &&
+                    !m_entityManager->HasComponent<AIComponent>(enemy)) {
+                    m_entityManager->AddComponent<BallisticComponent>(enemy);
+                }
                 // Ensure collider exists for combat triggering
                 if (!m_entityManager->GetComponent<CollisionComponent>(enemy)) {
                     int w = m_gameConfig->GetEnemyWidth();
                     int h = m_gameConfig->GetEnemyHeight();
-                    m_entityManager->AddComponent<CollisionComponent>(enemy, static_cast<float>(w), static_cast<float>(h));
+                    m_entityManager->AddComponent<CollisionComponent>(enemy, static_cast<float>(w), static_cast<float>(h),
+                        CollisionComponent::ShapeFromName(m_gameConfig->GetEnemyCollisionShape()));
                 }
                 count++;
             }
@@ -731,6 +859,10 @@ void PlayingState::CreateEnemies() {
 
         auto* transform = m_entityManager->AddComponent<TransformComponent>(enemy, x, y);
         auto* velocity = m_entityManager->AddComponent<VelocityComponent>(enemy, velocityX, velocityY);
+        if (velocityY == 0.0f) {
+            // Nothing bounces a level mover, so off-screen it can go dormant
+            m_entityManager->AddComponent<BallisticComponent>(enemy);
+        }
 
         std::cout << "DEBUG: Enemy " << i << " TransformComponent added at (" << transform->x << ", " << transform->y << ")" << std::endl;
 
@@ -743,32 +875,30 @@ void PlayingState::CreateEnemies() {
             case 2: enemyColor = m_gameConfig->GetEnemyPurpleColor(); break;
         }
 
+        // Look is shared: the wave stores one RenderComponent per color variant
         int enemyWidth = m_gameConfig->GetEnemyWidth();
         int enemyHeight = m_gameConfig->GetEnemyHeight();
-        auto* render = m_entityManager->AddComponent<RenderComponent>(enemy, enemyWidth, enemyHeight,
-                                                     enemyColor.r, enemyColor.g, enemyColor.b);
+        const auto* render = m_entityManager->SetShared(enemy, RenderComponent(enemyWidth, enemyHeight,
+                                                                              enemyColor.r, enemyColor.g, enemyColor.b));
         [[maybe_unused]] auto* audio = m_entityManager->AddComponent<AudioComponent>(enemy, "collision", m_gameConfig->GetCollisionSoundVolume(), false, false, true); // Collision sound
 
         // Add collision component for combat triggering
         [[maybe_unused]] auto* collision = m_entityManager->AddComponent<CollisionComponent>(enemy,
-            static_cast<float>(enemyWidth), static_cast<float>(enemyHeight));
+            static_cast<float>(enemyWidth), static_cast<float>(enemyHeight),
+            CollisionComponent::ShapeFromName(m_gameConfig->GetEnemyCollisionShape()));
 
-        // Add character type component to identify as enemy
-        auto* charType = m_entityManager->AddComponent<CharacterTypeComponent>(enemy,
-            CharacterTypeComponent::CharacterType::ENEMY,
-            CharacterTypeComponent::CharacterClass::MONSTER,
-            "Enemy");
-
-        std::cout << "DEBUG: Added CharacterTypeComponent to enemy " << i << " - type: " << static_cast<int>(charType->type) << std::endl;
+        // Tag as enemy (signature bit only, no per-entity storage)
+        m_entityManager->AddTag<EnemyTag>(enemy);
 
         // Add health component
         [[maybe_unused]] auto* health = m_entityManager->AddComponent<HealthComponent>(enemy, 50.0f);
 
-        // Add combat stats component
-        auto* combatStats = m_entityManager->AddComponent<CombatStatsComponent>(enemy);
-        combatStats->attackPower = m_gameConfig->GetBaseAttackDamage() * 0.8f; // Slightly weaker
-        combatStats->defense = m_gameConfig->GetBaseDefense() * 0.5f;
-        combatStats->speed = m_gameConfig->GetBaseSpeed() * 0.9f;
+        // Combat stats are identical across the wave, so every enemy shares one value
+        CombatStatsComponent combatStats;
+        combatStats.attackPower = m_gameConfig->GetBaseAttackDamage() * 0.8f; // Slightly weaker
+        combatStats.defense = m_gameConfig->GetBaseDefense() * 0.5f;
+        combatStats.speed = m_gameConfig->GetBaseSpeed() * 0.9f;
+        m_entityManager->SetShared(enemy, combatStats);
 
         std::cout << "Created enemy " << i << " with ID: " << enemy.GetID() << std::endl;
         std::cout << "  Transform: " << (transform ? "OK" : "FAILED") << " pos(" << (transform ? transform->x : 0) << "," << (transform ? transform->y : 0) << ")" << std::endl;
@@ -858,7 +988,7 @@ void PlayingState::DrawHUD() {
     // Current level indicator moved to HUD top-left block, smaller scale
     std::string currentLevel = m_gameConfig->GetCurrentLevel();
     if (currentLevel.empty()) { currentLevel = "Base"; }
-    std::string levelText = "LEVEL: " + currentLevel;
+    std::string levelText = "LEVEL: " + currentLevel + "  ENEMIES: " + std::to_string(m_levelStats.GetAliveEnemies());
     int levelX = scoreX + 180; // to the right of SCORE
     int levelY = scoreY; // same baseline
     BitmapFont::DrawText(renderer, levelText, levelX, levelY, scoreScale, textNormalColor);
@@ -890,7 +1020,9 @@ void PlayingState::DrawHUD() {
         bool requireBoth = m_gameConfig->GetRequireBossAndEnd();
         dbg += "  dist=" + std::to_string((int)traveled) + "/" + std::to_string((int)endd);
         dbg += bossRequired ? (requireBoth ? "  req:boss+end" : "  req:boss|end") : "  req:end";
-        dbg += m_bossDefeated ? "  boss:done" : "  boss:--";
+        dbg += m_bossDefeated ? "  boss:done" : (m_levelStats.IsBossAlive() ? "  boss:alive" : "  boss:--");
+        dbg += "  enemyhp=" + std::to_string((int)m_levelStats.GetTotalEnemyHealth()) + "/" +
+               std::to_string((int)m_levelStats.GetTotalEnemyMaxHealth());
         BitmapFont::DrawText(renderer, dbg, 10, hudHeight + 8, 1, m_gameConfig->GetTextInstructionsColor());
     }
 
@@ -1124,17 +1256,16 @@ void PlayingState::ResetGameState() {
 
     // Recreate entities with new config values
     if (m_entityManager) {
+        m_inspector.Reset();
+        m_systemPipeline.reset();
         m_entityManager.reset();
         m_entityManager = std::make_unique<EntityManager>();
+        m_levelStats.Attach(*m_entityManager);
+        m_compactingStorage = false;
+        m_compactedFragmentation = 0.0f;
 
-        // Re-add systems
-        m_entityManager->AddSystem<MovementSystem>();
-        auto* collisionSystem = m_entityManager->AddSystem<CollisionSystem>();
-
-        // Re-set collision callback
-        collisionSystem->SetCollisionCallback([this](const CollisionInfo& info) {
-            OnCollision(info);
-        });
+        // Re-add systems (and collision callback)
+        CreateSystems();
 
         // Reinitialize CharacterFactory
         m_characterFactory = std::make_unique<CharacterFactory>(m_entityManager.get());
@@ -1142,10 +1273,6 @@ void PlayingState::ResetGameState() {
             std::cerr << "Warning: Failed to reload character configs" << std::endl;
         }
 
-        if (GetEngine()->GetAudioManager()) {
-            m_entityManager->AddSystem<AudioSystem>(*GetEngine()->GetAudioManager());
-        }
-
 
         // Recreate entities
         CreatePlayer();
@@ -1232,13 +1359,12 @@ void PlayingState::OnCollision(const CollisionInfo& info) {
         return;
     }
 
-    // Prefer character type check, but allow a safe fallback when missing
-    auto* otherType = m_entityManager->GetComponent<CharacterTypeComponent>(other);
-    if (otherType) {
-        if (otherType->type != CharacterTypeComponent::CharacterType::ENEMY) {
-            std::cout << "Collision with non-enemy (type=" << (int)otherType->type << ")" << std::endl;
-            return;
-        }
+    // Prefer the enemy tag (bosses carry it too), but allow a safe fallback when missing
+    if (m_entityManager->HasComponent<EnemyTag>(other)) {
+        // Enemy or boss: fight
+    } else if (auto* otherType = m_entityManager->GetComponent<CharacterTypeComponent>(other)) {
+        std::cout << "Collision with non-enemy (type=" << (int)otherType->type << ")" << std::endl;
+        return;
     } else {
         // Fallback: if no type, require that 'other' has a CollisionComponent and is not the player
         // This still avoids random triggers from UI/neutral entities that likely lack colliders
@@ -1274,6 +1400,10 @@ void PlayingState::OnCollision(const CollisionInfo& info) {
 }
 
 void PlayingState::TriggerCombat(Entity player, Entity enemy) {
+    // The encounter is the set of enemies targeting the player; the link
+    // goes away by itself if the enemy is destroyed before combat ends
+    m_entityManager->SetRelation(enemy, Relation::TARGETS, player);
+
     // Store current player position for return after combat
     float returnX = m_playerX;
     float returnY = m_playerY;
@@ -1297,10 +1427,7 @@ void PlayingState::TriggerCombat(Entity player, Entity enemy) {
         combatState->InitializeCombat(player, enemies);
         combatState->SetReturnPosition(returnX, returnY);
         // If any enemy in the encounter is a boss, mark it
-        bool bossEncounter = false;
-        if (auto* type = m_entityManager->GetComponent<CharacterTypeComponent>(enemy)) {
-            bossEncounter = (type->type == CharacterTypeComponent::CharacterType::BOSS);
-        }
+        bool bossEncounter = m_entityManager->HasComponent<BossTag>(enemy);
         combatState->SetBossEncounter(bossEncounter);
 
         std::cout << "Combat initialized with player " << player.GetID() << " vs enemy " << enemy.GetID() << std::endl;
@@ -1315,6 +1442,26 @@ void PlayingState::OnCombatEnded(bool playerWon, bool wasBossEncounter) {
     m_collisionCooldown = 0.0f;
     if (playerWon && wasBossEncounter) m_bossDefeated = true;
 
+    // The encounter is over: the enemies stop targeting the player. A
+    // beaten enemy also leaves the field; marking it dead updates
+    // m_levelStats immediately, the entity is removed at the next ECS update.
+    if (m_entityManager) {
+        // Copy: removing the links edits the reverse list being read
+        std::vector<Entity> encounter = m_entityManager->GetRelationSources(Relation::TARGETS, m_player);
+        for (Entity enemy : encounter) {
+            m_entityManager->RemoveRelation(enemy, Relation::TARGETS);
+            if (!playerWon) {
+                continue;
+            }
+            if (auto* health = m_entityManager->GetComponent<HealthComponent>(enemy)) {
+                health->currentHealth = 0.0f;
+                health->isDead = true;
+                m_entityManager->MarkChanged<HealthComponent>(enemy);
+            }
+            m_entityManager->DestroyEntity(enemy);
+        }
+    }
+
     // If boss defeat is the win condition and this was a boss fight won, advance level
     if (playerWon && wasBossEncounter && m_gameConfig->GetWinOnBossDefeat()) {
         std::string nextLevel = m_gameConfig->GetNextLevelName();
@@ -1335,62 +1482,29 @@ void PlayingState::OnCombatEnded(bool playerWon, bool wasBossEncounter) {
             return;
         }
     }
-    // Otherwise, normal return handling
-    HandlePostCombatReturn();
-
-
-    // If the victory path is going to GameOver (WIN), do not also move the player back here
-    if (playerWon) return;
-
-    // Defeat-all-enemies progression
-    if (playerWon && m_gameConfig->GetWinOnDefeatAllEnemies()) {
-        // Determine if there are any remaining enemies on the field
-        if (m_entityManager) {
-            auto enemies = m_entityManager->GetEntitiesWith<CharacterTypeComponent>();
-            bool anyAliveEnemy = false;
-            for (auto e : enemies) {
-                auto* type = m_entityManager->GetComponent<CharacterTypeComponent>(e);
-                if (!type) continue;
-                if (type->type == CharacterTypeComponent::CharacterType::ENEMY ||
-                    type->type == CharacterTypeComponent::CharacterType::BOSS) {
-                    anyAliveEnemy = true;
-                    break;
-                }
-            }
-            if (!anyAliveEnemy) {
-                std::string nextLevel = m_gameConfig->GetNextLevelName();
-                if (!nextLevel.empty()) {
-                    std::cout << "✅ All enemies cleared! Prompting next level: " << nextLevel << std::endl;
-                    if (auto* manager = GetStateManager()) {
-                        if (auto* state = manager->GetState(GameStateType::GAME_OVER)) {
-                            if (auto* gameOver = dynamic_cast<GameOverState*>(state)) {
-                                gameOver->SetScore(m_score);
-                                gameOver->SetOutcome(GameOverState::Outcome::WIN);
-                                gameOver->SetRunTotal(m_totalRunScore + m_score);
-                                gameOver->SetNextLevel(nextLevel);
-                            }
-                        }
-                        manager->ChangeState(GameStateType::GAME_OVER);
-                    }
-                    return;
-                } else {
+    // Defeat-all-enemies progression (O(1): counts are kept by m_levelStats)
+    if (playerWon && m_gameConfig->GetWinOnDefeatAllEnemies() && m_levelStats.GetAliveEnemies() == 0) {
+        std::string nextLevel = m_gameConfig->GetNextLevelName();
+        if (!nextLevel.empty()) {
+            std::cout << "✅ All enemies cleared! Prompting next level: " << nextLevel << std::endl;
+        }
+        if (auto* manager = GetStateManager()) {
+            if (auto* state = manager->GetState(GameStateType::GAME_OVER)) {
+                if (auto* gameOver = dynamic_cast<GameOverState*>(state)) {
                     // If no next level, treat as end of run victory
-                    if (auto* manager = GetStateManager()) {
-                        if (auto* state = manager->GetState(GameStateType::GAME_OVER)) {
-                            if (auto* gameOver = dynamic_cast<GameOverState*>(state)) {
-                                gameOver->SetScore(m_totalRunScore + m_score);
-                                gameOver->SetOutcome(GameOverState::Outcome::WIN);
-                                gameOver->SetRunTotal(m_totalRunScore + m_score);
-                                gameOver->SetNextLevel("");
-                            }
-                        }
-                        manager->ChangeState(GameStateType::GAME_OVER);
-                    }
-                    return;
+                    gameOver->SetScore(nextLevel.empty() ? m_totalRunScore + m_score : m_score);
+                    gameOver->SetOutcome(GameOverState::Outcome::WIN);
+                    gameOver->SetRunTotal(m_totalRunScore + m_score);
+                    gameOver->SetNextLevel(nextLevel);
                 }
             }
+            manager->ChangeState(GameStateType::GAME_OVER);
         }
+        return;
     }
+
+    // Otherwise, normal return handling
+    HandlePostCombatReturn();
 }
 
 void PlayingState::HandlePostCombatReturn() {
@@ -119,7 +119,28 @@ run_test "State Management System" "test_state_management" 15
 # Test 3: Audio System
 run_test "Audio System" "test_audio_system" 10
 
-# Test 4: Input System (this one might need manual verification)
+# Test 4: ECS Core
+run_test "ECS Core" "test_ecs_core" 10
+
+# Test 5: Component Reflection
+run_test "Component Reflection" "test_component_reflection" 10
+
+# Test 6: Combat AI
+run_test "Combat AI" "test_combat_ai" 10
+
+# Test 7: Render Queue
+run_test "Render Queue" "test_render_queue" 10
+
+# Test 8: Dynamic Resolution
+run_test "Dynamic Resolution" "test_dynamic_resolution" 10
+
+# Test 9: Atlas Packer
+run_test "Atlas Packer" "test_atlas_packer" 10
+
+# Test 10: Inplace Function
+run_test "Inplace Function" "test_inplace_function" 10
+
+# Test 11: Input System (this one might need manual verification)
 echo ""
 echo -e "${YELLOW}⚠️  Next test requires manual interaction${NC}"
 echo "The input test will open a window. Please interact with it as instructed."
@@ -0,0 +1,101 @@
+/**
+ * @file test_atlas_packer.cpp
+ * @brief Unit tests for the glyph atlas shelf packer
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "Engine/AtlasPacker.h"
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+
+// Simple test framework
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+    std::cout << "Running " #name "... "; \
+    test_##name(); \
+    std::cout << "PASSED" << std::endl; \
+} while(0)
+
+#define ASSERT_TRUE(condition) do { \
+    if (!(condition)) { \
+        std::cerr << "ASSERTION FAILED: " #condition << " at line " << __LINE__ << std::endl; \
+        exit(1); \
+    } \
+} while(0)
+
+#define ASSERT_FALSE(condition) ASSERT_TRUE(!(condition))
+
+namespace {
+
+struct Placed {
+    int x, y, w, h;
+};
+
+bool Overlap(const Placed& a, const Placed& b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+} // namespace
+
+TEST(glyphs_fill_rows_without_overlapping) {
+    AtlasPacker packer(64, 64);
+    std::vector<Placed> placed;
+    int x = 0, y = 0;
+
+    // Line-height glyphs of varying width, as SDL_ttf produces them
+    for (int i = 0; i < 40; ++i) {
+        int w = 4 + (i * 7) % 9;
+        if (!packer.Insert(w, 12, x, y)) {
+            break;
+        }
+        ASSERT_TRUE(x >= 0 && y >= 0 && x + w <= 64 && y + 12 <= 64);
+        placed.push_back(Placed{x, y, w, 12});
+    }
+    ASSERT_TRUE(placed.size() >= 20);
+
+    for (std::size_t i = 0; i < placed.size(); ++i) {
+        for (std::size_t j = i + 1; j < placed.size(); ++j) {
+            ASSERT_FALSE(Overlap(placed[i], placed[j]));
+        }
+    }
+
+    // Same-height glyphs share shelves: the page is mostly used when full
+    ASSERT_TRUE(packer.GetUsage() > 0.7f);
+    ASSERT_FALSE(packer.Insert(64, 12, x, y));
+}
+
+TEST(short_glyphs_reuse_existing_shelves) {
+    AtlasPacker packer(32, 32);
+    int x = 0, y = 0;
+    ASSERT_TRUE(packer.Insert(8, 10, x, y));
+    ASSERT_TRUE(x == 0 && y == 0);
+
+    // Fits on the first shelf instead of opening a new one
+    ASSERT_TRUE(packer.Insert(8, 6, x, y));
+    ASSERT_TRUE(x == 8 + AtlasPacker::PADDING && y == 0);
+
+    // Too tall for it: starts a shelf below
+    ASSERT_TRUE(packer.Insert(8, 14, x, y));
+    ASSERT_TRUE(x == 0 && y == 10 + AtlasPacker::PADDING);
+
+    ASSERT_FALSE(packer.Insert(40, 4, x, y));   // Wider than the page
+    ASSERT_FALSE(packer.Insert(0, 4, x, y));    // Empty
+
+    packer.Reset(32, 32);
+    ASSERT_TRUE(packer.GetUsage() == 0.0f);
+    ASSERT_TRUE(packer.Insert(8, 10, x, y));
+    ASSERT_TRUE(x == 0 && y == 0);
+}
+
+int main() {
+    std::cout << "🔤 ATLAS PACKER TESTS" << std::endl;
+    std::cout << "=====================" << std::endl;
+
+    RUN_TEST(glyphs_fill_rows_without_overlapping);
+    RUN_TEST(short_glyphs_reuse_existing_shelves);
+
+    std::cout << "✅ All atlas packer tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file test_component_reflection.cpp
+ * @brief Unit tests for component reflection, binary serialization and deltas
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "ECS/EntityManager.h"
+#include "ECS/Reflection.h"
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+
+// Simple test framework
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+    std::cout << "Running " #name "... "; \
+    test_##name(); \
+    std::cout << "PASSED" << std::endl; \
+} while(0)
+
+#define ASSERT_TRUE(condition) do { \
+    if (!(condition)) { \
+        std::cerr << "ASSERTION FAILED: " #condition << " at line " << __LINE__ << std::endl; \
+        exit(1); \
+    } \
+} while(0)
+
+#define ASSERT_FALSE(condition) ASSERT_TRUE(!(condition))
+
+TEST(field_metadata_matches_layout) {
+    const TypeInfo& info = GetTypeInfo<TransformComponent>();
+    ASSERT_TRUE(std::string(info.name) == "TransformComponent");
+    ASSERT_TRUE(info.fields.size() == 5);
+
+    const FieldInfo* y = info.FindField("y");
+    ASSERT_TRUE(y != nullptr);
+    ASSERT_TRUE(y->type == FieldType::FLOAT);
+    TransformComponent sample;
+    ASSERT_TRUE(reinterpret_cast<unsigned char*>(&sample) + y->offset ==
+                reinterpret_cast<unsigned char*>(&sample.y));
+
+    // Five adjacent floats collapse into a single memcpy range
+    ASSERT_TRUE(info.podRuns.size() == 1);
+    ASSERT_TRUE(info.podRuns[0].size == 5 * sizeof(float));
+    ASSERT_TRUE(info.dynamicFields.empty());
+}
+
+TEST(round_trip_with_strings_and_vectors) {
+    AbilityComponent source;
+    source.AddAbility("Fireball", 3.0f, 20.0f, 0.0f, 45.0f, 200.0f);
+    source.AddAbility("Dash", 1.5f, 0.0f, 10.0f);
+    source.abilities[1].currentCooldown = 0.75f;
+
+    std::vector<std::uint8_t> buffer;
+    Reflection::Serialize(source, buffer);
+
+    AbilityComponent copy;
+    const std::uint8_t* cursor = buffer.data();
+    ASSERT_TRUE(Reflection::Deserialize(copy, cursor, buffer.data() + buffer.size()));
+    ASSERT_TRUE(cursor == buffer.data() + buffer.size());
+    ASSERT_TRUE(copy.abilities.size() == 2);
+    ASSERT_TRUE(copy.abilities[0].name == "Fireball");
+    ASSERT_TRUE(copy.abilities[0].damage == 45.0f);
+    ASSERT_TRUE(copy.abilities[1].currentCooldown == 0.75f);
+
+    // Truncated input is rejected rather than read past the end
+    const std::uint8_t* shortCursor = buffer.data();
+    ASSERT_FALSE(Reflection::Deserialize(copy, shortCursor, buffer.data() + buffer.size() - 1));
+}
+
+TEST(transient_fields_are_not_serialized) {
+    AudioComponent playing("jump", 0.5f);
+    playing.currentChannel = 7;
+
+    std::vector<std::uint8_t> buffer;
+    Reflection::Serialize(playing, buffer);
+
+    AudioComponent loaded;
+    const std::uint8_t* cursor = buffer.data();
+    ASSERT_TRUE(Reflection::Deserialize(loaded, cursor, buffer.data() + buffer.size()));
+    ASSERT_TRUE(loaded.soundName == "jump");
+    ASSERT_TRUE(loaded.volume == 0.5f);
+    ASSERT_TRUE(loaded.currentChannel == -1);
+}
+
+TEST(delta_contains_only_changed_fields) {
+    const TypeInfo& info = GetTypeInfo<CharacterTypeComponent>();
+    CharacterTypeComponent baseline;
+    CharacterTypeComponent current;
+
+    std::vector<std::uint8_t> unchanged;
+    ASSERT_FALSE(Reflection::SerializeDelta(info, &baseline, &current, unchanged));
+    ASSERT_TRUE(unchanged.size() == sizeof(std::uint64_t));
+
+    current.name = "Goblin";
+    current.type = CharacterTypeComponent::CharacterType::ENEMY;
+
+    std::vector<std::uint8_t> delta;
+    ASSERT_TRUE(Reflection::SerializeDelta(info, &baseline, &current, delta));
+
+    CharacterTypeComponent replica;
+    const std::uint8_t* cursor = delta.data();
+    ASSERT_TRUE(Reflection::ApplyDelta(info, &replica, cursor, delta.data() + delta.size()));
+    ASSERT_TRUE(replica.name == "Goblin");
+    ASSERT_TRUE(replica.type == CharacterTypeComponent::CharacterType::ENEMY);
+    ASSERT_TRUE(replica.characterClass == baseline.characterClass);
+}
+
+TEST(registry_finds_components_by_id) {
+    EntityManager manager;
+    Entity entity = manager.CreateEntity();
+    manager.AddComponent<HealthComponent>(entity)->currentHealth = 42.0f;
+
+    ComponentTypeID typeID = GetComponentTypeID<HealthComponent>();
+    const TypeInfo* info = Reflection::FindComponentType(typeID);
+    ASSERT_TRUE(info != nullptr);
+    ASSERT_TRUE(info->isComponent);
+
+    const Component* component = manager.GetComponent(entity, typeID);
+    ASSERT_TRUE(component != nullptr);
+    const FieldInfo* field = info->FindField("currentHealth");
+    ASSERT_TRUE(Reflection::FormatField(*field, info->fromBase(component)) == "42.00");
+}
+
+int main() {
+    std::cout << "🧪 COMPONENT REFLECTION TESTS" << std::endl;
+    std::cout << "=============================" << std::endl;
+
+    RUN_TEST(field_metadata_matches_layout);
+    RUN_TEST(round_trip_with_strings_and_vectors);
+    RUN_TEST(transient_fields_are_not_serialized);
+    RUN_TEST(delta_contains_only_changed_fields);
+    RUN_TEST(registry_finds_components_by_id);
+
+    std::cout << "✅ All component reflection tests passed!" << std::endl;
+    return 0;
+}
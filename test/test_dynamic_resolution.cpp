@@ -0,0 +1,114 @@
+/**
+ * @file test_dynamic_resolution.cpp
+ * @brief Unit tests for the frame-time driven render scale controller
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "Engine/DynamicResolution.h"
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+
+// Simple test framework
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+    std::cout << "Running " #name "... "; \
+    test_##name(); \
+    std::cout << "PASSED" << std::endl; \
+} while(0)
+
+#define ASSERT_TRUE(condition) do { \
+    if (!(condition)) { \
+        std::cerr << "ASSERTION FAILED: " #condition << " at line " << __LINE__ << std::endl; \
+        exit(1); \
+    } \
+} while(0)
+
+#define ASSERT_FALSE(condition) ASSERT_TRUE(!(condition))
+#define ASSERT_NEAR(a, b) ASSERT_TRUE(std::fabs((a) - (b)) < 1e-4f)
+
+namespace {
+
+DynamicResolution::Settings MakeSettings() {
+    DynamicResolution::Settings settings;
+    settings.enabled = true;
+    settings.minScale = 0.5f;
+    settings.maxScale = 1.0f;
+    settings.step = 0.1f;
+    settings.targetFrameMs = 10.0f;
+    settings.dropThreshold = 0.9f;
+    settings.raiseThreshold = 0.6f;
+    return settings;
+}
+
+float Feed(DynamicResolution& controller, float busyMs, int frames) {
+    float scale = controller.GetScale();
+    for (int i = 0; i < frames; ++i) {
+        scale = controller.Update(busyMs);
+    }
+    return scale;
+}
+
+} // namespace
+
+TEST(slow_frames_lower_the_scale_down_to_the_minimum) {
+    DynamicResolution controller;
+    controller.Configure(MakeSettings());
+    ASSERT_NEAR(controller.GetScale(), 1.0f);
+
+    // One decision per full window
+    ASSERT_NEAR(Feed(controller, 15.0f, DynamicResolution::WINDOW - 1), 1.0f);
+    ASSERT_NEAR(Feed(controller, 15.0f, 1), 0.9f);
+
+    ASSERT_NEAR(Feed(controller, 15.0f, DynamicResolution::WINDOW * 20), 0.5f);
+}
+
+TEST(scale_holds_between_thresholds_and_recovers_when_fast) {
+    DynamicResolution controller;
+    controller.Configure(MakeSettings());
+    Feed(controller, 15.0f, DynamicResolution::WINDOW * 2);
+    ASSERT_NEAR(controller.GetScale(), 0.8f);
+
+    // 75% of the budget is inside the hysteresis band: no change
+    ASSERT_NEAR(Feed(controller, 7.5f, DynamicResolution::WINDOW * 10), 0.8f);
+
+    // A single slow frame in an otherwise light window does not drop the scale
+    Feed(controller, 5.0f, DynamicResolution::WINDOW - 1);
+    ASSERT_NEAR(Feed(controller, 20.0f, 1), 0.9f);
+
+    ASSERT_NEAR(Feed(controller, 3.0f, DynamicResolution::WINDOW * 10), 1.0f);
+}
+
+TEST(disabled_controller_keeps_full_scale) {
+    DynamicResolution controller;
+    DynamicResolution::Settings settings = MakeSettings();
+    settings.enabled = false;
+    controller.Configure(settings);
+    ASSERT_FALSE(controller.IsEnabled());
+    ASSERT_NEAR(Feed(controller, 100.0f, DynamicResolution::WINDOW * 5), 1.0f);
+}
+
+TEST(settings_are_clamped) {
+    DynamicResolution controller;
+    DynamicResolution::Settings settings = MakeSettings();
+    settings.minScale = 2.0f;
+    settings.maxScale = 3.0f;
+    controller.Configure(settings);
+    ASSERT_NEAR(controller.GetSettings().maxScale, 1.0f);
+    ASSERT_NEAR(controller.GetSettings().minScale, 1.0f);
+    ASSERT_NEAR(Feed(controller, 100.0f, DynamicResolution::WINDOW * 5), 1.0f);
+}
+
+int main() {
+    std::cout << "📐 DYNAMIC RESOLUTION TESTS" << std::endl;
+    std::cout << "===========================" << std::endl;
+
+    RUN_TEST(slow_frames_lower_the_scale_down_to_the_minimum);
+    RUN_TEST(scale_holds_between_thresholds_and_recovers_when_fast);
+    RUN_TEST(disabled_controller_keeps_full_scale);
+    RUN_TEST(settings_are_clamped);
+
+    std::cout << "✅ All dynamic resolution tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,943 @@
+/**
+ * @file test_ecs_core.cpp
+ * @brief Unit tests for core ECS bookkeeping (entities, signatures, system membership, observers, pipelines)
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "ECS/EntityManager.h"
+#include "ECS/SparseSet.h"
+#include "ECS/MovementSystem.h"
+#include "ECS/CollisionSystem.h"
+#include "ECS/BallisticSystem.h"
+#include "ECS/PhysicsSystem.h"
+#include "ECS/ProjectileSystem.h"
+#include "ECS/SteeringSystem.h"
+#include "ECS/InfluenceSystem.h"
+#include "ECS/SystemPipeline.h"
+#include "Game/LevelStats.h"
+#include <iostream>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+// Simple test framework
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+    std::cout << "Running " #name "... "; \
+    test_##name(); \
+    std::cout << "PASSED" << std::endl; \
+} while(0)
+
+#define ASSERT_TRUE(condition) do { \
+    if (!(condition)) { \
+        std::cerr << "ASSERTION FAILED: " #condition << " at line " << __LINE__ << std::endl; \
+        exit(1); \
+    } \
+} while(0)
+
+#define ASSERT_FALSE(condition) ASSERT_TRUE(!(condition))
+
+/// Records membership callbacks so tests can check when they fire
+class RecordingSystem : public System {
+public:
+    RecordingSystem() { Require<TransformComponent, VelocityComponent>(); }
+
+    void Update(float) override {}
+    void OnEntityAdded(Entity entity) override { added.push_back(entity); }
+    void OnEntityRemoved(Entity entity) override {
+        removed.push_back(entity);
+        // Components must still be readable during removal
+        sawVelocityOnRemove = m_entityManager->GetComponent<VelocityComponent>(entity) != nullptr;
+    }
+
+    std::vector<Entity> added;
+    std::vector<Entity> removed;
+    bool sawVelocityOnRemove = false;
+};
+
+TEST(component_type_ids_are_unique) {
+    ASSERT_TRUE(GetComponentTypeID<TransformComponent>() != GetComponentTypeID<VelocityComponent>());
+    ASSERT_TRUE(GetComponentTypeID<TransformComponent>() == GetComponentTypeID<TransformComponent>());
+    ASSERT_TRUE(GetComponentTypeID<HealthComponent>() < MAX_COMPONENT_TYPES);
+}
+
+TEST(sparse_set_insert_erase) {
+    SparseSet set;
+    ASSERT_TRUE(set.Insert(Entity(3)));
+    ASSERT_TRUE(set.Insert(Entity(7)));
+    ASSERT_TRUE(set.Insert(Entity(11)));
+    ASSERT_FALSE(set.Insert(Entity(7)));
+    ASSERT_FALSE(set.Insert(Entity()));
+    ASSERT_TRUE(set.Size() == 3);
+
+    ASSERT_TRUE(set.Erase(Entity(3)));
+    ASSERT_FALSE(set.Erase(Entity(3)));
+    ASSERT_FALSE(set.Contains(Entity(3)));
+    ASSERT_TRUE(set.Contains(Entity(7)));
+    ASSERT_TRUE(set.Contains(Entity(11)));
+    ASSERT_TRUE(set[set.IndexOf(Entity(11))] == Entity(11));
+    ASSERT_TRUE(set.Size() == 2);
+}
+
+TEST(membership_follows_signature) {
+    EntityManager manager;
+    auto* system = manager.AddSystem<RecordingSystem>();
+
+    Entity entity = manager.CreateEntity();
+    ASSERT_TRUE(system->added.empty()); // Creation alone does not match
+
+    manager.AddComponent<TransformComponent>(entity, 1.0f, 2.0f);
+    ASSERT_TRUE(system->added.empty());
+
+    manager.AddComponent<VelocityComponent>(entity, 3.0f, 4.0f);
+    ASSERT_TRUE(system->added.size() == 1);
+    ASSERT_TRUE(system->GetEntities().Contains(entity));
+
+    // Replacing a component does not re-fire the hook
+    manager.AddComponent<VelocityComponent>(entity, 5.0f, 6.0f);
+    ASSERT_TRUE(system->added.size() == 1);
+
+    manager.RemoveComponent<VelocityComponent>(entity);
+    ASSERT_TRUE(system->removed.size() == 1);
+    ASSERT_TRUE(system->sawVelocityOnRemove);
+    ASSERT_FALSE(system->GetEntities().Contains(entity));
+    ASSERT_FALSE(manager.HasComponent<VelocityComponent>(entity));
+}
+
+TEST(destroy_removes_from_systems) {
+    EntityManager manager;
+    auto* system = manager.AddSystem<RecordingSystem>();
+
+    Entity entity = manager.CreateEntity();
+    manager.AddComponent<TransformComponent>(entity);
+    manager.AddComponent<VelocityComponent>(entity);
+
+    manager.DestroyEntity(entity);
+    manager.DestroyEntity(entity); // Duplicate request is harmless
+    ASSERT_TRUE(manager.IsEntityValid(entity)); // Deferred until Update()
+
+    manager.Update(0.0f);
+    ASSERT_FALSE(manager.IsEntityValid(entity));
+    ASSERT_TRUE(system->removed.size() == 1);
+    ASSERT_TRUE(system->sawVelocityOnRemove);
+    ASSERT_TRUE(system->GetEntities().Empty());
+}
+
+TEST(late_system_picks_up_existing_entities) {
+    EntityManager manager;
+    Entity moving = manager.CreateEntity();
+    manager.AddComponent<TransformComponent>(moving, 0.0f, 0.0f);
+    manager.AddComponent<VelocityComponent>(moving, 10.0f, 0.0f);
+    Entity still = manager.CreateEntity();
+    manager.AddComponent<TransformComponent>(still, 0.0f, 0.0f);
+
+    auto* movement = manager.AddSystem<MovementSystem>();
+    ASSERT_TRUE(movement->GetEntities().Size() == 1);
+
+    manager.Update(0.5f);
+    ASSERT_TRUE(manager.GetComponent<TransformComponent>(moving)->x == 5.0f);
+    ASSERT_TRUE(manager.GetEntitiesWith<TransformComponent>().size() == 2);
+    ASSERT_TRUE((manager.GetEntitiesWith<TransformComponent, VelocityComponent>().size() == 1));
+}
+
+TEST(collision_callback_may_change_membership) {
+    EntityManager manager;
+    auto* collision = manager.AddSystem<CollisionSystem>();
+
+    Entity a = manager.CreateEntity();
+    manager.AddComponent<TransformComponent>(a, 0.0f, 0.0f);
+    manager.AddComponent<CollisionComponent>(a, 32.0f, 32.0f);
+    Entity b = manager.CreateEntity();
+    manager.AddComponent<TransformComponent>(b, 8.0f, 8.0f);
+    manager.AddComponent<CollisionComponent>(b, 32.0f, 32.0f);
+
+    int hits = 0;
+    collision->SetCollisionCallback([&](const CollisionInfo& info) {
+        ++hits;
+        manager.RemoveComponent<CollisionComponent>(info.entityB);
+    });
+
+    manager.Update(0.016f);
+    ASSERT_TRUE(hits == 1);
+    ASSERT_TRUE(collision->GetEntities().Size() == 1);
+}
+
+TEST(observers_fire_only_for_their_type) {
+    EntityManager manager;
+    int healthAdded = 0, healthRemoved = 0, healthChanged = 0, transformAdded = 0;
+    bool healthReadableOnRemove = false;
+
+    manager.OnAdd<HealthComponent>([&](Entity) { ++healthAdded; });
+    manager.OnRemove<HealthComponent>([&](Entity e) {
+        ++healthRemoved;
+        healthReadableOnRemove = manager.GetComponent<HealthComponent>(e) != nullptr;
+    });
+    manager.OnChange<HealthComponent>([&](Entity) { ++healthChanged; });
+    ObserverID transformObserver = manager.OnAdd<TransformComponent>([&](Entity) { ++transformAdded; });
+
+    Entity entity = manager.CreateEntity();
+    manager.AddComponent<TransformComponent>(entity);
+    manager.AddComponent<VelocityComponent>(entity);
+    ASSERT_TRUE(healthAdded == 0 && transformAdded == 1);
+
+    manager.AddComponent<HealthComponent>(entity, 50.0f);
+    ASSERT_TRUE(healthAdded == 1);
+
+    manager.AddComponent<HealthComponent>(entity, 75.0f); // Replacement
+    manager.MarkChanged<HealthComponent>(entity);
+    ASSERT_TRUE(healthAdded == 1 && healthChanged == 2);
+
+    manager.RemoveObserver(transformObserver);
+    Entity other = manager.CreateEntity();
+    manager.AddComponent<TransformComponent>(other);
+    ASSERT_TRUE(transformAdded == 1);
+
+    manager.DestroyEntity(entity);
+    manager.Update(0.0f);
+    ASSERT_TRUE(healthRemoved == 1);
+    ASSERT_TRUE(healthReadableOnRemove);
+}
+
+TEST(deferred_observers_wait_for_sync_point) {
+    EntityManager manager;
+    std::vector<Entity> seen;
+    manager.OnAdd<HealthComponent>([&](Entity e) { seen.push_back(e); }, ObserverDelivery::DEFERRED);
+
+    Entity a = manager.CreateEntity();
+    Entity b = manager.CreateEntity();
+    manager.AddComponent<HealthComponent>(a);
+    manager.AddComponent<HealthComponent>(b);
+    ASSERT_TRUE(seen.empty());
+
+    manager.Update(0.0f);
+    ASSERT_TRUE(seen.size() == 2);
+    ASSERT_TRUE(seen[0] == a && seen[1] == b);
+}
+
+TEST(observer_can_register_and_remove_observers) {
+    EntityManager manager;
+    int inner = 0;
+    ObserverID self = 0;
+    self = manager.OnAdd<HealthComponent>([&](Entity) {
+        manager.OnAdd<HealthComponent>([&](Entity) { ++inner; });
+        manager.RemoveObserver(self);
+    });
+
+    Entity a = manager.CreateEntity();
+    manager.AddComponent<HealthComponent>(a);
+    ASSERT_TRUE(inner == 0); // Staged observer does not see the event that created it
+
+    Entity b = manager.CreateEntity();
+    manager.AddComponent<HealthComponent>(b);
+    ASSERT_TRUE(inner == 1); // Original observer removed itself
+}
+
+/// Queries and writes Velocity only (no overlap with InfluenceSystem)
+class DragSystem : public System {
+public:
+    using Required = ComponentList<VelocityComponent>;
+    using Reads = ComponentList<>;
+    using Writes = ComponentList<VelocityComponent>;
+
+    DragSystem() { Require(Required{}); }
+    void Update(float) override { ++updates; }
+    int updates = 0;
+};
+
+using TestPipeline = SystemPipeline<MovementSystem, DragSystem, CollisionSystem>;
+
+// Movement writes Transform and reads Velocity (its query), which Drag
+// writes -> new stage; Collision's callback may write anything -> new stage
+static_assert(SystemsConflict<MovementSystem, DragSystem>(), "Velocity query read/write");
+static_assert(SystemsConflict<MovementSystem, InfluenceSystem>(), "Transform write/query read");
+static_assert(!SystemsConflict<InfluenceSystem, DragSystem>(), "Disjoint access");
+static_assert(!SystemsConflict<InfluenceSystem, InfluenceSystem>(), "Read-only never conflicts");
+static_assert(SystemsConflict<CollisionSystem, DragSystem>(), "Callbacks write anything");
+static_assert(SystemsConflict<CollisionSystem, CollisionSystem>(), "Callbacks write anything");
+static_assert(SystemsConflict<BallisticSystem, MovementSystem>(), "DormantTag changes are writes");
+static_assert(SystemsConflict<PhysicsSystem, PhysicsSystem>(), "SleepingTag changes are writes");
+static_assert(TestPipeline::IndexOf<CollisionSystem>() == 2, "Compile-time index");
+static_assert(TestPipeline::GetStage(0) == 0 && TestPipeline::GetStage(1) == 1 && TestPipeline::GetStage(2) == 2, "Stages");
+static_assert(TestPipeline::STAGE_COUNT == 3, "Stage count");
+
+TEST(static_pipeline_tracks_membership) {
+    EntityManager manager;
+    Entity early = manager.CreateEntity();
+    manager.AddComponent<TransformComponent>(early, 0.0f, 0.0f);
+    manager.AddComponent<VelocityComponent>(early, 2.0f, 0.0f);
+
+    {
+        TestPipeline pipeline(manager);
+        ASSERT_TRUE(pipeline.Get<MovementSystem>().GetEntities().Size() == 1);
+
+        Entity late = manager.CreateEntity();
+        manager.AddComponent<VelocityComponent>(late);
+        ASSERT_TRUE(pipeline.Get<DragSystem>().GetEntities().Size() == 2);
+
+        manager.Update(1.0f);
+        pipeline.Update(1.0f);
+        ASSERT_TRUE(pipeline.Get<DragSystem>().updates == 1);
+        ASSERT_TRUE(manager.GetComponent<TransformComponent>(early)->x == 2.0f);
+    }
+
+    // Pipeline detached on destruction; further changes must not touch it
+    Entity after = manager.CreateEntity();
+    manager.AddComponent<VelocityComponent>(after);
+    manager.Update(0.0f);
+}
+
+TEST(tool_queries_report_counts_and_systems) {
+    EntityManager manager;
+    TestPipeline pipeline(manager);
+
+    for (int i = 0; i < 3; ++i) {
+        Entity entity = manager.CreateEntity();
+        manager.AddComponent<TransformComponent>(entity);
+        if (i == 0) {
+            manager.AddComponent<VelocityComponent>(entity);
+        }
+    }
+
+    ASSERT_TRUE(manager.GetComponentCount(GetComponentTypeID<TransformComponent>()) == 3);
+    ASSERT_TRUE(manager.GetComponentCount(GetComponentTypeID<VelocityComponent>()) == 1);
+
+    std::size_t visited = 0;
+    manager.ForEachComponent(GetComponentTypeID<TransformComponent>(), [&](const Component&) { ++visited; });
+    ASSERT_TRUE(visited == 3);
+
+    // Pipeline systems are visible to tools, named, and timed
+    ASSERT_TRUE(manager.GetSystems().size() == 3);
+    ASSERT_TRUE(std::string(manager.GetSystems()[0]->GetName()) == "MovementSystem");
+    pipeline.Update(0.016f);
+    ASSERT_TRUE(pipeline.Get<MovementSystem>().GetLastUpdateMs() >= 0.0f);
+}
+
+TEST(tags_only_set_signature_bits) {
+    EntityManager manager;
+    Entity goblin = manager.CreateEntity();
+    Entity tree = manager.CreateEntity();
+    manager.AddComponent<TransformComponent>(goblin);
+    manager.AddComponent<TransformComponent>(tree);
+    manager.AddTag<EnemyTag>(goblin);
+    manager.AddTag<EnemyTag>(goblin); // No-op
+
+    ASSERT_TRUE(manager.HasComponent<EnemyTag>(goblin));
+    ASSERT_FALSE(manager.HasComponent<EnemyTag>(tree));
+    ASSERT_TRUE((manager.GetEntitiesWith<TransformComponent, EnemyTag>().size() == 1));
+    ASSERT_TRUE(manager.GetComponentCount(GetComponentTypeID<EnemyTag>()) == 1);
+
+    const TypeInfo* info = Reflection::FindComponentType(GetComponentTypeID<EnemyTag>());
+    ASSERT_TRUE(info != nullptr && info->isTag);
+
+    manager.RemoveTag<EnemyTag>(goblin);
+    ASSERT_FALSE(manager.HasComponent<EnemyTag>(goblin));
+    ASSERT_TRUE(manager.GetComponentCount(GetComponentTypeID<EnemyTag>()) == 0);
+}
+
+TEST(shared_components_store_distinct_values_once) {
+    EntityManager manager;
+    CombatStatsComponent grunt;
+    grunt.attackPower = 8.0f;
+    CombatStatsComponent elite;
+    elite.attackPower = 20.0f;
+
+    std::vector<Entity> wave;
+    for (int i = 0; i < 100; ++i) {
+        Entity entity = manager.CreateEntity();
+        manager.SetShared(entity, i % 10 == 0 ? elite : grunt);
+        wave.push_back(entity);
+    }
+
+    ComponentTypeID typeID = GetComponentTypeID<Shared<CombatStatsComponent>>();
+    const SharedComponentPoolBase* pool = manager.GetSharedPool(typeID);
+    ASSERT_TRUE(pool != nullptr);
+    ASSERT_TRUE(pool->GetValueCount() == 2);
+    ASSERT_TRUE(manager.GetComponentCount(typeID) == 100);
+    ASSERT_TRUE(manager.GetShared<CombatStatsComponent>(wave[1]) == manager.GetShared<CombatStatsComponent>(wave[2]));
+
+    // Reads fall back to the shared value; an entity's own component wins
+    ASSERT_TRUE(manager.ReadComponent<CombatStatsComponent>(wave[0])->attackPower == 20.0f);
+    manager.AddComponent<CombatStatsComponent>(wave[1])->attackPower = 3.0f;
+    ASSERT_TRUE(manager.ReadComponent<CombatStatsComponent>(wave[1])->attackPower == 3.0f);
+
+    // Moving every elite to the grunt value frees the elite entry
+    for (int i = 0; i < 100; i += 10) {
+        manager.SetShared(wave[i], grunt);
+    }
+    ASSERT_TRUE(pool->GetValueCount() == 1);
+
+    manager.RemoveShared<CombatStatsComponent>(wave[1]);
+    ASSERT_FALSE(manager.HasComponent<Shared<CombatStatsComponent>>(wave[1]));
+    for (Entity entity : wave) {
+        manager.DestroyEntity(entity);
+    }
+    manager.Update(0.0f);
+    ASSERT_TRUE(pool->GetValueCount() == 0);
+    ASSERT_TRUE(pool->GetReferenceCount() == 0);
+}
+
+TEST(value_index_tracks_field_changes) {
+    using Type = CharacterTypeComponent::CharacterType;
+    using Class = CharacterTypeComponent::CharacterClass;
+    EntityManager manager;
+
+    Entity hero = manager.CreateEntity();
+    Entity goblin = manager.CreateEntity();
+    manager.AddComponent<CharacterTypeComponent>(hero, Type::PLAYER, Class::WARRIOR, "Hero");
+    manager.AddComponent<CharacterTypeComponent>(goblin, Type::ENEMY, Class::MONSTER, "Goblin");
+
+    // Built from existing components on the first query
+    const SparseSet& enemies = manager.GetEntitiesWithValue(&CharacterTypeComponent::type, Type::ENEMY);
+    ASSERT_TRUE(enemies.Size() == 1 && enemies.Contains(goblin));
+    ASSERT_TRUE(manager.GetEntitiesWithValue(&CharacterTypeComponent::type, Type::BOSS).Empty());
+
+    // Kept current by add, in-place change, replacement and destruction
+    Entity ogre = manager.CreateEntity();
+    manager.AddComponent<CharacterTypeComponent>(ogre, Type::ENEMY, Class::MONSTER, "Ogre");
+    ASSERT_TRUE(enemies.Size() == 2);
+
+    manager.GetComponent<CharacterTypeComponent>(ogre)->type = Type::BOSS;
+    manager.MarkChanged<CharacterTypeComponent>(ogre);
+    ASSERT_FALSE(enemies.Contains(ogre));
+    ASSERT_TRUE(manager.GetEntitiesWithValue(&CharacterTypeComponent::type, Type::BOSS).Contains(ogre));
+
+    manager.AddComponent<CharacterTypeComponent>(hero, Type::ENEMY, Class::ROGUE, "Traitor");
+    ASSERT_TRUE(enemies.Contains(hero));
+    ASSERT_TRUE(manager.GetEntitiesWithValue(&CharacterTypeComponent::type, Type::PLAYER).Empty());
+
+    manager.DestroyEntity(goblin);
+    manager.Update(0.0f);
+    ASSERT_TRUE(enemies.Size() == 1 && enemies.Contains(hero));
+}
+
+TEST(relations_are_cleaned_up_with_their_target) {
+    EntityManager manager;
+    Entity player = manager.CreateEntity();
+    Entity goblin = manager.CreateEntity();
+    Entity ogre = manager.CreateEntity();
+    Entity sword = manager.CreateEntity();
+
+    manager.SetRelation(goblin, Relation::TARGETS, player);
+    manager.SetRelation(ogre, Relation::TARGETS, player);
+    manager.SetRelation(sword, Relation::OWNED_BY, goblin);
+    ASSERT_TRUE(manager.GetRelation(goblin, Relation::TARGETS) == player);
+    ASSERT_TRUE(manager.GetRelationSources(Relation::TARGETS, player).size() == 2);
+    ASSERT_TRUE(manager.GetRelationSources(Relation::OWNED_BY, player).empty());
+
+    // Re-targeting moves the source between reverse lists
+    manager.SetRelation(ogre, Relation::TARGETS, goblin);
+    ASSERT_TRUE(manager.GetRelationSources(Relation::TARGETS, player).size() == 1);
+    ASSERT_TRUE(manager.GetRelationSources(Relation::TARGETS, goblin).size() == 1);
+
+    // Destroying the goblin drops its own links and every link to it
+    manager.DestroyEntity(goblin);
+    manager.Update(0.0f);
+    ASSERT_TRUE(manager.GetRelationSources(Relation::TARGETS, player).empty());
+    ASSERT_FALSE(manager.GetRelation(ogre, Relation::TARGETS).IsValid());
+    ASSERT_FALSE(manager.GetRelation(sword, Relation::OWNED_BY).IsValid());
+
+    manager.RemoveRelation(ogre, Relation::TARGETS); // No link left: harmless
+}
+
+TEST(level_stats_follow_observers) {
+    EntityManager manager;
+    Entity early = manager.CreateEntity();
+    manager.AddTag<EnemyTag>(early);
+    manager.AddComponent<HealthComponent>(early, 40.0f);
+
+    LevelStats stats;
+    stats.Attach(manager); // Counts entities that already exist
+    ASSERT_TRUE(stats.GetAliveEnemies() == 1);
+    ASSERT_TRUE(stats.GetTotalEnemyHealth() == 40.0f);
+
+    Entity boss = manager.CreateEntity();
+    manager.AddComponent<HealthComponent>(boss, 200.0f);
+    manager.AddTag<EnemyTag>(boss);
+    manager.AddTag<BossTag>(boss);
+    ASSERT_TRUE(stats.GetAliveEnemies() == 2);
+    ASSERT_TRUE(stats.IsBossAlive());
+    ASSERT_TRUE(stats.GetTotalEnemyMaxHealth() == 240.0f);
+
+    // In-place damage is picked up through MarkChanged
+    auto* health = manager.GetComponent<HealthComponent>(boss);
+    health->currentHealth = 150.0f;
+    manager.MarkChanged<HealthComponent>(boss);
+    ASSERT_TRUE(stats.GetTotalEnemyHealth() == 190.0f);
+
+    health->isDead = true;
+    manager.MarkChanged<HealthComponent>(boss);
+    ASSERT_FALSE(stats.IsBossAlive());
+    ASSERT_TRUE(stats.GetAliveEnemies() == 1);
+
+    manager.DestroyEntity(boss);
+    manager.DestroyEntity(early);
+    manager.Update(0.0f);
+    ASSERT_TRUE(stats.GetAliveEnemies() == 0);
+    ASSERT_TRUE(stats.GetTotalEnemyHealth() == 0.0f);
+}
+
+TEST(sort_by_position_keeps_handles_and_follows_morton_order) {
+    EntityManager manager;
+    auto* recorder = manager.AddSystem<RecordingSystem>();
+
+    // Spawn in reverse Z-order: cells (3,3), (0,3), (3,0), (0,0) at 32px
+    const float positions[4][2] = {{96, 96}, {0, 96}, {96, 0}, {0, 0}};
+    std::vector<Entity> entities;
+    for (const auto& position : positions) {
+        Entity entity = manager.CreateEntity();
+        manager.AddComponent<TransformComponent>(entity, position[0], position[1]);
+        manager.AddComponent<VelocityComponent>(entity, position[0], 0.0f);
+        entities.push_back(entity);
+    }
+    Entity unplaced = manager.CreateEntity();
+    manager.AddComponent<VelocityComponent>(unplaced, -1.0f, 0.0f);
+
+    manager.SortByPosition<TransformComponent, VelocityComponent>(32.0f);
+
+    // Handles still reach their own data
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        ASSERT_TRUE(manager.GetComponent<TransformComponent>(entities[i])->x == positions[i][0]);
+        ASSERT_TRUE(manager.GetComponent<TransformComponent>(entities[i])->y == positions[i][1]);
+        ASSERT_TRUE(manager.GetComponent<VelocityComponent>(entities[i])->vx == positions[i][0]);
+    }
+    ASSERT_TRUE(manager.GetComponent<VelocityComponent>(unplaced)->vx == -1.0f);
+
+    // Storage and system iteration follow the curve; no transform sorts last
+    std::vector<float> ys;
+    manager.ForEachComponent(GetComponentTypeID<TransformComponent>(), [&](const Component& c) {
+        ys.push_back(static_cast<const TransformComponent&>(c).y);
+    });
+    ASSERT_TRUE((ys == std::vector<float>{0, 0, 96, 96}));
+    std::vector<float> vxs;
+    manager.ForEachComponent(GetComponentTypeID<VelocityComponent>(), [&](const Component& c) {
+        vxs.push_back(static_cast<const VelocityComponent&>(c).vx);
+    });
+    ASSERT_TRUE((vxs == std::vector<float>{0, 96, 0, 96, -1}));
+    ASSERT_TRUE(recorder->GetEntities()[0] == entities[3]);
+    ASSERT_TRUE(recorder->GetEntities()[3] == entities[0]);
+
+    // Swap-pop removal after a sort keeps the remaining data attached
+    manager.RemoveComponent<TransformComponent>(entities[3]);
+    ASSERT_TRUE(manager.GetComponent<TransformComponent>(entities[3]) == nullptr);
+    ASSERT_TRUE(manager.GetComponent<TransformComponent>(entities[0])->x == 96.0f);
+    ASSERT_TRUE(manager.GetComponent<TransformComponent>(entities[1])->y == 96.0f);
+    ASSERT_TRUE(manager.GetComponentCount(GetComponentTypeID<TransformComponent>()) == 3);
+}
+
+TEST(compact_storage_releases_capacity_after_churn) {
+    EntityManager manager;
+    manager.AddSystem<MovementSystem>();
+
+    std::vector<Entity> entities;
+    for (int i = 0; i < 2000; ++i) {
+        Entity entity = manager.CreateEntity();
+        manager.AddComponent<TransformComponent>(entity, static_cast<float>(i), 0.0f);
+        manager.AddComponent<VelocityComponent>(entity, 1.0f, 0.0f);
+        entities.push_back(entity);
+    }
+    // Destroy all but the first 10 (so the sparse index can shrink too)
+    for (std::size_t i = 10; i < entities.size(); ++i) {
+        manager.DestroyEntity(entities[i]);
+    }
+    manager.Update(0.0f);
+
+    StorageStats before = manager.GetStorageStats();
+    ASSERT_TRUE(before.liveComponents == 20);
+    ASSERT_TRUE(before.slotCapacity >= 4000);
+
+    // A zero budget still makes progress, one target per call
+    int calls = 1;
+    while (!manager.CompactStorage(0.0f)) {
+        ++calls;
+    }
+    ASSERT_TRUE(calls > 1);
+
+    StorageStats after = manager.GetStorageStats();
+    ASSERT_TRUE(after.liveComponents == 20);
+    ASSERT_TRUE(after.reservedBytes < before.reservedBytes / 4);
+    ASSERT_TRUE(after.GetFragmentation() < before.GetFragmentation());
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(manager.GetComponent<TransformComponent>(entities[i])->x == static_cast<float>(i));
+    }
+
+    // Storage grows again as normal
+    Entity late = manager.CreateEntity();
+    manager.AddComponent<TransformComponent>(late, 5.0f, 5.0f);
+    ASSERT_TRUE(manager.GetComponent<TransformComponent>(late)->y == 5.0f);
+    ASSERT_TRUE(manager.GetComponent<TransformComponent>(entities[9])->x == 9.0f);
+}
+
+TEST(ballistic_entities_go_dormant_outside_active_region) {
+    EntityManager manager;
+    auto* ballistic = manager.AddSystem<BallisticSystem>();
+    auto* movement = manager.AddSystem<MovementSystem>();
+    auto* collision = manager.AddSystem<CollisionSystem>();
+    ballistic->SetActiveRegion(-50.0f, -50.0f, 50.0f, 50.0f);
+
+    Entity mover = manager.CreateEntity();
+    manager.AddComponent<TransformComponent>(mover, 200.0f, 0.0f);
+    manager.AddComponent<VelocityComponent>(mover, -10.0f, 0.0f);
+    manager.AddComponent<CollisionComponent>(mover, 8.0f, 8.0f);
+    manager.AddComponent<BallisticComponent>(mover);
+
+    // Outside the region: parked, and neither moved nor collision-tested
+    manager.Update(1.0f);
+    ASSERT_TRUE(manager.HasComponent<DormantTag>(mover));
+    ASSERT_TRUE(movement->GetEntities().Empty());
+    ASSERT_TRUE(collision->GetEntities().Empty());
+    ASSERT_TRUE(manager.GetComponent<TransformComponent>(mover)->x == 200.0f);
+
+    // Queries see the closed-form position while the transform is untouched
+    for (int i = 0; i < 9; ++i) {
+        manager.Update(1.0f);
+    }
+    float x = 0.0f;
+    float y = 0.0f;
+    ASSERT_TRUE(ballistic->GetPosition(mover, x, y));
+    ASSERT_TRUE(x == 100.0f && y == 0.0f);
+    ASSERT_TRUE(manager.GetComponent<TransformComponent>(mover)->x == 200.0f);
+
+    // Entering the region wakes it with the same trajectory integration gives
+    for (int i = 0; i < 6; ++i) {
+        manager.Update(1.0f);
+    }
+    ASSERT_FALSE(manager.HasComponent<DormantTag>(mover));
+    ASSERT_TRUE(movement->GetEntities().Contains(mover));
+    ASSERT_TRUE(collision->GetEntities().Contains(mover));
+    ASSERT_TRUE(manager.GetComponent<TransformComponent>(mover)->x == 40.0f);
+}
+
+TEST(physics_islands_sleep_and_wake_on_impact) {
+    EntityManager manager;
+    auto* physics = manager.AddSystem<PhysicsSystem>();
+
+    auto addBody = [&](float x, float y, float width, float height, float mass) {
+        Entity entity = manager.CreateEntity();
+        manager.AddComponent<TransformComponent>(entity, x, y);
+        manager.AddComponent<VelocityComponent>(entity);
+        manager.AddComponent<CollisionComponent>(entity, width, height);
+        manager.AddComponent<RigidBodyComponent>(entity, mass);
+        return entity;
+    };
+    auto step = [&](float seconds) {
+        for (int frame = 0; frame < static_cast<int>(seconds * 60.0f); ++frame) {
+            manager.Update(1.0f / 60.0f);
+        }
+    };
+
+    Entity floor = addBody(0.0f, 200.0f, 400.0f, 20.0f, 0.0f);
+    Entity lower = addBody(100.0f, 100.0f, 20.0f, 20.0f, 1.0f);
+
+    // Falls, comes to rest on the floor and drops out of the system
+    step(3.0f);
+    ASSERT_TRUE(physics->IsSleeping(floor));
+    ASSERT_TRUE(physics->IsSleeping(lower));
+    ASSERT_TRUE(physics->GetEntities().Empty());
+    ASSERT_TRUE(std::abs(manager.GetComponent<TransformComponent>(lower)->y - 180.0f) < 1.0f);
+
+    // A box landing on it wakes it; the pair then sleeps as one island
+    Entity upper = addBody(100.0f, 0.0f, 20.0f, 20.0f, 1.0f);
+    step(1.0f);
+    ASSERT_FALSE(physics->IsSleeping(lower));
+    step(3.0f);
+    ASSERT_TRUE(physics->IsSleeping(lower) && physics->IsSleeping(upper));
+    ASSERT_TRUE(std::abs(manager.GetComponent<TransformComponent>(upper)->y - 160.0f) < 1.5f);
+    ASSERT_TRUE(manager.GetComponent<RigidBodyComponent>(lower)->island ==
+                manager.GetComponent<RigidBodyComponent>(upper)->island);
+
+    // An impulse on the bottom box wakes the whole stack
+    physics->ApplyImpulse(lower, 50.0f, 0.0f);
+    ASSERT_FALSE(physics->IsSleeping(lower));
+    ASSERT_FALSE(physics->IsSleeping(upper));
+    ASSERT_TRUE(physics->IsSleeping(floor));
+    ASSERT_TRUE(manager.GetComponent<VelocityComponent>(lower)->vx == 50.0f);
+}
+
+TEST(collision_masks_ignore_transparent_corners) {
+    // 100 px disc: two words per row, so the wide path and the word carry both run
+    constexpr int SIZE = 100;
+    std::vector<std::uint8_t> alpha(SIZE * SIZE, 0);
+    for (int y = 0; y < SIZE; ++y) {
+        for (int x = 0; x < SIZE; ++x) {
+            float dx = x - 49.5f, dy = y - 49.5f;
+            alpha[y * SIZE + x] = (dx * dx + dy * dy <= 50.0f * 50.0f) ? 255 : 0;
+        }
+    }
+    CollisionMask disc = CollisionMask::FromAlpha(alpha.data(), SIZE, SIZE, SIZE);
+    CollisionMask wedge(70, 70); // Lower-left triangle, so mirroring matters
+    for (int y = 0; y < 70; ++y) {
+        for (int x = 0; x <= y; ++x) {
+            wedge.Set(x, y);
+        }
+    }
+    ASSERT_TRUE(wedge.Test(0, 69) && !wedge.Test(69, 0) && wedge.Test(69, 0, true));
+
+    // Word-shift test agrees with a per-pixel reference at every offset
+    auto reference = [](const CollisionMask& a, int ax, int ay, bool am, const CollisionMask& b, int bx, int by, bool bm) {
+        for (int y = 0; y < a.GetHeight(); ++y) {
+            for (int x = 0; x < a.GetWidth(); ++x) {
+                if (a.Test(x, y, am) && b.Test(ax + x - bx, ay + y - by, bm)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+    for (int dy = -100; dy <= 100; dy += 13) {
+        for (int dx = -110; dx <= 110; dx += 5) {
+            for (bool mirrored : {false, true}) {
+                ASSERT_TRUE(CollisionMask::Overlaps(disc, 0, 0, false, wedge, dx, dy, mirrored) ==
+                            reference(disc, 0, 0, false, wedge, dx, dy, mirrored));
+            }
+        }
+    }
+
+    // In the system: boxes overlapping only at transparent corners don't collide
+    EntityManager manager;
+    auto* collision = manager.AddSystem<CollisionSystem>();
+    auto masks = std::make_shared<std::vector<CollisionMask>>(1, disc);
+    auto addEntity = [&](float x, float y, float size, bool masked) {
+        Entity entity = manager.CreateEntity();
+        manager.AddComponent<TransformComponent>(entity, x, y);
+        manager.AddComponent<CollisionComponent>(entity, size, size);
+        if (masked) {
+            manager.AddComponent<CollisionMaskComponent>(entity, masks);
+        }
+        return entity;
+    };
+    addEntity(0.0f, 0.0f, 100.0f, true);
+    Entity b = addEntity(80.0f, 80.0f, 100.0f, true);
+    addEntity(-5.0f, -5.0f, 12.0f, false);
+
+    int hits = 0;
+    collision->SetCollisionCallback([&](const CollisionInfo&) { ++hits; });
+    manager.Update(0.016f);
+    ASSERT_TRUE(hits == 0);
+
+    manager.GetComponent<TransformComponent>(b)->x = 60.0f;
+    manager.GetComponent<TransformComponent>(b)->y = 60.0f;
+    manager.Update(0.016f);
+    ASSERT_TRUE(hits == 1);
+}
+
+TEST(round_collision_shapes_skip_box_corners) {
+    EntityManager manager;
+    auto* collision = manager.AddSystem<CollisionSystem>();
+    using Shape = CollisionComponent::Shape;
+
+    auto add = [&](float x, float y, float w, float h, Shape shape) {
+        Entity entity = manager.CreateEntity();
+        manager.AddComponent<TransformComponent>(entity, x, y);
+        manager.AddComponent<CollisionComponent>(entity, w, h, shape);
+        return entity;
+    };
+    std::vector<std::pair<EntityID, EntityID>> hits;
+    collision->SetCollisionCallback([&](const CollisionInfo& info) {
+        hits.emplace_back(info.entityA.GetID(), info.entityB.GetID());
+    });
+    auto collided = [&](Entity a, Entity b) {
+        for (const auto& hit : hits) {
+            if ((hit.first == a.GetID() && hit.second == b.GetID()) ||
+                (hit.first == b.GetID() && hit.second == a.GetID())) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // Boxes overlap at the corners; the round shapes inside them don't
+    Entity circle = add(0.0f, 0.0f, 40.0f, 40.0f, Shape::CIRCLE);
+    Entity cornerBox = add(36.0f, 36.0f, 40.0f, 40.0f, Shape::BOX);
+    Entity capsule = add(-30.0f, 30.0f, 40.0f, 80.0f, Shape::CAPSULE);
+    // Side by side, overlapping 10 px through the middle: hits whatever the shapes
+    Entity left = add(200.0f, 0.0f, 40.0f, 40.0f, Shape::CIRCLE);
+    Entity right = add(230.0f, 0.0f, 80.0f, 40.0f, Shape::CAPSULE);
+    Entity box = add(300.0f, 10.0f, 20.0f, 20.0f, Shape::BOX);
+
+    manager.Update(0.016f);
+    ASSERT_FALSE(collided(circle, cornerBox));
+    ASSERT_FALSE(collided(circle, capsule));
+    ASSERT_TRUE(collided(left, right));
+    ASSERT_TRUE(collided(right, box));
+    ASSERT_TRUE(hits.size() == 2);
+
+    // Pushed together diagonally, the circle reaches the box corner
+    manager.GetComponent<TransformComponent>(cornerBox)->x = 32.0f;
+    manager.GetComponent<TransformComponent>(cornerBox)->y = 32.0f;
+    hits.clear();
+    manager.Update(0.016f);
+    ASSERT_TRUE(collided(circle, cornerBox));
+}
+
+TEST(projectiles_sweep_through_thin_targets) {
+    EntityManager manager;
+    EventManager events;
+    auto* projectiles = manager.AddSystem<ProjectileSystem>(4, &events);
+
+    Entity shooter = manager.CreateEntity();
+    manager.AddComponent<TransformComponent>(shooter, 0.0f, 0.0f);
+    manager.AddComponent<CollisionComponent>(shooter, 16.0f, 16.0f);
+    manager.AddTag<PlayerTag>(shooter);
+    // 4 px wall, far thinner than one step of a 6000 units/s bullet
+    Entity wall = manager.CreateEntity();
+    manager.AddComponent<TransformComponent>(wall, 150.0f, -50.0f);
+    manager.AddComponent<CollisionComponent>(wall, 4.0f, 100.0f);
+    manager.AddTag<EnemyTag>(wall);
+
+    std::vector<ProjectileHitEvent> hits;
+    events.Subscribe<ProjectileHitEvent>([&](const ProjectileHitEvent& hit) { hits.push_back(hit); });
+
+    // Fired from inside its owner: passes the shooter, stops at the wall
+    ASSERT_TRUE(projectiles->Spawn(8.0f, 8.0f, 6000.0f, 0.0f, 1.0f, 5.0f, shooter, ProjectileSystem::TARGET_ENEMY));
+    // Player-only bullet flies through the enemy wall and expires
+    ASSERT_TRUE(projectiles->SpawnToward(30.0f, 40.0f, 300.0f, 40.0f, 6000.0f, 250.0f, 1.0f, Entity(),
+                                         ProjectileSystem::TARGET_PLAYER));
+    manager.Update(1.0f / 30.0f);
+    ASSERT_TRUE(hits.size() == 1);
+    ASSERT_TRUE(hits[0].target == wall && hits[0].owner == shooter && hits[0].damage == 5.0f);
+    ASSERT_TRUE(std::abs(hits[0].x - 148.0f) < 0.01f);
+    ASSERT_TRUE(projectiles->GetCount() == 1);
+    manager.Update(1.0f / 30.0f);
+    ASSERT_TRUE(projectiles->GetCount() == 0);
+
+    // Fixed capacity: extra spawns are dropped
+    ASSERT_TRUE(projectiles->SpawnRing(400.0f, 400.0f, 8, 100.0f, 1.0f, 1.0f) == 4);
+    ASSERT_FALSE(projectiles->Spawn(0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f));
+}
+
+TEST(steering_separates_flock_and_seeks_target) {
+    EntityManager manager;
+    auto* steering = manager.AddSystem<SteeringSystem>();
+
+    // Two overlapping agents of one flock push apart; a third flock ignores them
+    auto makeAgent = [&](float x, float y, int flock) {
+        Entity agent = manager.CreateEntity();
+        manager.AddComponent<TransformComponent>(agent, x, y);
+        manager.AddComponent<VelocityComponent>(agent);
+        auto* params = manager.AddComponent<SteeringComponent>(agent, 100.0f, flock);
+        params->cohesionWeight = 0.0f;
+        params->alignmentWeight = 0.0f;
+        return agent;
+    };
+    Entity left = makeAgent(100.0f, 100.0f, 0);
+    Entity right = makeAgent(104.0f, 100.0f, 0);
+    Entity stranger = makeAgent(102.0f, 103.0f, 1);
+    manager.Update(0.1f);
+    ASSERT_TRUE(manager.GetComponent<VelocityComponent>(left)->vx < 0.0f);
+    ASSERT_TRUE(manager.GetComponent<VelocityComponent>(right)->vx > 0.0f);
+    ASSERT_TRUE(manager.GetComponent<VelocityComponent>(stranger)->vx == 0.0f);
+    ASSERT_TRUE(steering->GetNeighborCount() == 2);
+
+    // Seeking an entity: velocity turns toward it, capped at maxSpeed
+    Entity goal = manager.CreateEntity();
+    manager.AddComponent<TransformComponent>(goal, 2000.0f, 100.0f);
+    auto* params = manager.GetComponent<SteeringComponent>(stranger);
+    params->seekTarget = goal;
+    params->seekWeight = 1.0f;
+    for (int i = 0; i < 20; ++i) {
+        manager.Update(0.1f);
+    }
+    const auto* velocity = manager.GetComponent<VelocityComponent>(stranger);
+    ASSERT_TRUE(velocity->vx > 80.0f && velocity->vx <= 100.01f);
+
+    // An obstacle ahead and just below deflects the seeker upward
+    steering->AddObstacle(130.0f, 110.0f, 10.0f);
+    manager.Update(0.1f);
+    ASSERT_TRUE(manager.GetComponent<VelocityComponent>(stranger)->vy < -1.0f);
+}
+
+TEST(influence_maps_update_only_dirty_cells) {
+    using Layer = InfluenceSourceComponent::Layer;
+    EntityManager manager;
+    auto* influence = manager.AddSystem<InfluenceSystem>(20, 10, 10.0f);
+
+    Entity player = manager.CreateEntity();
+    manager.AddComponent<TransformComponent>(player, 55.0f, 55.0f);
+    manager.AddComponent<InfluenceSourceComponent>(player, Layer::THREAT, 1.0f, 30.0f);
+    Entity ally = manager.CreateEntity();
+    manager.AddComponent<TransformComponent>(ally, 150.0f, 55.0f);
+    manager.AddComponent<InfluenceSourceComponent>(ally, Layer::ALLIES, 2.0f, 20.0f);
+    manager.Update(0.016f);
+
+    ASSERT_TRUE(std::abs(influence->Sample(Layer::THREAT, 55.0f, 55.0f) - 1.0f) < 1e-5f);
+    ASSERT_TRUE(std::abs(influence->Sample(Layer::THREAT, 65.0f, 55.0f) - 2.0f / 3.0f) < 1e-5f);
+    ASSERT_TRUE(influence->Sample(Layer::THREAT, 85.0f, 55.0f) == 0.0f);
+    ASSERT_TRUE(influence->Sample(Layer::THREAT, 150.0f, 55.0f) == 0.0f);
+    ASSERT_TRUE(std::abs(influence->Sample(Layer::ALLIES, 150.0f, 55.0f) - 2.0f) < 1e-5f);
+
+    // Standing still or moving inside a cell touches nothing
+    manager.GetComponent<TransformComponent>(player)->x = 58.0f;
+    manager.Update(0.016f);
+    ASSERT_TRUE(influence->GetUpdatedCells() == 0);
+
+    // Crossing cells recomputes only the old and new footprints
+    manager.GetComponent<TransformComponent>(player)->x = 105.0f;
+    manager.Update(0.016f);
+    ASSERT_TRUE(influence->GetUpdatedCells() > 0 && influence->GetUpdatedCells() < 100);
+    ASSERT_TRUE(influence->Sample(Layer::THREAT, 55.0f, 55.0f) == 0.0f);
+    ASSERT_TRUE(std::abs(influence->Sample(Layer::THREAT, 105.0f, 55.0f) - 1.0f) < 1e-5f);
+
+    // Incremental blurred updates match a map built from scratch
+    InfluenceMap& threat = influence->GetMap(Layer::THREAT);
+    threat.SetBlurPasses(2);
+    manager.Update(0.016f);
+    manager.GetComponent<TransformComponent>(player)->x = 125.0f;
+    manager.GetComponent<TransformComponent>(player)->y = 15.0f;
+    manager.Update(0.016f);
+    InfluenceMap fresh(20, 10, 10.0f);
+    fresh.SetBlurPasses(2);
+    fresh.AddSource(125.0f, 15.0f, 1.0f, 30.0f);
+    fresh.Update();
+    for (int i = 0; i < 200; ++i) {
+        ASSERT_TRUE(std::abs(threat.Data()[i] - fresh.Data()[i]) < 1e-5f);
+    }
+
+    // The safest spot near the player is away from it
+    float safeX = 0.0f;
+    float safeY = 0.0f;
+    ASSERT_TRUE(threat.FindExtreme(125.0f, 15.0f, 40.0f, true, safeX, safeY));
+    ASSERT_TRUE(std::abs(safeX - 125.0f) + std::abs(safeY - 15.0f) >= 30.0f);
+
+    // Destroyed sources disappear from the map
+    manager.DestroyEntity(player);
+    manager.Update(0.016f);
+    ASSERT_TRUE(influence->Sample(Layer::THREAT, 125.0f, 15.0f) == 0.0f);
+    ASSERT_TRUE(threat.GetSourceCount() == 0);
+}
+
+int main() {
+    std::cout << "🧪 ECS CORE TESTS" << std::endl;
+    std::cout << "=================" << std::endl;
+
+    RUN_TEST(component_type_ids_are_unique);
+    RUN_TEST(sparse_set_insert_erase);
+    RUN_TEST(membership_follows_signature);
+    RUN_TEST(destroy_removes_from_systems);
+    RUN_TEST(late_system_picks_up_existing_entities);
+    RUN_TEST(collision_callback_may_change_membership);
+    RUN_TEST(observers_fire_only_for_their_type);
+    RUN_TEST(deferred_observers_wait_for_sync_point);
+    RUN_TEST(observer_can_register_and_remove_observers);
+    RUN_TEST(static_pipeline_tracks_membership);
+    RUN_TEST(tool_queries_report_counts_and_systems);
+    RUN_TEST(tags_only_set_signature_bits);
+    RUN_TEST(shared_components_store_distinct_values_once);
+    RUN_TEST(value_index_tracks_field_changes);
+    RUN_TEST(relations_are_cleaned_up_with_their_target);
+    RUN_TEST(level_stats_follow_observers);
+    RUN_TEST(sort_by_position_keeps_handles_and_follows_morton_order);
+    RUN_TEST(compact_storage_releases_capacity_after_churn);
+    RUN_TEST(ballistic_entities_go_dormant_outside_active_region);
+    RUN_TEST(physics_islands_sleep_and_wake_on_impact);
+    RUN_TEST(collision_masks_ignore_transparent_corners);
+    RUN_TEST(round_collision_shapes_skip_box_corners);
+    RUN_TEST(projectiles_sweep_through_thin_targets);
+    RUN_TEST(steering_separates_flock_and_seeks_target);
+    RUN_TEST(influence_maps_update_only_dirty_cells);
+
+    std::cout << "✅ All ECS core tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,188 @@
+/**
+ * @file test_inplace_function.cpp
+ * @brief Unit tests for InplaceFunction copy, move and lifetime handling
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "Engine/InplaceFunction.h"
+#include <iostream>
+#include <cstdlib>
+#include <memory>
+
+// Simple test framework
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+    std::cout << "Running " #name "... "; \
+    test_##name(); \
+    std::cout << "PASSED" << std::endl; \
+} while(0)
+
+#define ASSERT_TRUE(condition) do { \
+    if (!(condition)) { \
+        std::cerr << "ASSERTION FAILED: " #condition << " at line " << __LINE__ << std::endl; \
+        exit(1); \
+    } \
+} while(0)
+
+#define ASSERT_FALSE(condition) ASSERT_TRUE(!(condition))
+
+/// Callable that counts how many instances of it are alive
+struct Counted {
+    static int alive;
+    static int constructed;
+    static int destroyed;
+
+    int value;
+
+    explicit Counted(int v) : value(v) { ++alive; ++constructed; }
+    Counted(const Counted& other) : value(other.value) { ++alive; ++constructed; }
+    Counted(Counted&& other) noexcept : value(other.value) { ++alive; ++constructed; }
+    ~Counted() { --alive; ++destroyed; }
+
+    int operator()(int x) const { return value + x; }
+
+    static void ResetCounts() { alive = 0; constructed = 0; destroyed = 0; }
+};
+
+int Counted::alive = 0;
+int Counted::constructed = 0;
+int Counted::destroyed = 0;
+
+using Function = InplaceFunction<int(int)>;
+
+static int Double(int x) { return x * 2; }
+
+TEST(empty_and_function_pointer) {
+    Function empty;
+    ASSERT_FALSE(empty);
+    ASSERT_TRUE(empty == nullptr);
+
+    int (*none)(int) = nullptr;
+    Function fromNull = none;
+    ASSERT_FALSE(fromNull);
+
+    Function doubler = &Double;
+    ASSERT_TRUE(doubler);
+    ASSERT_TRUE(doubler != nullptr);
+    ASSERT_TRUE(doubler(21) == 42);
+}
+
+TEST(copy_keeps_both_callables) {
+    Counted::ResetCounts();
+    {
+        Function original = Counted(1);
+        ASSERT_TRUE(Counted::alive == 1);
+
+        Function copy = original;
+        ASSERT_TRUE(Counted::alive == 2);
+        ASSERT_TRUE(original(1) == 2);
+        ASSERT_TRUE(copy(1) == 2);
+
+        Function assigned = Counted(5);
+        assigned = copy;
+        ASSERT_TRUE(Counted::alive == 3);
+        ASSERT_TRUE(assigned(0) == 1);
+    }
+    ASSERT_TRUE(Counted::alive == 0);
+}
+
+TEST(move_empties_the_source) {
+    Counted::ResetCounts();
+    {
+        Function original = Counted(3);
+        Function moved = std::move(original);
+        ASSERT_FALSE(original);
+        ASSERT_TRUE(moved(1) == 4);
+        ASSERT_TRUE(Counted::alive == 1);
+
+        Function assigned = Counted(7);
+        assigned = std::move(moved);
+        ASSERT_FALSE(moved);
+        ASSERT_TRUE(assigned(0) == 3);
+        ASSERT_TRUE(Counted::alive == 1);
+
+        // Moving from an empty function leaves the target empty
+        assigned = std::move(moved);
+        ASSERT_FALSE(assigned);
+        ASSERT_TRUE(Counted::alive == 0);
+    }
+    ASSERT_TRUE(Counted::alive == 0);
+}
+
+TEST(self_assignment_keeps_the_callable) {
+    Counted::ResetCounts();
+    {
+        Function function = Counted(2);
+        Function& alias = function;  // Avoids self-assignment warnings
+
+        function = alias;
+        ASSERT_TRUE(function);
+        ASSERT_TRUE(function(0) == 2);
+        ASSERT_TRUE(Counted::alive == 1);
+
+        function = std::move(alias);
+        ASSERT_TRUE(function);
+        ASSERT_TRUE(function(0) == 2);
+        ASSERT_TRUE(Counted::alive == 1);
+    }
+    ASSERT_TRUE(Counted::alive == 0);
+}
+
+TEST(stateful_callable_is_destroyed_exactly_once) {
+    auto state = std::make_shared<int>(0);
+    std::weak_ptr<int> watch = state;
+    {
+        Function counter = [state](int x) { return *state += x; };
+        state.reset();
+        ASSERT_TRUE(counter(2) == 2);
+        ASSERT_TRUE(counter(3) == 5);  // Captured state persists between calls
+        ASSERT_FALSE(watch.expired());
+    }
+    ASSERT_TRUE(watch.expired());
+
+    // Every Counted constructed is destroyed once: no leaks, no double destroys
+    Counted::ResetCounts();
+    {
+        Function a = Counted(1);
+        Function b = a;
+        Function c = std::move(b);
+        c = nullptr;
+        a = std::move(c);  // Moving an empty function destroys a's callable
+    }
+    ASSERT_TRUE(Counted::destroyed == Counted::constructed);
+}
+
+TEST(nullptr_assignment_resets) {
+    Counted::ResetCounts();
+    Function function = Counted(4);
+    ASSERT_TRUE(Counted::alive == 1);
+
+    function = nullptr;
+    ASSERT_FALSE(function);
+    ASSERT_TRUE(function == nullptr);
+    ASSERT_TRUE(Counted::alive == 0);
+
+    // Resetting an empty function is harmless, and it can be reassigned
+    function = nullptr;
+    ASSERT_FALSE(function);
+    function = Counted(9);
+    ASSERT_TRUE(function(1) == 10);
+    function = nullptr;
+    ASSERT_TRUE(Counted::alive == 0);
+}
+
+int main() {
+    std::cout << "🧪 INPLACE FUNCTION TESTS" << std::endl;
+    std::cout << "=========================" << std::endl;
+
+    RUN_TEST(empty_and_function_pointer);
+    RUN_TEST(copy_keeps_both_callables);
+    RUN_TEST(move_empties_the_source);
+    RUN_TEST(self_assignment_keeps_the_callable);
+    RUN_TEST(stateful_callable_is_destroyed_exactly_once);
+    RUN_TEST(nullptr_assignment_resets);
+
+    std::cout << "✅ All inplace function tests passed!" << std::endl;
+    return 0;
+}
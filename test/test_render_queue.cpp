@@ -0,0 +1,132 @@
+/**
+ * @file test_render_queue.cpp
+ * @brief Unit tests for layer/depth ordering in the render queue
+ * @author Ryan Butler
+ * @date 2025
+ */
+
+#include "Engine/RenderQueue.h"
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+
+// Simple test framework
+#define TEST(name) void test_##name()
+#define RUN_TEST(name) do { \
+    std::cout << "Running " #name "... "; \
+    test_##name(); \
+    std::cout << "PASSED" << std::endl; \
+} while(0)
+
+#define ASSERT_TRUE(condition) do { \
+    if (!(condition)) { \
+        std::cerr << "ASSERTION FAILED: " #condition << " at line " << __LINE__ << std::endl; \
+        exit(1); \
+    } \
+} while(0)
+
+#define ASSERT_FALSE(condition) ASSERT_TRUE(!(condition))
+
+TEST(items_sort_by_layer_then_depth) {
+    ASSERT_TRUE(RenderQueue::MakeKey(0, -5.0f) < RenderQueue::MakeKey(0, 0.0f));
+    ASSERT_TRUE(RenderQueue::MakeKey(0, 0.0f) < RenderQueue::MakeKey(0, 0.5f));
+    ASSERT_TRUE(RenderQueue::MakeKey(0, 900.0f) < RenderQueue::MakeKey(1, -900.0f));
+
+    RenderQueue queue;
+    queue.Push(10, 1, 300.0f);
+    queue.Push(11, 1, -20.0f);
+    queue.Push(12, 0, 999.0f);   // Background layer draws first whatever its depth
+    queue.Push(13, 1, 120.5f);
+    queue.Push(14, 1, 120.0f);
+    std::vector<std::uint32_t> order = queue.Sort();
+    ASSERT_TRUE((order == std::vector<std::uint32_t>{2, 1, 4, 3, 0}));
+    ASSERT_FALSE(queue.WasAlreadySorted());
+}
+
+TEST(coherent_frames_skip_sorting_and_keep_ties_stable) {
+    RenderQueue queue;
+    queue.Push(7, 1, 50.0f);
+    queue.Push(3, 1, 50.0f);
+    queue.Push(9, 1, 10.0f);
+    std::vector<std::uint32_t> first = queue.Sort();
+    ASSERT_TRUE((first == std::vector<std::uint32_t>{2, 0, 1}));
+
+    // Same scene pushed in another order: last frame's order is reused as is
+    queue.Clear();
+    queue.Push(3, 1, 50.0f);
+    queue.Push(9, 1, 12.0f);
+    queue.Push(7, 1, 50.0f);
+    std::vector<std::uint32_t> second = queue.Sort();
+    ASSERT_TRUE(queue.WasAlreadySorted());
+    ASSERT_TRUE(queue.GetLastPassCount() == 0);
+    ASSERT_TRUE((second == std::vector<std::uint32_t>{1, 2, 0}));  // ids 9, 7, 3: the tie keeps 7 before 3
+
+    // A sprite walking in front of another, plus a newcomer
+    queue.Clear();
+    queue.Push(9, 1, 60.0f);
+    queue.Push(7, 1, 50.0f);
+    queue.Push(3, 1, 50.0f);
+    queue.Push(4, 1, 0.0f);
+    std::vector<std::uint32_t> third = queue.Sort();
+    ASSERT_FALSE(queue.WasAlreadySorted());
+    ASSERT_TRUE(queue.GetLastPassCount() > 0 && queue.GetLastPassCount() < 3);  // Layer byte pass skipped
+    ASSERT_TRUE((third == std::vector<std::uint32_t>{3, 1, 2, 0}));
+}
+
+TEST(few_crossings_are_fixed_up_without_radix_passes) {
+    RenderQueue queue;
+    for (std::uint32_t id = 0; id < 8; ++id) {
+        queue.Push(id, 1, id * 10.0f);
+    }
+    queue.Sort();
+
+    // Sprite 3 walks up past sprite 2; everything else stays put
+    queue.Clear();
+    for (std::uint32_t id = 0; id < 8; ++id) {
+        queue.Push(id, 1, id == 3 ? 15.0f : id * 10.0f);
+    }
+    std::vector<std::uint32_t> order = queue.Sort();
+    ASSERT_FALSE(queue.WasAlreadySorted());
+    ASSERT_TRUE(queue.GetLastMoveCount() == 1);
+    ASSERT_TRUE(queue.GetLastPassCount() == 0);
+    ASSERT_TRUE((order == std::vector<std::uint32_t>{0, 1, 3, 2, 4, 5, 6, 7}));
+
+    // Everything reversed: far over the shift budget, radix takes over
+    queue.Clear();
+    for (std::uint32_t id = 0; id < 8; ++id) {
+        queue.Push(id, 1, 100.0f - id * 10.0f);
+    }
+    order = queue.Sort();
+    ASSERT_TRUE(queue.GetLastPassCount() > 0);
+    ASSERT_TRUE((order == std::vector<std::uint32_t>{7, 6, 5, 4, 3, 2, 1, 0}));
+}
+
+TEST(wide_key_spans_sort_correctly) {
+    // Layers 0 and 255 span the whole key, so key and index no longer fit
+    // 32 bits and the 64-bit radix passes run
+    RenderQueue queue;
+    for (std::uint32_t id = 0; id < 300; ++id) {
+        queue.Push(id, id % 2 == 0 ? 255 : 0, 1000.0f - id);
+    }
+    const std::vector<std::uint32_t>& order = queue.Sort();
+    ASSERT_TRUE(order.size() == 300);
+    for (std::size_t rank = 1; rank < order.size(); ++rank) {
+        std::uint32_t previous = order[rank - 1];
+        std::uint32_t current = order[rank];
+        ASSERT_TRUE(RenderQueue::MakeKey(previous % 2 == 0 ? 255 : 0, 1000.0f - previous) <=
+                    RenderQueue::MakeKey(current % 2 == 0 ? 255 : 0, 1000.0f - current));
+    }
+}
+
+int main() {
+    std::cout << "🧪 RENDER QUEUE TESTS" << std::endl;
+    std::cout << "=====================" << std::endl;
+
+    RUN_TEST(items_sort_by_layer_then_depth);
+    RUN_TEST(coherent_frames_skip_sorting_and_keep_ties_stable);
+    RUN_TEST(few_crossings_are_fixed_up_without_radix_passes);
+    RUN_TEST(wide_key_spans_sort_correctly);
+
+    std::cout << "✅ All render queue tests passed!" << std::endl;
+    return 0;
+}